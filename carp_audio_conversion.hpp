@@ -3,6 +3,103 @@
 
 #include "carp_rtp.hpp"
 #include "carp_audio_codec.hpp"
+#include "carp_spsc_queue.hpp"
+#include "carp_file.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <set>
+
+#ifndef __EMSCRIPTEN__
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#define CARP_AUDIO_CONVERSION_THREADS
+#endif
+
+// ˮÿһ֡Ĳ()80(G729һ֡Ĳ)Ҳż(˫)
+#define CARP_AUDIO_CONVERSION_FRAME_SAMPLES 1600
+// ˮ֮໺֡
+#define CARP_AUDIO_CONVERSION_QUEUE_SIZE 16
+
+// ˮдݵһ֡
+struct CarpAudioFrame
+{
+	std::vector<short> samples;		// ̶CARP_AUDIO_CONVERSION_FRAME_SAMPLESСλõʱ򲻻ڴ
+	int count = 0;					// ЧĲ
+	bool end = false;				// Ƿһ֡
+};
+
+// ʽزʹԲֵתڵ˫֮ת
+// ţǰ֮Ĳֵ״̬ᱣ
+class CarpAudioResampler
+{
+public:
+	bool Init(int src_channel_num, int src_sample_rate, int dst_channel_num, int dst_sample_rate)
+	{
+		if (src_channel_num < 1 || src_channel_num > 2 || dst_channel_num < 1 || dst_channel_num > 2) return false;
+		if (src_sample_rate <= 0 || dst_sample_rate <= 0) return false;
+
+		m_src_channel_num = src_channel_num;
+		m_dst_channel_num = dst_channel_num;
+		m_pass_through = src_channel_num == dst_channel_num && src_sample_rate == dst_sample_rate;
+		m_step = (double)src_sample_rate / dst_sample_rate;
+		m_position = 0;
+		m_last[0] = m_last[1] = 0;
+		return true;
+	}
+
+	// ʽһҪת
+	bool IsPassThrough() const { return m_pass_through; }
+
+	// תһβ׷ӵoutĺ
+	void Process(const short* in, int count, std::vector<short>& out)
+	{
+		const int frame_count = count / m_src_channel_num;
+		if (frame_count <= 0) return;
+
+		// m_positionһʱеλã-1ʾһεһʱ
+		while (m_position <= frame_count - 1)
+		{
+			const int index = (int)std::floor(m_position);
+			const double frac = m_position - index;
+			const short* a = index < 0 ? m_last : in + index * m_src_channel_num;
+			const short* b = in + (index + 1) * m_src_channel_num;
+			for (int channel = 0; channel < m_dst_channel_num; ++channel)
+			{
+				double value = GetChannel(a, channel);
+				if (frac > 0) value += (GetChannel(b, channel) - value) * frac;
+				out.push_back((short)std::lround(value));
+			}
+			m_position += m_step;
+		}
+		m_position -= frame_count;
+
+		const short* last = in + (frame_count - 1) * m_src_channel_num;
+		for (int channel = 0; channel < m_src_channel_num; ++channel)
+			m_last[channel] = last[channel];
+	}
+
+private:
+	// ȡһʱӦֵ˫תȡƽת˫ֱӸ
+	double GetChannel(const short* frame, int channel) const
+	{
+		if (m_src_channel_num == m_dst_channel_num) return frame[channel];
+		if (m_src_channel_num == 2) return (frame[0] + frame[1]) * 0.5;
+		return frame[0];
+	}
+
+private:
+	int m_src_channel_num = 1;
+	int m_dst_channel_num = 1;
+	bool m_pass_through = true;
+	double m_step = 1;
+	double m_position = 0;
+	short m_last[2] = { 0, 0 };
+};
 
 class CarpAudioConversion
 {
@@ -64,10 +161,314 @@ public:
 		DECODER_READ_FILE_FAILED,
 		DECODER_READ_HEAD_FAILED,
 		DECODER_DECODE_FAILED,
+		RESAMPLER_CREATE_FAILED,
+	};
+
+	struct ConversionOption
+	{
+		int channel_num = 0;		// Ŀֻ֧120ʾԴļһ
+		int sample_rate = 0;		// Ŀʣ0ʾԴļһ
+		bool threaded = true;		// 룬زǷʹһ̣߳תʱļ֮ѾˣԹص
+	};
+
+	struct ConversionStatistics
+	{
+		long long sample_count = 0;	// Ĳ()
+		double audio_seconds = 0;	// Ƶʱ
+		double cost_seconds = 0;	// תʱ
+
+		// ʵʱʣʱƵʱԽСԽ죬0.01ʾ1ת100Ƶ
+		double GetRealtimeFactor() const { return audio_seconds > 0 ? cost_seconds / audio_seconds : 0; }
+	};
+
+	struct BatchTask
+	{
+		std::string src_path;
+		std::string dst_path;
+		ConversionError error = ConversionError::OK;
+		ConversionStatistics statistics;
+	};
+
+private:
+	// һļתˮ:  -> ز -> 룬֮ù̶С֡ݲ
+	// ÿһдһStepǰƽһûκνչʱ򷵻false
+	// ̵߳ʱÿһһ̣߳ûнչ͵ȴε̵֪ͨ߳ʱ
+	class Pipeline
+	{
+	public:
+		Pipeline(FILE* src_file, FILE* dst_file, CarpAudioDecoder* decoder, CarpAudioEncoder* encoder, CarpAudioResampler* resampler)
+			: m_src_file(src_file), m_dst_file(dst_file), m_decoder(decoder), m_encoder(encoder), m_resampler(resampler)
+			, m_decode_queue(CARP_AUDIO_CONVERSION_QUEUE_SIZE), m_resample_queue(CARP_AUDIO_CONVERSION_QUEUE_SIZE)
+		{
+			// Ҫزʱ򣬽ֱ
+			m_decode_writer.queue = resampler->IsPassThrough() ? &m_resample_queue : &m_decode_queue;
+			m_resample_writer.queue = &m_resample_queue;
+		}
+
+		// ȡļͷʱѾĲ
+		void SetHeadSamples(std::vector<short>& sample_data)
+		{
+			m_decoded.swap(sample_data);
+			m_sample_count += (long long)m_decoded.size();
+		}
+
+		long long GetSampleCount() const { return m_sample_count; }
+
+		ConversionError Run(bool threaded)
+		{
+#ifdef CARP_AUDIO_CONVERSION_THREADS
+			if (threaded)
+			{
+				std::thread decode_thread(&Pipeline::Loop, this, &Pipeline::DecodeStep, &m_decode_done);
+				std::thread resample_thread;
+				if (!m_resampler->IsPassThrough())
+					resample_thread = std::thread(&Pipeline::Loop, this, &Pipeline::ResampleStep, &m_resample_done);
+				Loop(&Pipeline::EncodeStep, &m_encode_done);
+
+				decode_thread.join();
+				if (resample_thread.joinable()) resample_thread.join();
+				return m_error;
+			}
+#endif
+			while (!m_encode_done && m_error == ConversionError::OK)
+			{
+				DecodeStep();
+				if (!m_resampler->IsPassThrough()) ResampleStep();
+				EncodeStep();
+			}
+			return m_error;
+		}
+
+	private:
+		// д״̬δд֡BeginPushõĲλ
+		struct Writer
+		{
+			CarpSpscQueue<CarpAudioFrame>* queue = nullptr;
+			bool filling = false;		// ǰλǷѾʼд
+			bool end_sent = false;		// һ֡ǷѾύ
+		};
+
+		// samples[offset, size)дУдһ֡ύendΪtrueʱһ֡Ҳύ
+		// ˷false´δoffsetд
+		static bool Write(Writer& writer, const std::vector<short>& samples, size_t& offset, bool end, bool& progress)
+		{
+			while (offset < samples.size() || (end && !writer.end_sent))
+			{
+				CarpAudioFrame* frame = writer.queue->BeginPush();
+				if (frame == nullptr) return false;
+
+				if (!writer.filling)
+				{
+					frame->samples.resize(CARP_AUDIO_CONVERSION_FRAME_SAMPLES);
+					frame->count = 0;
+					frame->end = false;
+					writer.filling = true;
+				}
+
+				const size_t count = std::min((size_t)(CARP_AUDIO_CONVERSION_FRAME_SAMPLES - frame->count), samples.size() - offset);
+				if (count > 0) memcpy(frame->samples.data() + frame->count, samples.data() + offset, count * sizeof(short));
+				frame->count += (int)count;
+				offset += count;
+				progress = true;
+
+				const bool last = end && offset == samples.size();
+				if (frame->count == CARP_AUDIO_CONVERSION_FRAME_SAMPLES || last)
+				{
+					frame->end = last;
+					writer.queue->EndPush();
+					writer.filling = false;
+					writer.end_sent = last;
+				}
+			}
+			return true;
+		}
+
+		// ȡԴļ
+		bool DecodeStep()
+		{
+			if (m_decode_done) return false;
+
+			// ȰϴνĲͳȥ
+			bool progress = false;
+			if (!Write(m_decode_writer, m_decoded, m_decoded_offset, m_decode_end, progress)) return progress;
+			if (m_decode_end)
+			{
+				m_decode_done = true;
+				return true;
+			}
+
+			unsigned char buffer[1020]; // ʹ10g729Ľ
+			int read_size = (int)fread(buffer, 1, sizeof(buffer), m_src_file);
+			if (read_size > 0)
+			{
+				if (m_decoder->Decode(buffer, read_size, m_decoded) == false)
+				{
+					SetError(ConversionError::DECODER_DECODE_FAILED);
+					return true;
+				}
+			}
+			else
+			{
+				m_decoder->Flush(m_decoded);
+				m_decode_end = true;
+			}
+			m_decoded_offset = 0;
+			m_sample_count += (long long)m_decoded.size();
+
+			if (Write(m_decode_writer, m_decoded, m_decoded_offset, m_decode_end, progress) && m_decode_end)
+				m_decode_done = true;
+			return true;
+		}
+
+		// ز
+		bool ResampleStep()
+		{
+			if (m_resample_done) return false;
+
+			bool progress = false;
+			if (!Write(m_resample_writer, m_resampled, m_resampled_offset, m_resample_end, progress)) return progress;
+			if (m_resample_end)
+			{
+				m_resample_done = true;
+				return true;
+			}
+
+			CarpAudioFrame* frame = m_decode_queue.Front();
+			if (frame == nullptr) return progress;
+
+			m_resampled.resize(0);
+			m_resampler->Process(frame->samples.data(), frame->count, m_resampled);
+			m_resampled_offset = 0;
+			m_resample_end = frame->end;
+			m_decode_queue.Pop();
+
+			if (Write(m_resample_writer, m_resampled, m_resampled_offset, m_resample_end, progress) && m_resample_end)
+				m_resample_done = true;
+			return true;
+		}
+
+		// 벢дĿļ
+		bool EncodeStep()
+		{
+			if (m_encode_done) return false;
+
+			CarpAudioFrame* frame = m_resample_queue.Front();
+			if (frame == nullptr) return false;
+
+			if (frame->count > 0)
+			{
+				m_encoder->Encode(frame->samples.data(), frame->count, m_encoded);
+				// бݣôдļ
+				if (!m_encoded.empty()) fwrite(m_encoded.data(), 1, m_encoded.size(), m_dst_file);
+			}
+			const bool end = frame->end;
+			m_resample_queue.Pop();
+			if (!end) return true;
+
+			// ʣȫ
+			m_encoder->Flush(m_encoded);
+			// бôдļ
+			if (!m_encoded.empty()) fwrite(m_encoded.data(), 1, m_encoded.size(), m_dst_file);
+
+			// ΪڱļͷϢᷢ仯ٴдļͷ
+			int head_size = m_encoder->GetHeadSize();
+			if (head_size > 0)
+			{
+				fseek(m_dst_file, 0, SEEK_SET);
+				fwrite(m_encoder->GetHeadMemory(), 1, head_size, m_dst_file);
+			}
+
+			m_encode_done = true;
+			return true;
+		}
+
+#ifdef CARP_AUDIO_CONVERSION_THREADS
+		// ̺߳нչ֪ͨΣûнչ͵ȵнչΪֹ
+		void Loop(bool (Pipeline::*step)(), std::atomic<bool>* done)
+		{
+			while (!*done && m_error == ConversionError::OK)
+			{
+				const unsigned int version = m_version;
+				if ((this->*step)())
+				{
+					Notify();
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_cv.wait(lock, [this, version]() { return m_version != version || m_error != ConversionError::OK; });
+			}
+			Notify();
+		}
+
+		void Notify()
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				++m_version;
+			}
+			m_cv.notify_all();
+		}
+#else
+		void Notify() {}
+#endif
+
+		void SetError(ConversionError error)
+		{
+			ConversionError expected = ConversionError::OK;
+			m_error.compare_exchange_strong(expected, error);
+			Notify();
+		}
+
+	private:
+		FILE* m_src_file = nullptr;
+		FILE* m_dst_file = nullptr;
+		CarpAudioDecoder* m_decoder = nullptr;
+		CarpAudioEncoder* m_encoder = nullptr;
+		CarpAudioResampler* m_resampler = nullptr;
+
+		CarpSpscQueue<CarpAudioFrame> m_decode_queue;		//  -> ز
+		CarpSpscQueue<CarpAudioFrame> m_resample_queue;		// ز -> 
+
+		// ߳
+		std::vector<short> m_decoded;
+		size_t m_decoded_offset = 0;
+		bool m_decode_end = false;
+		Writer m_decode_writer;
+		long long m_sample_count = 0;
+
+		// ز߳
+		std::vector<short> m_resampled;
+		size_t m_resampled_offset = 0;
+		bool m_resample_end = false;
+		Writer m_resample_writer;
+
+		// ߳
+		std::vector<unsigned char> m_encoded;
+
+		std::atomic<bool> m_decode_done{ false };
+		std::atomic<bool> m_resample_done{ false };
+		std::atomic<bool> m_encode_done{ false };
+		std::atomic<ConversionError> m_error{ ConversionError::OK };
+
+#ifdef CARP_AUDIO_CONVERSION_THREADS
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::atomic<unsigned int> m_version{ 0 };
+#endif
 	};
 
-    static ConversionError Conversion(const std::string& src_path, const std::string& dst_path)
-    {
+public:
+	static ConversionError Conversion(const std::string& src_path, const std::string& dst_path)
+	{
+		return Conversion(src_path, dst_path, ConversionOption(), nullptr);
+	}
+
+	// תһļstatisticsΪյʱ򷵻Ƶʱͺʱ
+	static ConversionError Conversion(const std::string& src_path, const std::string& dst_path, const ConversionOption& option, ConversionStatistics* statistics)
+	{
+		const auto start_time = std::chrono::steady_clock::now();
+
 		// Դļ
 		FILE* src_file = nullptr;
 #ifdef _WIN32
@@ -76,6 +477,7 @@ public:
 		src_file = fopen(src_path.c_str(), "rb");
 #endif
 		if (src_file == nullptr) return ConversionError::SRC_FILE_OPEN_FAILED;
+		std::unique_ptr<FILE, int(*)(FILE*)> src_file_guard(src_file, fclose);
 
 		// Ŀļ
 		FILE* dst_file = nullptr;
@@ -84,167 +486,170 @@ public:
 #else
 		dst_file = fopen(dst_path.c_str(), "wb");
 #endif
-		if (dst_file == nullptr)
-		{
-			fclose(src_file);
-			return ConversionError::DST_FILE_OPEN_FAILED;
-		}
+		if (dst_file == nullptr) return ConversionError::DST_FILE_OPEN_FAILED;
+		std::unique_ptr<FILE, int(*)(FILE*)> dst_file_guard(dst_file, fclose);
 
 		// 
 		std::string src_ext = GetFileExtByPath(src_path);
-		auto* decoder = CreateDecoder(src_ext);
-		if (decoder == nullptr)
-		{
-			fclose(src_file);
-			fclose(dst_file);
-			return ConversionError::DECODER_CREATE_FAILED;
-		}
+		std::unique_ptr<CarpAudioDecoder> decoder(CreateDecoder(src_ext));
+		if (decoder == nullptr) return ConversionError::DECODER_CREATE_FAILED;
 
 		// ҪļͷôҪһ²֪ʵϢ
-		CarpAudioEncoder* encoder = nullptr;
+		// ȡļͷʱ򣬿ܻһЩݣҽˣsample_data
+		std::vector<short> sample_data;
 		if (decoder->NeedReadHead())
 		{
-			std::vector<unsigned char> encode_buffer;
-
 			// ÿζļͷٶֽ
 			int min_read_head_buffer_size = decoder->MinReadHead();
 			std::vector<unsigned char> head_buffer;
-			std::vector<short> sample_data;
 			head_buffer.resize(min_read_head_buffer_size);
 			while (true)
 			{
 				// ȡļ
 				int read_size = (int)fread(head_buffer.data(), 1, min_read_head_buffer_size, src_file);
-				if (read_size == 0)
-				{
-					fclose(src_file);
-					fclose(dst_file);
-					delete decoder;
-					return ConversionError::DECODER_READ_FILE_FAILED;
-				}
+				if (read_size == 0) return ConversionError::DECODER_READ_FILE_FAILED;
+
 				// ļͷ
 				bool is_completed = false;
 				if (decoder->ReadHead(head_buffer.data(), read_size, sample_data, is_completed) == false)
-				{
-					fclose(src_file);
-					fclose(dst_file);
-					delete decoder;
 					return ConversionError::DECODER_READ_HEAD_FAILED;
-				}
 
 				// δôͼȡ
-				if (!is_completed) continue;
-
-				// ȡͲ
-				int channel_num = decoder->GetChannelNum();
-				int sample_rate = decoder->GetSampleRate();
-
-				// 
-				std::string dst_ext = GetFileExtByPath(dst_path);
-				encoder = CreateEncoder(dst_ext, channel_num, sample_rate);
-				if (encoder == nullptr)
-				{
-					fclose(src_file);
-					fclose(dst_file);
-					delete decoder;
-					return ConversionError::ENCODER_CREATE_FAILED;
-				}
-
-				// ļͷôд롣ʵҪռļռ䣬ݡд
-				int head_size = encoder->GetHeadSize();
-				if (head_size > 0) fwrite(encoder->GetHeadMemory(), 1, head_size, dst_file);
-
-				// ڶȡļͷʱ򣬶һЩݣֽⲿݣôҪ
-				if (!sample_data.empty())
-				{
-					// ʼ
-					encoder->Encode(sample_data.data(), (int)sample_data.size(), encode_buffer);
-					// õôдļ
-					if (!encode_buffer.empty()) fwrite(encode_buffer.data(), 1, encode_buffer.size(), dst_file);
-				}
-				break;
+				if (is_completed) break;
 			}
 		}
 
+		// ȡͲʣȷĿʽ
+		int src_channel_num = decoder->GetChannelNum();
+		int src_sample_rate = decoder->GetSampleRate();
+		int dst_channel_num = option.channel_num > 0 ? option.channel_num : src_channel_num;
+		int dst_sample_rate = option.sample_rate > 0 ? option.sample_rate : src_sample_rate;
+
+		CarpAudioResampler resampler;
+		if (!resampler.Init(src_channel_num, src_sample_rate, dst_channel_num, dst_sample_rate))
+			return ConversionError::RESAMPLER_CREATE_FAILED;
+
 		// 
-		if (encoder == nullptr)
-		{
-			int channel_num = decoder->GetChannelNum();
-			int sample_rate = decoder->GetSampleRate();
+		std::string dst_ext = GetFileExtByPath(dst_path);
+		std::unique_ptr<CarpAudioEncoder> encoder(CreateEncoder(dst_ext, dst_channel_num, dst_sample_rate));
+		if (encoder == nullptr) return ConversionError::ENCODER_CREATE_FAILED;
 
-			std::string dst_ext = GetFileExtByPath(dst_path);
-			encoder = CreateEncoder(dst_ext, channel_num, sample_rate);
-			if (encoder == nullptr)
-			{
-				fclose(src_file);
-				fclose(dst_file);
-				delete decoder;
-				return ConversionError::ENCODER_CREATE_FAILED;
-			}
+		// ļͷôд롣ʵҪռļռ䣬ݡд
+		int head_size = encoder->GetHeadSize();
+		if (head_size > 0) fwrite(encoder->GetHeadMemory(), 1, head_size, dst_file);
+
+		// ʼˮת
+		Pipeline pipeline(src_file, dst_file, decoder.get(), encoder.get(), &resampler);
+		pipeline.SetHeadSamples(sample_data);
+		ConversionError error = pipeline.Run(option.threaded);
 
-			// ļͷôд롣ʵҪռļռ䣬ݡд
-			int head_size = encoder->GetHeadSize();
-			if (head_size > 0) fwrite(encoder->GetHeadMemory(), 1, head_size, dst_file);
+		if (statistics)
+		{
+			statistics->sample_count = pipeline.GetSampleCount();
+			statistics->audio_seconds = (double)statistics->sample_count / src_channel_num / src_sample_rate;
+			statistics->cost_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
 		}
+		return error;
+	}
 
-		std::vector<short> sample_data;
-		std::vector<unsigned char> encode_buffer;
+	// תworker_count߳ͬʱתÿ߳תһļȡһ
+	// ÿļĽtask_list棬ܵƵʱתĺʱ
+	static ConversionStatistics BatchConversion(std::vector<BatchTask>& task_list, int worker_count, const ConversionOption& option)
+	{
+		const auto start_time = std::chrono::steady_clock::now();
 
-		// ʼѭȡļݽнͱ
-		while (true)
+		std::atomic<size_t> next_index{ 0 };
+		auto worker = [&]()
 		{
-			// ȡԴļ
-			unsigned char buffer[1020]; // ʹ10g729Ľ
-			int read_size = (int)fread(buffer, 1, sizeof(buffer), src_file);
-			
-			if (read_size > 0)
-			{
-				if (decoder->Decode(buffer, read_size, sample_data) == false)
-				{
-					fclose(src_file);
-					fclose(dst_file);
-					delete decoder;
-					delete encoder;
-					return ConversionError::DECODER_DECODE_FAILED;
-				}
-			}
-			else
+			while (true)
 			{
-				decoder->Flush(sample_data);
-			}
+				const size_t index = next_index++;
+				if (index >= task_list.size()) break;
 
-			// н
-			if (!sample_data.empty())
-			{
-				// ʼ
-				encoder->Encode(sample_data.data(), (int)sample_data.size(), encode_buffer);
-				// бݣôдļ
-				if (!encode_buffer.empty()) fwrite(encode_buffer.data(), 1, encode_buffer.size(), dst_file);
+				auto& task = task_list[index];
+				task.error = Conversion(task.src_path, task.dst_path, option, &task.statistics);
 			}
+		};
+
+#ifdef CARP_AUDIO_CONVERSION_THREADS
+		std::vector<std::thread> thread_list;
+		const size_t thread_count = std::min((size_t)std::max(worker_count, 1), task_list.size());
+		for (size_t i = 1; i < thread_count; ++i)
+			thread_list.emplace_back(worker);
+		worker();
+		for (auto& thread : thread_list)
+			thread.join();
+#else
+		worker();
+#endif
 
-			if (read_size <= 0) break;
+		ConversionStatistics statistics;
+		for (auto& task : task_list)
+		{
+			if (task.error != ConversionError::OK) continue;
+			statistics.sample_count += task.statistics.sample_count;
+			statistics.audio_seconds += task.statistics.audio_seconds;
 		}
+		statistics.cost_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+		return statistics;
+	}
 
-		// ʣȫ
-		encoder->Flush(encode_buffer);
-		// бôдļ
-		if (!encode_buffer.empty()) fwrite(encode_buffer.data(), 1, encode_buffer.size(), dst_file);
+	// ļܽļתΪdst_extʽ浽dst_folderļ
+	// ĿļĳԴļͬ(ͬһļwavתwav)ߺǰĿļͬ(a.wava.pcm)ļŽtask_list
+	// ڶȡԴļգ߶߳ͬʱдͬһļ
+	static ConversionStatistics FolderConversion(const std::string& src_folder, const std::string& dst_folder, const std::string& dst_ext
+		, int worker_count, const ConversionOption& option, std::vector<BatchTask>& task_list)
+	{
+		std::vector<std::string> file_list, dir_list;
+		CarpFile::GetNameListInFolder(src_folder, file_list, dir_list);
+		CarpFile::CreateDeepFolder(dst_folder);
 
-		// ΪڱļͷϢᷢ仯ٴдļͷ
-		int head_size = encoder->GetHeadSize();
-		if (head_size > 0)
+		const std::string src_prefix = CarpFile::TryAddFileSeparator(src_folder);
+		const std::string dst_prefix = CarpFile::TryAddFileSeparator(dst_folder);
+		std::set<std::string> path_set;
+		for (auto& file_name : file_list)
+			path_set.insert(GetPathKey(src_prefix + file_name));
+
+		task_list.clear();
+		for (auto& file_name : file_list)
 		{
-			fseek(dst_file, 0, SEEK_SET);
-			fwrite(encoder->GetHeadMemory(), 1, head_size, dst_file);
+			std::unique_ptr<CarpAudioDecoder> decoder(CreateDecoder(GetFileExtByPath(file_name)));
+			if (decoder == nullptr) continue;
+
+			BatchTask task;
+			task.src_path = src_prefix + file_name;
+			task.dst_path = dst_prefix + CarpFile::GetJustFileNameByPath(file_name) + "." + dst_ext;
+			if (!path_set.insert(GetPathKey(task.dst_path)).second) continue;
+			task_list.push_back(task);
 		}
 
-		delete decoder;
-		delete encoder;
-		fclose(src_file);
-		fclose(dst_file);
+		return BatchConversion(task_list, worker_count, option);
+	}
 
-		return ConversionError::OK;
-    }
+private:
+	// Ƚ·ǲͬһļWindowsļִСд
+	static std::string GetPathKey(std::string path)
+	{
+#ifdef _WIN32
+		UpperString(path);
+#endif
+		return path;
+	}
 };
 
+/* eg.
+	// ļ16k˫¼ת8kG729
+	CarpAudioConversion::ConversionOption option;
+	option.channel_num = 1;
+	option.sample_rate = 8000;
+	CarpAudioConversion::ConversionStatistics statistics;
+	auto error = CarpAudioConversion::Conversion("record.wav", "record.g729", option, &statistics);
+
+	// ļУļ֮ѾУļͲٿ߳
+	option.threaded = false;
+	std::vector<CarpAudioConversion::BatchTask> task_list;
+	statistics = CarpAudioConversion::FolderConversion("record/", "g729/", "g729", std::thread::hardware_concurrency(), option, task_list);
+	CARP_INFO("audio:" << statistics.audio_seconds << "s cost:" << statistics.cost_seconds << "s rtf:" << statistics.GetRealtimeFactor());
+*/
+
 #endif
@@ -1,15 +1,52 @@
-
 #ifndef CARP_CSV_INCLUDED
 #define CARP_CSV_INCLUDED
 
 #include <string>
 #include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <map>
+#include <unordered_map>
+#include <thread>
+#include <functional>
+
+#include "carp_file.hpp"
 
 #ifdef _WIN32
 #include <windows.h>
+#include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CARP_CSV_SSE2
 #endif
 
 #define CARP_CSV_END_OF_FILE 0
+// ֿȡļĴС
+#define CARP_CSV_READ_BLOCK_SIZE (64 * 1024)
+// ƿյİ汾ţʽ仯ʱҪ޸
+#define CARP_CSV_SNAPSHOT_VERSION 1
+
+// Ԫ񣬱ڴеƫƣҲǿеĴ洢ʽ
+struct CarpCsvCell
+{
+    unsigned int offset = 0;     // ڻеʼλ
+    unsigned int size = 0;       // 
+    unsigned int quoted = 0;     // ǷţҪڵһηʱ
+};
+
+// ƿļͷеԪͻ
+struct CarpCsvSnapshotHead
+{
+    char magic[4] = { 'C', 'S', 'V', 'B' };
+    unsigned int version = CARP_CSV_SNAPSHOT_VERSION;
+    long long source_size = 0;          // ԴļС
+    long long source_time = 0;          // Դļ޸ʱ
+    unsigned long long col_count = 0;
+    unsigned long long row_count = 0;
+    unsigned long long buffer_size = 0;
+};
 
 class CarpCsv
 {
@@ -49,11 +86,11 @@ public:
 #endif
 
     static size_t WrapFRead(void* file, void* buffer, size_t size, size_t count) { return fread(buffer, size, count, static_cast<FILE*>(file)); }
-	
+
     bool ReadFromStdFile(const std::string& file_path, std::string* error = nullptr)
     {
         m_file_path = file_path;
-        m_data.resize(0);
+        Clear();
 
         FILE* file = nullptr;
 #ifdef _WIN32
@@ -67,67 +104,297 @@ public:
             return false;
         }
 
+        // ȻȡļСһڴ
+        size_t size_hint = 0;
+        if (fseek(file, 0, SEEK_END) == 0)
+        {
+            const long size = ftell(file);
+            if (size > 0) size_hint = static_cast<size_t>(size);
+            fseek(file, 0, SEEK_SET);
+        }
+
         try
         {
-            ReadFile(WrapFRead, file, -1);
+            ReadFile(WrapFRead, file, size_hint);
             fclose(file);
         }
         catch (CarpCsvException& e)
         {
             if (error != nullptr) *error = e.What();
-            m_data.resize(0);
+            Clear();
             if (file != nullptr) fclose(file);
             return false;
         }
-    	
+
         return true;
     }
 
 	bool ReadFromCustomFile(const std::string& file_path, READ_FILE read_func, void* file, std::string* error = nullptr)
     {
         m_file_path = file_path;
-        m_data.resize(0);
+        Clear();
 
         try
         {
-            ReadFile(reinterpret_cast<READ_FILE>(read_func), file, -1);
+            ReadFile(reinterpret_cast<READ_FILE>(read_func), file, 0);
         }
         catch (CarpCsvException& e)
         {
             if (error != nullptr) *error = e.What();
-            m_data.resize(0);
+            Clear();
             return false;
         }
 
         return true;
     }
 
-    virtual size_t GetColCount() const { return m_data.empty() ? 0 : m_data[0].size(); }
-    virtual size_t GetRowCount() const { return m_data.size(); }
-    const std::vector<std::string>& GetRowData(size_t index) const { return m_data[index]; }
+    /* ȴӶƿռأղڻߺԴļһʱԴļɿ
+     * @param file_path: csvļ·
+     * @param snapshot_path: ļ·
+     * @return ɹnullptrʧܷشϢ
+     */
+    const char* LoadWithSnapshot(const char* file_path, const char* snapshot_path)
+    {
+        m_temp_string.clear();
 
-    virtual const char* ReadCell(size_t row, size_t col)
-	{
-        if (row >= m_data.size() || col >= m_data[row].size())
+        CarpFile::PathAttribute attr;
+        if (!CarpFile::GetPathAttribute(file_path, attr))
         {
-            m_temp_string.clear();
+            m_temp_string = "can't open file";
             return m_temp_string.c_str();
         }
-        return m_data[row][col].c_str();
+
+        if (LoadSnapshot(snapshot_path, static_cast<long long>(attr.size), static_cast<long long>(attr.modify_time)))
+        {
+            m_file_path = file_path;
+            return nullptr;
+        }
+
+        if (!ReadFromStdFile(file_path, &m_temp_string)) return m_temp_string.c_str();
+        SaveSnapshot(snapshot_path, static_cast<long long>(attr.size), static_cast<long long>(attr.modify_time));
+        return nullptr;
+    }
+
+    /* ΪƿգеԪȽ
+     * @param snapshot_path: ļ·
+     * @param source_size: ԴļСУ
+     * @param source_time: Դļ޸ʱ䣬У
+     */
+    bool SaveSnapshot(const std::string& snapshot_path, long long source_size, long long source_time)
+    {
+        if (m_cell_ptr == nullptr || m_mapping.IsOpen()) return false;
+
+        for (auto& cell : m_cells)
+        {
+            if (cell.quoted) Unquote(cell);
+        }
+
+        CarpCsvSnapshotHead head;
+        head.source_size = source_size;
+        head.source_time = source_time;
+        head.col_count = m_col_count;
+        head.row_count = m_row_count;
+        head.buffer_size = m_buffer.size();
+
+        // ɵĿտڱ̻CarpCsvӳ䣬ԭؽضд
+        // дʱļʱļϽ̺̣߳Ȼ滻
+        const std::string thread_id = std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#ifdef _WIN32
+        const std::string temp_path = snapshot_path + "." + std::to_string(GetCurrentProcessId()) + "_" + thread_id + ".tmp";
+        FILE* file = nullptr;
+        _wfopen_s(&file, UTF82Unicode(temp_path).c_str(), L"wb");
+#else
+        const std::string temp_path = snapshot_path + "." + std::to_string(getpid()) + "_" + thread_id + ".tmp";
+        FILE* file = fopen(temp_path.c_str(), "wb");
+#endif
+        if (file == nullptr) return false;
+
+        bool result = fwrite(&head, sizeof(head), 1, file) == 1;
+        if (result && !m_cells.empty()) result = fwrite(m_cells.data(), sizeof(CarpCsvCell), m_cells.size(), file) == m_cells.size();
+        if (result) result = fwrite(m_buffer.data(), 1, m_buffer.size(), file) == m_buffer.size();
+        result = fclose(file) == 0 && result;
+
+        // ѾӳɿյĵطʹþɵݣWindows¾ɿڱӳʱ滻ʧܣfalse
+#ifdef _WIN32
+        if (result) result = MoveFileExW(UTF82Unicode(temp_path).c_str(), UTF82Unicode(snapshot_path).c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+        if (!result) _wremove(UTF82Unicode(temp_path).c_str());
+#else
+        if (result) result = rename(temp_path.c_str(), snapshot_path.c_str()) == 0;
+        if (!result) remove(temp_path.c_str());
+#endif
+        return result;
+    }
+
+    /* ӳƿգֱӳڴзʣҪ
+     * @param snapshot_path: ļ·
+     * @param source_size: ԴļСһʧ
+     * @param source_time: Դļ޸ʱ䣬һʧ
+     */
+    bool LoadSnapshot(const std::string& snapshot_path, long long source_size, long long source_time)
+    {
+        Clear();
+
+        if (!m_mapping.Open(snapshot_path)) return false;
+
+        const char* data = m_mapping.GetData();
+        const size_t size = m_mapping.GetSize();
+
+        // ļͷ
+        CarpCsvSnapshotHead head;
+        if (size < sizeof(head))
+        {
+            Clear();
+            return false;
+        }
+        memcpy(&head, data, sizeof(head));
+        const CarpCsvSnapshotHead expect;
+        if (memcmp(head.magic, expect.magic, sizeof(head.magic)) != 0 || head.version != expect.version
+            || head.source_size != source_size || head.source_time != source_time
+            || head.buffer_size == 0)
+        {
+            Clear();
+            return false;
+        }
+
+        // СԪļС㣬ֱˣֹ
+        const unsigned long long body_size = size - sizeof(head);
+        const unsigned long long cell_count = head.buffer_size <= body_size ? (body_size - head.buffer_size) / sizeof(CarpCsvCell) : 0;
+        if (head.buffer_size > body_size || (body_size - head.buffer_size) % sizeof(CarpCsvCell) != 0
+            || head.col_count == 0 || head.row_count == 0
+            || cell_count % head.row_count != 0 || cell_count / head.row_count != head.col_count)
+        {
+            Clear();
+            return false;
+        }
+
+        // ÿԪ񣬱ڻڲ0βѾ
+        const CarpCsvCell* cells = reinterpret_cast<const CarpCsvCell*>(data + sizeof(head));
+        const char* buffer = data + sizeof(head) + cell_count * sizeof(CarpCsvCell);
+        for (unsigned long long i = 0; i < cell_count; ++i)
+        {
+            const CarpCsvCell& cell = cells[i];
+            if (cell.quoted != 0 || cell.offset >= head.buffer_size || cell.size >= head.buffer_size - cell.offset
+                || buffer[cell.offset + cell.size] != 0)
+            {
+                Clear();
+                return false;
+            }
+        }
+
+        m_col_count = static_cast<size_t>(head.col_count);
+        m_row_count = static_cast<size_t>(head.row_count);
+        m_cell_ptr = cells;
+        m_buffer_ptr = buffer;
+        return true;
+    }
+
+    virtual size_t GetColCount() const { return m_col_count; }
+    virtual size_t GetRowCount() const { return m_row_count; }
+
+    // ÿһеһηʱɣصClose֮ǰһֱЧ
+    const std::vector<std::string>& GetRowData(size_t index) const
+    {
+        static const std::vector<std::string> empty;
+        if (index >= m_row_count) return empty;
+
+        if (m_rows.empty()) m_rows.resize(m_row_count);
+        auto& row = m_rows[index];
+        if (!row.empty()) return row;
+
+        row.resize(m_col_count);
+        for (size_t col = 0; col < m_col_count; ++col)
+        {
+            const CarpCsvCell& cell = m_cell_ptr[index * m_col_count + col];
+            row[col].assign(m_buffer_ptr + cell.offset, cell.size);
+            // ﲻ޸ĻڿϽ
+            if (cell.quoted) row[col].resize(UnquoteBuffer(&row[col][0], cell.size));
+        }
+        return row;
+    }
+
+    virtual const char* ReadCell(size_t row, size_t col)
+	{
+        size_t size = 0;
+        return GetCell(row, col, size);
 	}
+
+    // ȡԪڴͳȣڴ0βClose֮ǰһֱЧ
+    const char* GetCell(size_t row, size_t col, size_t& size)
+    {
+        if (row >= m_row_count || col >= m_col_count)
+        {
+            size = 0;
+            return "";
+        }
+
+        const size_t index = row * m_col_count + col;
+        // еĵԪѾˣʱѾﲻܷm_cells
+        if (!m_mapping.IsOpen() && m_cells[index].quoted) Unquote(m_cells[index]);
+        size = m_cell_ptr[index].size;
+        return m_buffer_ptr + m_cell_ptr[index].offset;
+    }
+
+    /* ĳһΪkeyУһβʱ
+     * @param key: key
+     * @param key_col: keyڵ
+     * @param start_row: start_rowһпʼ
+     * @return кţҲ-1
+     */
+    int FindRow(const std::string& key, size_t key_col, size_t start_row)
+    {
+        if (key_col >= m_col_count) return -1;
+
+        auto& index = GetIndex(key_col, start_row);
+        auto it = index.find(CarpCsvKey(key.data(), key.size()));
+        if (it == index.end()) return -1;
+        return static_cast<int>(it->second);
+    }
+
+    // ȡԪÿһеһζȡʱн
+    int ReadInt(size_t row, size_t col)
+    {
+        if (row >= m_row_count || col >= m_col_count) return 0;
+
+        auto& column = m_int_columns[col];
+        if (column.empty())
+        {
+            column.resize(m_row_count);
+            for (size_t i = 0; i < m_row_count; ++i) column[i] = std::atoi(ReadCell(i, col));
+        }
+        return column[row];
+    }
+
+    // ԸȡԪÿһеһζȡʱн
+    double ReadDouble(size_t row, size_t col)
+    {
+        if (row >= m_row_count || col >= m_col_count) return 0;
+
+        auto& column = m_double_columns[col];
+        if (column.empty())
+        {
+            column.resize(m_row_count);
+            for (size_t i = 0; i < m_row_count; ++i) column[i] = std::atof(ReadCell(i, col));
+        }
+        return column[row];
+    }
+
     virtual const char* GetPath() const { return m_file_path.c_str(); }
-    virtual void Close() { m_data.clear(); }
+    virtual void Close() { Clear(); }
 
 public:
     // ĳһΪkeyĳһΪvalueĳһпʼȡֵ
     const std::string& GetKeyValueString(const std::string& key, const std::string& default_value, size_t start_row = 0, size_t key_col = 0, size_t value_col = 1)
     {
-        for (size_t row = start_row + 1; row < m_data.size(); ++row)
+        if (value_col < m_col_count)
         {
-            if (key_col >= m_data[row].size()) continue;
-            if (value_col >= m_data[row].size()) continue;
-
-            if (m_data[row][key_col] == key) return m_data[row][value_col];
+            const int row = FindRow(key, key_col, start_row);
+            if (row >= 0)
+            {
+                size_t size = 0;
+                const char* data = GetCell(row, value_col, size);
+                m_temp_string.assign(data, size);
+                return m_temp_string;
+            }
         }
 
         m_temp_string = default_value;
@@ -137,212 +404,360 @@ public:
     // ĳһΪkeyĳһΪvalueĳһпʼȡֵ
     int GetKeyValueInt(const std::string& key, int default_value, size_t start_row = 0, size_t key_col = 0, size_t value_col = 1)
     {
-        for (size_t row = start_row + 1; row < m_data.size(); ++row)
+        if (value_col < m_col_count)
         {
-            if (key_col >= m_data[row].size()) continue;
-            if (value_col >= m_data[row].size()) continue;
-
-            if (m_data[row][key_col] == key) return std::atoi(m_data[row][value_col].c_str());
+            const int row = FindRow(key, key_col, start_row);
+            if (row >= 0) return ReadInt(row, value_col);
         }
 
         return default_value;
     }
 
 private:
-    // ȡļи
-    void ReadFile(READ_FILE read_func, void* file, int max_row)
+    // keyֱõԪڴ
+    struct CarpCsvKey
+    {
+        CarpCsvKey(const char* d, size_t s) : data(d), size(s) {}
+        const char* data;
+        size_t size;
+
+        bool operator == (const CarpCsvKey& key) const { return size == key.size && memcmp(data, key.data, size) == 0; }
+    };
+    struct CarpCsvKeyHash
     {
-        // ȡһַ
-        char cur_char = CARP_CSV_END_OF_FILE;
-        size_t size = read_func(file, &cur_char, 1, 1);
-        if (size == 0) Throw("file is empty");
-        if (cur_char == 0) Throw("row(" + std::to_string(GetRowCount() + 1) + ") has char is 0");
-
-        // ȡһַ
-        char next_char = 0;
-        size = read_func(file, &next_char, 1, 1);
-        if (size == 0)
+        size_t operator()(const CarpCsvKey& key) const
         {
-            m_data.resize(1);
-            m_data[0].resize(1);
-            m_data[0][0].push_back(cur_char);
-            return;
+            // FNV-1a
+            size_t hash = 2166136261u;
+            for (size_t i = 0; i < key.size; ++i)
+            {
+                hash ^= static_cast<unsigned char>(key.data[i]);
+                hash *= 16777619u;
+            }
+            return hash;
         }
-        if (next_char == 0) Throw("row(" + std::to_string(GetRowCount() + 1) + ") has char is 0");
+    };
+    typedef std::unordered_map<CarpCsvKey, size_t, CarpCsvKeyHash> CarpCsvIndex;
 
-        // ǵǰǷ
-        bool in_quote = false;
+    // ȡھͽ
+    CarpCsvIndex& GetIndex(size_t key_col, size_t start_row)
+    {
+        auto& index = m_indexes[std::make_pair(key_col, start_row)];
+        if (!index.empty() || start_row + 1 >= m_row_count) return index;
+
+        index.reserve(m_row_count - start_row - 1);
+        for (size_t row = start_row + 1; row < m_row_count; ++row)
+        {
+            size_t size = 0;
+            const char* data = GetCell(row, key_col, size);
+            // ͬkeyֻһ
+            index.emplace(CarpCsvKey(data, size), row);
+        }
+        return index;
+    }
 
-        // ǰ
-        std::vector<std::string> row;
-        // ǰ
-        std::string cell;
+    void Clear()
+    {
+        m_mapping.Close();
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+        m_cells.clear();
+        m_cells.shrink_to_fit();
+        m_cell_ptr = nullptr;
+        m_buffer_ptr = nullptr;
+        m_rows.clear();
+        m_indexes.clear();
+        m_int_columns.clear();
+        m_double_columns.clear();
+        m_col_count = 0;
+        m_row_count = 0;
+    }
 
+private:
+    // ȡļڴ棬Ȼи
+    void ReadFile(READ_FILE read_func, void* file, size_t size_hint)
+    {
+        // ȡ
+        m_buffer.reserve(size_hint + 1);
+        size_t total = 0;
         while (true)
         {
-            // Ƿָ
-            if (cur_char == ',')
-            {
-                // УôҪӵǰַ
-                if (in_quote)
-                {
-                    // ӵ
-                    cell.push_back(cur_char);
+            const size_t block = size_hint > total ? size_hint - total : CARP_CSV_READ_BLOCK_SIZE;
+            m_buffer.resize(total + block);
+            const size_t size = read_func(file, m_buffer.data() + total, 1, block);
+            total += size;
+            if (size < block) break;
+        }
+        if (total >= 0xFFFFFFFF) Throw("file is too large");
+        // ĩβ0ΪһԪĽ
+        m_buffer.resize(total + 1);
+        m_buffer[total] = 0;
 
-                    // ûˣ˵ûйرţ
-                    if (next_char == CARP_CSV_END_OF_FILE) Throw("row(" + std::to_string(GetRowCount()) + ") have no close quote");
-                }
-                // ûУôҪи
-                else
-                {
-                    // ӵ
-                    row.push_back(std::move(cell));
+        Parse();
 
-                    // û
-                    if (next_char == CARP_CSV_END_OF_FILE)
-                    {
-                        // һ
-                        row.emplace_back(std::string());
-                        // ӵ
-                        AddRow(row);
-                    }
-                }
+        m_cell_ptr = m_cells.data();
+        m_buffer_ptr = m_buffer.data();
+    }
+
+    // иÿԪĽ滻Ϊ0ֱӷصԪڴ
+    void Parse()
+    {
+        char* data = m_buffer.data();
+        const size_t len = m_buffer.size() - 1;
+        if (len == 0) Throw("file is empty");
+
+        // ֻһַʱֱΪΨһĵԪ
+        if (len == 1)
+        {
+            if (data[0] == 0) Throw("row(1) has char is 0");
+            AddCell(0, 1, false);
+            EndRow();
+            return;
+        }
+
+        size_t pos = 0;
+        while (true)
+        {
+            const size_t cell_begin = pos;
+            bool quoted = false;
+
+            // ٲҷָк
+            pos += FindAny(data + pos, data + len, ',', '\n', '"', 0);
+            if (pos < len && data[pos] == 0) Throw("row(" + std::to_string(m_row_count + 1) + ") has char is 0");
+            // ţٴ
+            if (pos < len && data[pos] == '"')
+            {
+                quoted = true;
+                pos = ScanQuoted(cell_begin, pos);
             }
-            // ǻ
-            else if (cur_char == '\n')
+
+            // posָָлļβ
+            const char end_char = pos < len ? data[pos] : CARP_CSV_END_OF_FILE;
+            size_t cell_end = pos;
+            // ȥ\r\nе\r
+            if (end_char == '\n' && cell_end > cell_begin && data[cell_end - 1] == '\r') --cell_end;
+            AddCell(cell_begin, cell_end, quoted);
+
+            // ļ
+            if (end_char == CARP_CSV_END_OF_FILE)
             {
-                // УôҪӵǰַ
-                if (in_quote)
-                {
-                    // ӵ
-                    cell.push_back(cur_char);
+                EndRow();
+                break;
+            }
 
-                    // ûˣ˵ûйرţ
-                    if (next_char == CARP_CSV_END_OF_FILE) Throw("row(" + std::to_string(GetRowCount()) + ") have no close quote");
-                }
-                // ûУôҪи
-                else
+            ++pos;
+            if (end_char == ',')
+            {
+                // ûˣһ
+                if (pos >= len)
                 {
-                    // ӵ
-                    row.push_back(std::move(cell));
-                    // ӵ
-                    AddRow(row);
+                    AddCell(len, len, false);
+                    EndRow();
+                    break;
                 }
+                continue;
             }
-            // 
-            else if (cur_char == '"')
+
+            // 
+            EndRow();
+            if (pos >= len) break;
+        }
+    }
+
+    // ӵһſʼַصԪλ
+    size_t ScanQuoted(size_t cell_begin, size_t pos) const
+    {
+        const char* data = m_buffer.data();
+        const size_t len = m_buffer.size() - 1;
+
+        // ֮ǰַַͨ
+        bool has_content = pos > cell_begin;
+        bool in_quote = false;
+
+        while (true)
+        {
+            if (pos >= len)
+            {
+                // ûˣ˵ûйرţ
+                if (in_quote) Throw("row(" + std::to_string(m_row_count + 1) + ") have no close quote");
+                return len;
+            }
+
+            const char cur_char = data[pos];
+            if (cur_char == 0) Throw("row(" + std::to_string(m_row_count + 1) + ") has char is 0");
+
+            if (in_quote)
             {
-                // 
-                if (in_quote)
+                if (cur_char == '"')
                 {
                     // һҲţôǰֱתΪ
-                    if (next_char == '"')
+                    if (pos + 1 < len && data[pos + 1] == '"')
                     {
-                        // ӵ
-                        cell.push_back('"');
-                        // ֱӶȡһַ
-                        next_char = ReadNextChar(read_func, file);
-                        // ûˣ˵ûйرţ
-                        if (next_char == CARP_CSV_END_OF_FILE) Throw("row(" + std::to_string(GetRowCount()) + ") have no close quote");
+                        has_content = true;
+                        pos += 2;
                     }
                     // һţô͹ر
                     else
                     {
                         in_quote = false;
-
-                        if (next_char == CARP_CSV_END_OF_FILE)
-                        {
-                            // ӵ
-                            row.push_back(std::move(cell));
-                            // ӵ
-                            AddRow(row);
-                        }
+                        ++pos;
                     }
+                    continue;
                 }
-                // УֱӱΪ
+
+                // ڵֱַһ
+                has_content = true;
+                pos += FindAny(data + pos, data + len, '"', '"', '"', 0);
+                continue;
+            }
+
+            // Уָ߻оͽ
+            if (cur_char == ',' || cur_char == '\n') return pos;
+
+            if (cur_char == '"')
+            {
+                // ûˣ˵ûйرţ
+                if (pos + 1 >= len) Throw("row(" + std::to_string(m_row_count + 1) + ") have no close quote");
+                // ǰǿյģôͱſʼַͨ
+                if (!has_content)
+                    in_quote = true;
                 else
-                {
-                    // ǰǿյģôͱſʼ
-                    if (cell.empty())
-                        in_quote = true;
-                    // ǰѾˣôֱӵַͨ
-                    else
-                        cell.push_back(cur_char);
-                    
-                    // ûˣ˵ûйرţ
-                    if (next_char == CARP_CSV_END_OF_FILE) Throw("row(" + std::to_string(GetRowCount()) + ") have no close quote");
-                }
+                    has_content = true;
             }
-            // ֱַ
             else
+                has_content = true;
+            ++pos;
+        }
+    }
+
+    // ţֱдԭλãֻ
+    void Unquote(CarpCsvCell& cell)
+    {
+        const unsigned int out = UnquoteBuffer(m_buffer.data() + cell.offset, cell.size);
+        m_buffer[cell.offset + out] = 0;
+        cell.size = out;
+        cell.quoted = 0;
+    }
+
+    // dataԭؽţؽ֮ĳ
+    static unsigned int UnquoteBuffer(char* data, unsigned int size)
+    {
+        bool in_quote = false;
+        unsigned int out = 0;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            const char cur_char = data[i];
+            if (cur_char != '"')
             {
-                if (in_quote)
-                {
-                    // ַ
-                    cell.push_back(cur_char);
+                data[out++] = cur_char;
+                continue;
+            }
 
-                    // ûˣ˵ûйرţ
-                    if (next_char == CARP_CSV_END_OF_FILE) Throw("row(" + std::to_string(GetRowCount()) + ") have no close quote");
-                }
-                else
+            if (in_quote)
+            {
+                if (i + 1 < size && data[i + 1] == '"')
                 {
-                    // ӵ
-                    if (!(cur_char == '\r' && next_char == '\n')) cell.push_back(cur_char);
-
-                    // û
-                    if (next_char == CARP_CSV_END_OF_FILE)
-                    {
-                        // ӵ
-                        row.push_back(std::move(cell));
-                        // ӵ
-                        AddRow(row);
-                    }
+                    data[out++] = '"';
+                    ++i;
                 }
+                else
+                    in_quote = false;
             }
+            else
+            {
+                if (out == 0)
+                    in_quote = true;
+                else
+                    data[out++] = cur_char;
+            }
+        }
 
-            // û¸ַˣ˵
-            if (next_char == CARP_CSV_END_OF_FILE) break;
+        return out;
+    }
 
-            // ָô
-            if (max_row >= 0 && static_cast<int>(GetRowCount()) >= max_row) break;
+    // ӵԪ񣬲ѽλ滻Ϊ0
+    void AddCell(size_t begin, size_t end, bool quoted)
+    {
+        m_buffer[end] = 0;
 
-            // ȡһַ
-            cur_char = next_char;
-            next_char = ReadNextChar(read_func, file);
-        }
+        CarpCsvCell cell;
+        cell.offset = static_cast<unsigned int>(begin);
+        cell.size = static_cast<unsigned int>(end - begin);
+        cell.quoted = quoted ? 1 : 0;
+        m_cells.push_back(cell);
     }
-	
-    // ӵ
-    void AddRow(std::vector<std::string>& row)
+
+    // һ
+    void EndRow()
     {
-        const size_t col_count = GetColCount();
-        if (col_count == 0)
-        {
-            m_data.push_back(std::move(row));
-            return;
-        }
+        const size_t cell_count = m_cells.size() - m_row_count * m_col_count;
+        if (m_row_count == 0)
+            m_col_count = cell_count;
+        else if (cell_count != m_col_count)
+            Throw("row(" + std::to_string(m_row_count + 1) + ") col: " + std::to_string(cell_count) + " != " + std::to_string(m_col_count));
 
-        if (row.size() != col_count) Throw("row(" + std::to_string(GetRowCount() + 1) + ") col: " + std::to_string(row.size()) + " != " + std::to_string(col_count));
+        ++m_row_count;
+    }
 
-        m_data.push_back(std::move(row));
+    // ҵһa,b,c,dַƫƣҲend - begin
+    static size_t FindAny(const char* begin, const char* end, char a, char b, char c, char d)
+    {
+        const char* p = begin;
+#ifdef CARP_CSV_SSE2
+        const __m128i va = _mm_set1_epi8(a);
+        const __m128i vb = _mm_set1_epi8(b);
+        const __m128i vc = _mm_set1_epi8(c);
+        const __m128i vd = _mm_set1_epi8(d);
+        while (end - p >= 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb))
+                , _mm_or_si128(_mm_cmpeq_epi8(chunk, vc), _mm_cmpeq_epi8(chunk, vd)));
+            const int mask = _mm_movemask_epi8(match);
+            if (mask != 0) return (p - begin) + CountTrailingZero(static_cast<unsigned int>(mask));
+            p += 16;
+        }
+#endif
+        for (; p < end; ++p)
+        {
+            const char cur_char = *p;
+            if (cur_char == a || cur_char == b || cur_char == c || cur_char == d) break;
+        }
+        return p - begin;
     }
-	
-    // ȡļһַ
-    char ReadNextChar(READ_FILE read_func, void* file) const
+
+    static unsigned int CountTrailingZero(unsigned int value)
     {
-        char next_char = CARP_CSV_END_OF_FILE;
-        const size_t size = read_func(file, &next_char, 1, 1);
-        if (size != 0 && next_char == 0) Throw("row(" + std::to_string(GetRowCount()) + ") has char is 0");
-        return next_char;
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, value);
+        return index;
+#else
+        return __builtin_ctz(value);
+#endif
     }
-	
+
     // 쳣
     static void Throw(const std::string& error) { throw CarpCsvException(error); }
 
 private:
     std::string m_temp_string;
+    mutable std::vector<std::vector<std::string>> m_rows;   // GetRowDataɵУ
     std::string m_file_path;
-    std::vector<std::vector<std::string>> m_data;
+
+    std::vector<char> m_buffer;             // ļݣԪ0β
+    std::vector<CarpCsvCell> m_cells;       // еԪ񣬰д
+    size_t m_col_count = 0;
+    size_t m_row_count = 0;
+
+    // ָm_cellsm_bufferӿռʱָӳڴ
+    const CarpCsvCell* m_cell_ptr = nullptr;
+    const char* m_buffer_ptr = nullptr;
+    CarpFileMapping m_mapping;
+
+    std::map<std::pair<size_t, size_t>, CarpCsvIndex> m_indexes;        // key(key_col, start_row)
+    std::unordered_map<size_t, std::vector<int>> m_int_columns;         // л
+    std::unordered_map<size_t, std::vector<double>> m_double_columns;   // л
 };
 
-#endif
\ No newline at end of file
+#endif
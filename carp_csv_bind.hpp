@@ -19,6 +19,10 @@ public:
 			.addFunction("GetRowCount", &CarpCsv::GetRowCount)
 			.addFunction("Close", &CarpCsv::Close)
 			.addFunction("ReadCell", &CarpCsv::ReadCell)
+			.addFunction("ReadInt", &CarpCsv::ReadInt)
+			.addFunction("ReadDouble", &CarpCsv::ReadDouble)
+			.addFunction("FindRow", &CarpCsv::FindRow)
+			.addFunction("LoadWithSnapshot", &CarpCsv::LoadWithSnapshot)
 			.addFunction("GetPath", &CarpCsv::GetPath)
 			.endClass()
 			.endNamespace();
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <vector>
+#include <cstring>
 
 #include <sys/stat.h>
 
@@ -22,6 +23,7 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <sys/types.h>
+#include <sys/mman.h>
 #include <utime.h>
 #endif
 
@@ -340,4 +342,96 @@ public:
 #endif
 };
 
+// ֻڴӳļӳͬһļʱҳ
+class CarpFileMapping
+{
+public:
+	CarpFileMapping() {}
+	~CarpFileMapping() { Close(); }
+	CarpFileMapping(const CarpFileMapping&) = delete;
+	CarpFileMapping& operator = (const CarpFileMapping&) = delete;
+
+public:
+	// ӳļ
+	bool Open(const std::string& file_path)
+	{
+		Close();
+
+#ifdef _WIN32
+		m_file = CreateFileW(CarpFile::UTF82Unicode(file_path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (m_mapping == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (m_data == nullptr)
+		{
+			Close();
+			return false;
+		}
+		m_size = static_cast<size_t>(size.QuadPart);
+#else
+		const int fd = open(file_path.c_str(), O_RDONLY);
+		if (fd < 0) return false;
+
+		struct stat buffer;
+		if (fstat(fd, &buffer) != 0 || buffer.st_size == 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(buffer.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		// ӳ֮ļͲҪ
+		close(fd);
+		if (data == MAP_FAILED) return false;
+
+		m_data = static_cast<const char*>(data);
+		m_size = static_cast<size_t>(buffer.st_size);
+#endif
+		return true;
+	}
+
+	// رӳ
+	void Close()
+	{
+#ifdef _WIN32
+		if (m_data != nullptr) UnmapViewOfFile(m_data);
+		if (m_mapping != nullptr) CloseHandle(m_mapping);
+		if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		if (m_data != nullptr) munmap(const_cast<char*>(m_data), m_size);
+#endif
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	bool IsOpen() const { return m_data != nullptr; }
+	const char* GetData() const { return m_data; }
+	size_t GetSize() const { return m_size; }
+
+private:
+	const char* m_data = nullptr;	// ӳڴ
+	size_t m_size = 0;				// ļС
+
+#ifdef _WIN32
+	HANDLE m_file = INVALID_HANDLE_VALUE;
+	HANDLE m_mapping = nullptr;
+#endif
+};
+
 #endif
\ No newline at end of file
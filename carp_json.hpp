@@ -6,8 +6,12 @@
 #include <list>
 #include <map>
 #include <set>
+#include <cstring>
+#include <cstdlib>
+#include <climits>
 
 #include "rapidjson/include/rapidjson/prettywriter.h"
+#include "rapidjson/include/rapidjson/writer.h"
 #include "rapidjson/include/rapidjson/stringbuffer.h"
 #include "rapidjson/include/rapidjson/document.h"
 #include "rapidjson/include/rapidjson/rapidjson.h"
@@ -18,6 +22,375 @@ typedef rapidjson::Value CarpJsonValue;
 typedef rapidjson::Document::AllocatorType CarpJsonAlloc;
 typedef std::map<std::string, std::string> CarpJsonValueMap;
 typedef std::string  CARP_JSON_NAME;
+typedef rapidjson::Writer<rapidjson::StringBuffer> CarpJsonWriter;
+
+// ʽȡֱı˳ȡDOM
+// ȡʱͲƥֵʽжȡfalse
+class CarpJsonReader
+{
+public:
+	CarpJsonReader(const char* data, size_t len) : m_cur(data), m_end(data + len) {}
+
+public:
+	bool HasError() const { return m_error; }
+	const char* GetCursor() const { return m_cur; }
+
+	// һֵַ߶귵0
+	char Peek()
+	{
+		SkipSpace();
+		if (m_error || m_cur >= m_end) return 0;
+		return *m_cur;
+	}
+
+	// ʣಿֻпհ
+	bool Finish()
+	{
+		if (Peek() != 0) m_error = true;
+		return !m_error;
+	}
+
+public:
+	bool ReadBool(bool& out)
+	{
+		const char c = Peek();
+		if (c == 't') { if (!Literal("true", 4)) return false; out = true; return true; }
+		if (c == 'f') { if (!Literal("false", 5)) return false; out = false; return true; }
+		SkipValue();
+		return false;
+	}
+
+	template <typename T>
+	bool ReadNumber(T& out)
+	{
+		const char c = Peek();
+		if (c != '-' && (c < '0' || c > '9')) { SkipValue(); return false; }
+
+		long long i = 0;
+		unsigned long long u = 0;
+		double d = 0;
+		switch (ParseNumber(i, u, d))
+		{
+		case NUMBER_INT: out = (T)i; return true;
+		case NUMBER_UINT: out = (T)u; return true;
+		case NUMBER_DOUBLE: out = (T)d; return true;
+		default: return false;
+		}
+	}
+
+	bool ReadString(std::string& out)
+	{
+		if (Peek() != '"') { SkipValue(); return false; }
+
+		const char* text = nullptr;
+		size_t len = 0;
+		if (!ParseString(text, len, m_buffer)) return false;
+		out.assign(text, len);
+		return true;
+	}
+
+	// 󣬲ǶֵնҲfalse
+	bool StartObject() { return Start('{', '}'); }
+	// ȡðţֻ´ζȡ֮ǰЧ
+	bool ReadKey(const char*& key, int& key_len)
+	{
+		if (Peek() != '"') return Fail();
+
+		size_t len = 0;
+		if (!ParseString(key, len, m_key)) return false;
+		key_len = (int)len;
+
+		if (Peek() != ':') return Fail();
+		++m_cur;
+		return true;
+	}
+	// һԱ֮ãŷtrue}false
+	bool NextMember() { return Next('}'); }
+
+	// 飬ֵҲfalse
+	bool StartArray() { return Start('[', ']'); }
+	// һԪ֮ãŷtrue]false
+	bool NextElement() { return Next(']'); }
+
+	void SkipValue()
+	{
+		const char c = Peek();
+		if (c == '{')
+		{
+			if (!StartObject()) return;
+			const char* key = nullptr;
+			int key_len = 0;
+			do
+			{
+				if (!ReadKey(key, key_len)) return;
+				SkipValue();
+			} while (NextMember());
+		}
+		else if (c == '[')
+		{
+			if (!StartArray()) return;
+			do
+			{
+				SkipValue();
+			} while (NextElement());
+		}
+		else if (c == '"')
+		{
+			const char* text = nullptr;
+			size_t len = 0;
+			ParseString(text, len, m_buffer);
+		}
+		else if (c == 't') Literal("true", 4);
+		else if (c == 'f') Literal("false", 5);
+		else if (c == 'n') Literal("null", 4);
+		else if (c == '-' || (c >= '0' && c <= '9'))
+		{
+			long long i = 0;
+			unsigned long long u = 0;
+			double d = 0;
+			ParseNumber(i, u, d);
+		}
+		else
+		{
+			Fail();
+		}
+	}
+
+private:
+	enum NumberType
+	{
+		NUMBER_ERROR,
+		NUMBER_INT,
+		NUMBER_UINT,
+		NUMBER_DOUBLE,
+	};
+
+	bool Fail() { m_error = true; return false; }
+
+	void SkipSpace()
+	{
+		while (m_cur < m_end && (*m_cur == ' ' || *m_cur == '\n' || *m_cur == '\r' || *m_cur == '\t'))
+			++m_cur;
+	}
+
+	bool IsDigit() const { return m_cur < m_end && *m_cur >= '0' && *m_cur <= '9'; }
+
+	bool Literal(const char* text, int len)
+	{
+		if (m_end - m_cur < len || memcmp(m_cur, text, len) != 0) return Fail();
+		m_cur += len;
+		return true;
+	}
+
+	bool Start(char open, char close)
+	{
+		if (Peek() != open) { SkipValue(); return false; }
+		++m_cur;
+		if (Peek() != close) return !m_error;
+		++m_cur;
+		return false;
+	}
+
+	bool Next(char close)
+	{
+		const char c = Peek();
+		if (c == ',') { ++m_cur; return true; }
+		if (c == close) { ++m_cur; return false; }
+		return Fail();
+	}
+
+	// Ȱ64λߴСָİdouble
+	NumberType ParseNumber(long long& i, unsigned long long& u, double& d)
+	{
+		const char* begin = m_cur;
+		const bool minus = *m_cur == '-';
+		if (minus) ++m_cur;
+		if (!IsDigit()) { Fail(); return NUMBER_ERROR; }
+
+		unsigned long long value = 0;
+		bool is_double = false;
+		if (*m_cur == '0')
+		{
+			++m_cur;
+		}
+		else
+		{
+			while (IsDigit())
+			{
+				const unsigned int digit = *m_cur - '0';
+				if (value > (ULLONG_MAX - digit) / 10) is_double = true;
+				else value = value * 10 + digit;
+				++m_cur;
+			}
+		}
+		if (m_cur < m_end && *m_cur == '.')
+		{
+			++m_cur;
+			is_double = true;
+			if (!IsDigit()) { Fail(); return NUMBER_ERROR; }
+			while (IsDigit()) ++m_cur;
+		}
+		if (m_cur < m_end && (*m_cur == 'e' || *m_cur == 'E'))
+		{
+			++m_cur;
+			is_double = true;
+			if (m_cur < m_end && (*m_cur == '+' || *m_cur == '-')) ++m_cur;
+			if (!IsDigit()) { Fail(); return NUMBER_ERROR; }
+			while (IsDigit()) ++m_cur;
+		}
+
+		if (!is_double)
+		{
+			if (!minus)
+			{
+				u = value;
+				i = (long long)value;
+				return value <= (unsigned long long)LLONG_MAX ? NUMBER_INT : NUMBER_UINT;
+			}
+			if (value <= (unsigned long long)LLONG_MAX + 1)
+			{
+				i = (long long)(0 - value);
+				return NUMBER_INT;
+			}
+		}
+
+		// strtodҪ0βַ
+		char text[64];
+		const size_t len = m_cur - begin;
+		if (len < sizeof(text))
+		{
+			memcpy(text, begin, len);
+			text[len] = 0;
+			d = std::strtod(text, nullptr);
+		}
+		else
+		{
+			d = std::strtod(std::string(begin, len).c_str(), nullptr);
+		}
+		return NUMBER_DOUBLE;
+	}
+
+	bool ParseHex4(unsigned int& code)
+	{
+		if (m_end - m_cur < 4) return Fail();
+		code = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			const char c = *m_cur++;
+			code <<= 4;
+			if (c >= '0' && c <= '9') code += c - '0';
+			else if (c >= 'a' && c <= 'f') code += c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') code += c - 'A' + 10;
+			else return Fail();
+		}
+		return true;
+	}
+
+	static void AppendUTF8(std::string& out, unsigned int code)
+	{
+		if (code < 0x80)
+		{
+			out.push_back((char)code);
+		}
+		else if (code < 0x800)
+		{
+			out.push_back((char)(0xC0 | (code >> 6)));
+			out.push_back((char)(0x80 | (code & 0x3F)));
+		}
+		else if (code < 0x10000)
+		{
+			out.push_back((char)(0xE0 | (code >> 12)));
+			out.push_back((char)(0x80 | ((code >> 6) & 0x3F)));
+			out.push_back((char)(0x80 | (code & 0x3F)));
+		}
+		else
+		{
+			out.push_back((char)(0xF0 | (code >> 18)));
+			out.push_back((char)(0x80 | ((code >> 12) & 0x3F)));
+			out.push_back((char)(0x80 | ((code >> 6) & 0x3F)));
+			out.push_back((char)(0x80 | (code & 0x3F)));
+		}
+	}
+
+	// ûתַʱֱָı뵽buffer
+	bool ParseString(const char*& text, size_t& len, std::string& buffer)
+	{
+		++m_cur;
+		const char* begin = m_cur;
+		while (m_cur < m_end)
+		{
+			const unsigned char c = (unsigned char)*m_cur;
+			if (c == '"')
+			{
+				text = begin;
+				len = m_cur - begin;
+				++m_cur;
+				return true;
+			}
+			if (c == '\\') break;
+			if (c < 0x20) return Fail();
+			++m_cur;
+		}
+
+		buffer.assign(begin, m_cur);
+		while (m_cur < m_end)
+		{
+			const unsigned char c = (unsigned char)*m_cur++;
+			if (c == '"')
+			{
+				text = buffer.data();
+				len = buffer.size();
+				return true;
+			}
+			if (c < 0x20) return Fail();
+			if (c != '\\')
+			{
+				buffer.push_back((char)c);
+				continue;
+			}
+
+			if (m_cur >= m_end) return Fail();
+			switch (*m_cur++)
+			{
+			case '"': buffer.push_back('"'); break;
+			case '\\': buffer.push_back('\\'); break;
+			case '/': buffer.push_back('/'); break;
+			case 'b': buffer.push_back('\b'); break;
+			case 'f': buffer.push_back('\f'); break;
+			case 'n': buffer.push_back('\n'); break;
+			case 'r': buffer.push_back('\r'); break;
+			case 't': buffer.push_back('\t'); break;
+			case 'u':
+			{
+				unsigned int code = 0;
+				if (!ParseHex4(code)) return false;
+				// 
+				if (code >= 0xD800 && code <= 0xDBFF)
+				{
+					unsigned int low = 0;
+					if (m_end - m_cur < 2 || m_cur[0] != '\\' || m_cur[1] != 'u') return Fail();
+					m_cur += 2;
+					if (!ParseHex4(low)) return false;
+					if (low < 0xDC00 || low > 0xDFFF) return Fail();
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+				}
+				AppendUTF8(buffer, code);
+				break;
+			}
+			default: return Fail();
+			}
+		}
+		return Fail();
+	}
+
+private:
+	const char* m_cur = nullptr;
+	const char* m_end = nullptr;
+	bool m_error = false;
+
+	std::string m_key;			// תļ
+	std::string m_buffer;		// תַ
+};
 
 class CarpJson
 {
@@ -40,15 +413,39 @@ public:
     virtual void Deserialize(const CarpJsonValue& v) { }
     virtual void Serialize(CarpJsonValueMap& v) const { }
 	virtual void Deserialize(const CarpJsonValueMap& v) { }
-	virtual void WriteToString(std::string& out) const
+public:
+	// ʽлJSON_MACROɵֱдֶΣDOM
+	// дûʵ֣ͨDOMתһ
+	virtual void SerializeStream(CarpJsonWriter& w) const
 	{
 		rapidjson::Document v(rapidjson::kObjectType);
-		rapidjson::Document::AllocatorType &alloc = v.GetAllocator();
-		Serialize(v, alloc);
-		rapidjson::StringBuffer buffer;
-		rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-		v.Accept(writer);
-		out = buffer.GetString();
+		Serialize(v, v.GetAllocator());
+		v.Accept(w);
+	}
+	virtual void DeserializeStream(CarpJsonReader& r)
+	{
+		r.Peek();
+		const char* begin = r.GetCursor();
+		r.SkipValue();
+		if (r.HasError()) return;
+
+		rapidjson::Document doc;
+		doc.Parse<0>(begin, r.GetCursor() - begin);
+		if (doc.HasParseError()) return;
+		Deserialize(doc);
+	}
+	// лһֶΣfalseʾʶֶ
+	virtual bool DeserializeMember(const char* key, int key_len, CarpJsonReader& r) { return false; }
+public:
+	virtual void WriteToString(std::string& out) const
+	{
+		// д̸߳ãȶ֮ٷڴ
+		static thread_local rapidjson::StringBuffer buffer;
+		static thread_local CarpJsonWriter writer(buffer);
+		buffer.Clear();
+		writer.Reset(buffer);
+		SerializeStream(writer);
+		out.assign(buffer.GetString(), buffer.GetSize());
 	}
 	virtual bool ReadFromString(const std::string& in)
 	{
@@ -56,12 +453,13 @@ public:
 
         if (in.empty()) return true;
 
-		rapidjson::Document doc;
-		doc.Parse<0>(in.c_str());
+		CarpJsonReader reader(in.c_str(), in.size());
+		DeserializeStream(reader);
+		if (reader.Finish()) return true;
 
-		if (doc.HasParseError()) return false;
-		Deserialize(doc);
-		return true;
+		// DOMһ£ʽʱһ
+		Reset();
+		return false;
 	}
 	virtual std::string ToString() const
 	{
@@ -81,6 +479,8 @@ public:
 public:
     void Serialize(CarpJsonValue& v, CarpJsonAlloc& a) const override;
     void Deserialize(const CarpJsonValue& v) override;
+    void SerializeStream(CarpJsonWriter& w) const override;
+    void DeserializeStream(CarpJsonReader& r) override;
     void Reset() override { d.resize(0); }
     const std::vector<T>& Get() const { return d; }
 
@@ -862,13 +1262,10 @@ template <> static void Deserialize<double>(double& object, const char* name, in
 
 template <typename T> static void SerializeString(const T& object, std::string& s)
 {
-    rapidjson::Document v;
-    rapidjson::Document::AllocatorType &alloc = v.GetAllocator();
-    Serialize(object, nullptr, 0, v, alloc);
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    v.Accept(writer);
-    s = buffer.GetString();
+    CarpJsonWriter writer(buffer);
+    SerializeStream(object, writer);
+    s.assign(buffer.GetString(), buffer.GetSize());
 }
 template <typename T> static void SerializeString(const CarpOneSplitStringJson<T>& object, std::string& s)
 {
@@ -1030,6 +1427,220 @@ template <typename T> static void DeserializeValueMap(T& object, const char* nam
 		DeserializeString(object, it->second);
 }
 
+// ------------------------------------------------------------------------------------
+// ʽдDOMʽ͹򱣳һ
+
+// ֶϣ(FNV-1a)JSON_MACROɵڱcaseǩ
+// ͬһֶιϣͻᵼcaseظֱӱʱķַ
+static constexpr unsigned int HashName(const char* name, unsigned int hash = 2166136261u)
+{
+	return *name == 0 ? hash : HashName(name + 1, (hash ^ (unsigned char)*name) * 16777619u);
+}
+static unsigned int HashKey(const char* key, int key_len)
+{
+	unsigned int hash = 2166136261u;
+	for (int i = 0; i < key_len; ++i)
+		hash = (hash ^ (unsigned char)key[i]) * 16777619u;
+	return hash;
+}
+
+template <typename T> static void SerializeMember(const T& object, const char* name, int name_len, CarpJsonWriter& w)
+{
+	w.Key(name, (rapidjson::SizeType)name_len);
+	SerializeStream(object, w);
+}
+template <typename T> static void SerializeStream(const T& object, CarpJsonWriter& w)
+{
+	object.SerializeStream(w);
+}
+template <typename T> static void SerializeStream(const std::set<T>& object, CarpJsonWriter& w)
+{
+	w.StartArray();
+	for (auto it = object.begin(); it != object.end(); ++it)
+		SerializeStream(*it, w);
+	w.EndArray();
+}
+template <typename T> static void SerializeStream(const std::list<T>& object, CarpJsonWriter& w)
+{
+	w.StartArray();
+	for (auto it = object.begin(); it != object.end(); ++it)
+		SerializeStream(*it, w);
+	w.EndArray();
+}
+template <typename T> static void SerializeStream(const std::vector<T>& object, CarpJsonWriter& w)
+{
+	w.StartArray();
+	for (unsigned int i = 0; i < object.size(); ++i)
+		SerializeStream(object[i], w);
+	w.EndArray();
+}
+template <typename V> static void SerializeStream(const std::map<std::string, V>& object, CarpJsonWriter& w)
+{
+	w.StartObject();
+	for (auto it = object.begin(); it != object.end(); ++it)
+		SerializeMember(it->second, it->first.c_str(), (int)it->first.size(), w);
+	w.EndObject();
+}
+template <typename V> static void SerializeStream(const std::map<int, V>& object, CarpJsonWriter& w)
+{
+	w.StartObject();
+	char text[32] = { 0 };
+	for (auto it = object.begin(); it != object.end(); ++it) {
+#ifdef _WIN32
+		int len = sprintf_s(text, "%d", it->first);
+#else
+		int len = sprintf(text, "%d", it->first);
+#endif
+		SerializeMember(it->second, text, len, w);
+	}
+	w.EndObject();
+}
+template <typename V> static void SerializeStream(const std::map<unsigned int, V>& object, CarpJsonWriter& w)
+{
+	w.StartObject();
+	char text[32] = { 0 };
+	for (auto it = object.begin(); it != object.end(); ++it) {
+#ifdef _WIN32
+		int len = sprintf_s(text, "%u", it->first);
+#else
+		int len = sprintf(text, "%u", it->first);
+#endif
+		SerializeMember(it->second, text, len, w);
+	}
+	w.EndObject();
+}
+static void SerializeStream(const std::string& object, CarpJsonWriter& w) { w.String(object.c_str(), (rapidjson::SizeType)object.size()); }
+static void SerializeStream(const bool& object, CarpJsonWriter& w) { w.Bool(object); }
+static void SerializeStream(const char& object, CarpJsonWriter& w) { w.Int(object); }
+static void SerializeStream(const unsigned char& object, CarpJsonWriter& w) { w.Int(object); }
+static void SerializeStream(const short& object, CarpJsonWriter& w) { w.Int(object); }
+static void SerializeStream(const unsigned short& object, CarpJsonWriter& w) { w.Int(object); }
+static void SerializeStream(const int& object, CarpJsonWriter& w) { w.Int(object); }
+static void SerializeStream(const unsigned int& object, CarpJsonWriter& w) { w.Uint(object); }
+static void SerializeStream(const long& object, CarpJsonWriter& w) { w.Int((int)object); }
+static void SerializeStream(const unsigned long& object, CarpJsonWriter& w) { w.Uint((unsigned int)object); }
+static void SerializeStream(const long long& object, CarpJsonWriter& w) { w.Int64(object); }
+static void SerializeStream(const unsigned long long& object, CarpJsonWriter& w) { w.Uint64(object); }
+static void SerializeStream(const float& object, CarpJsonWriter& w) { w.Double(object); }
+static void SerializeStream(const double& object, CarpJsonWriter& w) { w.Double(object); }
+
+// ȡһ󣬰ֶַobject
+static void DeserializeObject(CarpJson& object, CarpJsonReader& r)
+{
+	if (!r.StartObject()) return;
+
+	const char* key = nullptr;
+	int key_len = 0;
+	do
+	{
+		if (!r.ReadKey(key, key_len)) return;
+		if (!object.DeserializeMember(key, key_len, r)) r.SkipValue();
+	} while (r.NextMember());
+}
+// ϣͬʱٱȽһ֣ⲻʶֶƥ
+template <typename T> static bool DeserializeMember(T& object, const char* name, int name_len, const char* key, int key_len, CarpJsonReader& r)
+{
+	if (name_len != key_len || memcmp(name, key, name_len) != 0) return false;
+	DeserializeStream(object, r);
+	return true;
+}
+template <typename T> static void DeserializeStream(T& object, CarpJsonReader& r)
+{
+	object.DeserializeStream(r);
+}
+template <typename T> static void DeserializeStream(std::set<T>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartArray()) return;
+	do
+	{
+		T data;
+		DeserializeStream(data, r);
+		object.insert(data);
+	} while (r.NextElement());
+}
+template <typename T> static void DeserializeStream(std::list<T>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartArray()) return;
+	do
+	{
+		object.push_back(T());
+		DeserializeStream(object.back(), r);
+	} while (r.NextElement());
+}
+template <typename T> static void DeserializeStream(std::vector<T>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartArray()) return;
+	do
+	{
+		object.emplace_back();
+		DeserializeStream(object.back(), r);
+	} while (r.NextElement());
+}
+template <typename V> static void DeserializeStream(std::map<std::string, V>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartObject()) return;
+
+	const char* key = nullptr;
+	int key_len = 0;
+	do
+	{
+		if (!r.ReadKey(key, key_len)) return;
+		V& data = object[std::string(key, key_len)] = V();
+		DeserializeStream(data, r);
+	} while (r.NextMember());
+}
+template <typename V> static void DeserializeStream(std::map<int, V>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartObject()) return;
+
+	const char* key = nullptr;
+	int key_len = 0;
+	do
+	{
+		if (!r.ReadKey(key, key_len)) return;
+		V& data = object[std::atoi(std::string(key, key_len).c_str())] = V();
+		DeserializeStream(data, r);
+	} while (r.NextMember());
+}
+template <typename V> static void DeserializeStream(std::map<unsigned int, V>& object, CarpJsonReader& r)
+{
+	object.clear();
+	if (!r.StartObject()) return;
+
+	const char* key = nullptr;
+	int key_len = 0;
+	do
+	{
+		if (!r.ReadKey(key, key_len)) return;
+		V& data = object[std::atoi(std::string(key, key_len).c_str())] = V();
+		DeserializeStream(data, r);
+	} while (r.NextMember());
+}
+template <typename T> static void DeserializeNumberStream(T& object, CarpJsonReader& r)
+{
+	object = T();
+	r.ReadNumber(object);
+}
+static void DeserializeStream(std::string& object, CarpJsonReader& r) { object.clear(); r.ReadString(object); }
+static void DeserializeStream(bool& object, CarpJsonReader& r) { object = bool(); r.ReadBool(object); }
+static void DeserializeStream(char& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(unsigned char& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(short& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(unsigned short& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(int& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(unsigned int& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(long& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(unsigned long& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(long long& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(unsigned long long& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(float& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+static void DeserializeStream(double& object, CarpJsonReader& r) { DeserializeNumberStream(object, r); }
+
 };
 
 template <typename T>
@@ -1055,6 +1666,18 @@ void CarpVectorArrayJson<T>::Deserialize(const CarpJsonValue& v)
         CarpJsonTemplate::Deserialize(d[i], nullptr, 0, v[i]);
 }
 
+template <typename T>
+void CarpVectorArrayJson<T>::SerializeStream(CarpJsonWriter& w) const
+{
+	CarpJsonTemplate::SerializeStream(d, w);
+}
+
+template <typename T>
+void CarpVectorArrayJson<T>::DeserializeStream(CarpJsonReader& r)
+{
+	CarpJsonTemplate::DeserializeStream(d, r);
+}
+
 template <typename J, char split>
 void CarpSplitStringJson<J, split>::WriteToString(std::string& out) const
 {
@@ -1137,6 +1760,8 @@ class Name : public CarpJson { \
 public: \
 	const char* GetID() const { return #Name; } \
 	inline static const char* GetStaticID() { return #Name; } \
+	void SerializeStream(CarpJsonWriter& w) const { w.StartObject(); w.EndObject(); } \
+	void DeserializeStream(CarpJsonReader& r) { r.SkipValue(); } \
 }
 
 #endif // _ALITTLE_JSON_H_
@@ -22,6 +22,19 @@ public: \
 	virtual void Deserialize(const CarpJsonValueMap& v) { \
 		CarpJsonTemplate::DeserializeValueMap(m0, #m0, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -61,6 +74,21 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m0, #m0, v); \
 		CarpJsonTemplate::DeserializeValueMap(m1, #m1, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -106,6 +134,23 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m1, #m1, v); \
 		CarpJsonTemplate::DeserializeValueMap(m2, #m2, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -157,6 +202,25 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m2, #m2, v); \
 		CarpJsonTemplate::DeserializeValueMap(m3, #m3, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -214,6 +278,27 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m3, #m3, v); \
 		CarpJsonTemplate::DeserializeValueMap(m4, #m4, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -277,6 +362,29 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m4, #m4, v); \
 		CarpJsonTemplate::DeserializeValueMap(m5, #m5, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -346,6 +454,31 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m5, #m5, v); \
 		CarpJsonTemplate::DeserializeValueMap(m6, #m6, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -421,6 +554,33 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m6, #m6, v); \
 		CarpJsonTemplate::DeserializeValueMap(m7, #m7, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -502,6 +662,35 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m7, #m7, v); \
 		CarpJsonTemplate::DeserializeValueMap(m8, #m8, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -589,6 +778,37 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m8, #m8, v); \
 		CarpJsonTemplate::DeserializeValueMap(m9, #m9, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -62,6 +62,39 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m9, #m9, v); \
 		CarpJsonTemplate::DeserializeValueMap(m10, #m10, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -161,6 +194,41 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m10, #m10, v); \
 		CarpJsonTemplate::DeserializeValueMap(m11, #m11, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -266,6 +334,43 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m11, #m11, v); \
 		CarpJsonTemplate::DeserializeValueMap(m12, #m12, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -377,6 +482,45 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m12, #m12, v); \
 		CarpJsonTemplate::DeserializeValueMap(m13, #m13, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -494,6 +638,47 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m13, #m13, v); \
 		CarpJsonTemplate::DeserializeValueMap(m14, #m14, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -617,6 +802,49 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m14, #m14, v); \
 		CarpJsonTemplate::DeserializeValueMap(m15, #m15, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -746,6 +974,51 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m15, #m15, v); \
 		CarpJsonTemplate::DeserializeValueMap(m16, #m16, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -881,6 +1154,53 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m16, #m16, v); \
 		CarpJsonTemplate::DeserializeValueMap(m17, #m17, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1022,6 +1342,55 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m17, #m17, v); \
 		CarpJsonTemplate::DeserializeValueMap(m18, #m18, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1169,6 +1538,57 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m18, #m18, v); \
 		CarpJsonTemplate::DeserializeValueMap(m19, #m19, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -102,6 +102,59 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m19, #m19, v); \
 		CarpJsonTemplate::DeserializeValueMap(m20, #m20, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -261,6 +314,61 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m20, #m20, v); \
 		CarpJsonTemplate::DeserializeValueMap(m21, #m21, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -426,6 +534,63 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m21, #m21, v); \
 		CarpJsonTemplate::DeserializeValueMap(m22, #m22, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -597,6 +762,65 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m22, #m22, v); \
 		CarpJsonTemplate::DeserializeValueMap(m23, #m23, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -774,6 +998,67 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m23, #m23, v); \
 		CarpJsonTemplate::DeserializeValueMap(m24, #m24, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -957,6 +1242,69 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m24, #m24, v); \
 		CarpJsonTemplate::DeserializeValueMap(m25, #m25, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1146,6 +1494,71 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m25, #m25, v); \
 		CarpJsonTemplate::DeserializeValueMap(m26, #m26, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1341,6 +1754,73 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m26, #m26, v); \
 		CarpJsonTemplate::DeserializeValueMap(m27, #m27, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1542,6 +2022,75 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m27, #m27, v); \
 		CarpJsonTemplate::DeserializeValueMap(m28, #m28, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1749,6 +2298,77 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m28, #m28, v); \
 		CarpJsonTemplate::DeserializeValueMap(m29, #m29, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
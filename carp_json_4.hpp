@@ -142,6 +142,79 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m29, #m29, v); \
 		CarpJsonTemplate::DeserializeValueMap(m30, #m30, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -361,6 +434,81 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m30, #m30, v); \
 		CarpJsonTemplate::DeserializeValueMap(m31, #m31, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -586,6 +734,83 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m31, #m31, v); \
 		CarpJsonTemplate::DeserializeValueMap(m32, #m32, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -817,6 +1042,85 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m32, #m32, v); \
 		CarpJsonTemplate::DeserializeValueMap(m33, #m33, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1054,6 +1358,87 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m33, #m33, v); \
 		CarpJsonTemplate::DeserializeValueMap(m34, #m34, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1297,6 +1682,89 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m34, #m34, v); \
 		CarpJsonTemplate::DeserializeValueMap(m35, #m35, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1546,6 +2014,91 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m35, #m35, v); \
 		CarpJsonTemplate::DeserializeValueMap(m36, #m36, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1801,6 +2354,93 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m36, #m36, v); \
 		CarpJsonTemplate::DeserializeValueMap(m37, #m37, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -2062,6 +2702,95 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m37, #m37, v); \
 		CarpJsonTemplate::DeserializeValueMap(m38, #m38, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -2329,6 +3058,97 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m38, #m38, v); \
 		CarpJsonTemplate::DeserializeValueMap(m39, #m39, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -222,6 +222,119 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m49, #m49, v); \
 		CarpJsonTemplate::DeserializeValueMap(m50, #m50, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -561,6 +674,121 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m50, #m50, v); \
 		CarpJsonTemplate::DeserializeValueMap(m51, #m51, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -906,6 +1134,123 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m51, #m51, v); \
 		CarpJsonTemplate::DeserializeValueMap(m52, #m52, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1257,6 +1602,125 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m52, #m52, v); \
 		CarpJsonTemplate::DeserializeValueMap(m53, #m53, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1614,6 +2078,127 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m53, #m53, v); \
 		CarpJsonTemplate::DeserializeValueMap(m54, #m54, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -1977,6 +2562,129 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m54, #m54, v); \
 		CarpJsonTemplate::DeserializeValueMap(m55, #m55, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m55, #m55, (int)sizeof(#m55)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m55): return CarpJsonTemplate::DeserializeMember(m55, #m55, (int)sizeof(#m55)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -2346,6 +3054,131 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m55, #m55, v); \
 		CarpJsonTemplate::DeserializeValueMap(m56, #m56, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m55, #m55, (int)sizeof(#m55)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m56, #m56, (int)sizeof(#m56)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m55): return CarpJsonTemplate::DeserializeMember(m55, #m55, (int)sizeof(#m55)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m56): return CarpJsonTemplate::DeserializeMember(m56, #m56, (int)sizeof(#m56)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -2721,6 +3554,133 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m56, #m56, v); \
 		CarpJsonTemplate::DeserializeValueMap(m57, #m57, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m55, #m55, (int)sizeof(#m55)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m56, #m56, (int)sizeof(#m56)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m57, #m57, (int)sizeof(#m57)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m55): return CarpJsonTemplate::DeserializeMember(m55, #m55, (int)sizeof(#m55)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m56): return CarpJsonTemplate::DeserializeMember(m56, #m56, (int)sizeof(#m56)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m57): return CarpJsonTemplate::DeserializeMember(m57, #m57, (int)sizeof(#m57)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -3102,6 +4062,135 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m57, #m57, v); \
 		CarpJsonTemplate::DeserializeValueMap(m58, #m58, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m55, #m55, (int)sizeof(#m55)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m56, #m56, (int)sizeof(#m56)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m57, #m57, (int)sizeof(#m57)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m58, #m58, (int)sizeof(#m58)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m55): return CarpJsonTemplate::DeserializeMember(m55, #m55, (int)sizeof(#m55)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m56): return CarpJsonTemplate::DeserializeMember(m56, #m56, (int)sizeof(#m56)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m57): return CarpJsonTemplate::DeserializeMember(m57, #m57, (int)sizeof(#m57)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m58): return CarpJsonTemplate::DeserializeMember(m58, #m58, (int)sizeof(#m58)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
@@ -3489,6 +4578,137 @@ public: \
 		CarpJsonTemplate::DeserializeValueMap(m58, #m58, v); \
 		CarpJsonTemplate::DeserializeValueMap(m59, #m59, v); \
 	} \
+	virtual void SerializeStream(CarpJsonWriter& json_writer) const { \
+		json_writer.StartObject(); \
+		CarpJsonTemplate::SerializeMember(m0, #m0, (int)sizeof(#m0)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m1, #m1, (int)sizeof(#m1)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m2, #m2, (int)sizeof(#m2)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m3, #m3, (int)sizeof(#m3)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m4, #m4, (int)sizeof(#m4)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m5, #m5, (int)sizeof(#m5)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m6, #m6, (int)sizeof(#m6)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m7, #m7, (int)sizeof(#m7)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m8, #m8, (int)sizeof(#m8)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m9, #m9, (int)sizeof(#m9)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m10, #m10, (int)sizeof(#m10)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m11, #m11, (int)sizeof(#m11)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m12, #m12, (int)sizeof(#m12)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m13, #m13, (int)sizeof(#m13)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m14, #m14, (int)sizeof(#m14)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m15, #m15, (int)sizeof(#m15)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m16, #m16, (int)sizeof(#m16)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m17, #m17, (int)sizeof(#m17)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m18, #m18, (int)sizeof(#m18)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m19, #m19, (int)sizeof(#m19)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m20, #m20, (int)sizeof(#m20)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m21, #m21, (int)sizeof(#m21)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m22, #m22, (int)sizeof(#m22)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m23, #m23, (int)sizeof(#m23)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m24, #m24, (int)sizeof(#m24)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m25, #m25, (int)sizeof(#m25)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m26, #m26, (int)sizeof(#m26)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m27, #m27, (int)sizeof(#m27)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m28, #m28, (int)sizeof(#m28)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m29, #m29, (int)sizeof(#m29)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m30, #m30, (int)sizeof(#m30)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m31, #m31, (int)sizeof(#m31)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m32, #m32, (int)sizeof(#m32)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m33, #m33, (int)sizeof(#m33)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m34, #m34, (int)sizeof(#m34)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m35, #m35, (int)sizeof(#m35)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m36, #m36, (int)sizeof(#m36)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m37, #m37, (int)sizeof(#m37)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m38, #m38, (int)sizeof(#m38)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m39, #m39, (int)sizeof(#m39)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m40, #m40, (int)sizeof(#m40)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m41, #m41, (int)sizeof(#m41)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m42, #m42, (int)sizeof(#m42)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m43, #m43, (int)sizeof(#m43)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m44, #m44, (int)sizeof(#m44)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m45, #m45, (int)sizeof(#m45)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m46, #m46, (int)sizeof(#m46)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m47, #m47, (int)sizeof(#m47)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m48, #m48, (int)sizeof(#m48)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m49, #m49, (int)sizeof(#m49)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m50, #m50, (int)sizeof(#m50)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m51, #m51, (int)sizeof(#m51)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m52, #m52, (int)sizeof(#m52)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m53, #m53, (int)sizeof(#m53)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m54, #m54, (int)sizeof(#m54)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m55, #m55, (int)sizeof(#m55)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m56, #m56, (int)sizeof(#m56)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m57, #m57, (int)sizeof(#m57)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m58, #m58, (int)sizeof(#m58)-1, json_writer); \
+		CarpJsonTemplate::SerializeMember(m59, #m59, (int)sizeof(#m59)-1, json_writer); \
+		json_writer.EndObject(); \
+	} \
+	virtual void DeserializeStream(CarpJsonReader& json_reader) { \
+		CarpJsonTemplate::DeserializeObject(*this, json_reader); \
+	} \
+	virtual bool DeserializeMember(const char* json_key, int json_key_len, CarpJsonReader& json_reader) { \
+		switch (CarpJsonTemplate::HashKey(json_key, json_key_len)) { \
+		case CarpJsonTemplate::HashName(#m0): return CarpJsonTemplate::DeserializeMember(m0, #m0, (int)sizeof(#m0)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m1): return CarpJsonTemplate::DeserializeMember(m1, #m1, (int)sizeof(#m1)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m2): return CarpJsonTemplate::DeserializeMember(m2, #m2, (int)sizeof(#m2)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m3): return CarpJsonTemplate::DeserializeMember(m3, #m3, (int)sizeof(#m3)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m4): return CarpJsonTemplate::DeserializeMember(m4, #m4, (int)sizeof(#m4)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m5): return CarpJsonTemplate::DeserializeMember(m5, #m5, (int)sizeof(#m5)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m6): return CarpJsonTemplate::DeserializeMember(m6, #m6, (int)sizeof(#m6)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m7): return CarpJsonTemplate::DeserializeMember(m7, #m7, (int)sizeof(#m7)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m8): return CarpJsonTemplate::DeserializeMember(m8, #m8, (int)sizeof(#m8)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m9): return CarpJsonTemplate::DeserializeMember(m9, #m9, (int)sizeof(#m9)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m10): return CarpJsonTemplate::DeserializeMember(m10, #m10, (int)sizeof(#m10)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m11): return CarpJsonTemplate::DeserializeMember(m11, #m11, (int)sizeof(#m11)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m12): return CarpJsonTemplate::DeserializeMember(m12, #m12, (int)sizeof(#m12)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m13): return CarpJsonTemplate::DeserializeMember(m13, #m13, (int)sizeof(#m13)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m14): return CarpJsonTemplate::DeserializeMember(m14, #m14, (int)sizeof(#m14)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m15): return CarpJsonTemplate::DeserializeMember(m15, #m15, (int)sizeof(#m15)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m16): return CarpJsonTemplate::DeserializeMember(m16, #m16, (int)sizeof(#m16)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m17): return CarpJsonTemplate::DeserializeMember(m17, #m17, (int)sizeof(#m17)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m18): return CarpJsonTemplate::DeserializeMember(m18, #m18, (int)sizeof(#m18)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m19): return CarpJsonTemplate::DeserializeMember(m19, #m19, (int)sizeof(#m19)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m20): return CarpJsonTemplate::DeserializeMember(m20, #m20, (int)sizeof(#m20)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m21): return CarpJsonTemplate::DeserializeMember(m21, #m21, (int)sizeof(#m21)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m22): return CarpJsonTemplate::DeserializeMember(m22, #m22, (int)sizeof(#m22)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m23): return CarpJsonTemplate::DeserializeMember(m23, #m23, (int)sizeof(#m23)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m24): return CarpJsonTemplate::DeserializeMember(m24, #m24, (int)sizeof(#m24)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m25): return CarpJsonTemplate::DeserializeMember(m25, #m25, (int)sizeof(#m25)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m26): return CarpJsonTemplate::DeserializeMember(m26, #m26, (int)sizeof(#m26)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m27): return CarpJsonTemplate::DeserializeMember(m27, #m27, (int)sizeof(#m27)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m28): return CarpJsonTemplate::DeserializeMember(m28, #m28, (int)sizeof(#m28)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m29): return CarpJsonTemplate::DeserializeMember(m29, #m29, (int)sizeof(#m29)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m30): return CarpJsonTemplate::DeserializeMember(m30, #m30, (int)sizeof(#m30)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m31): return CarpJsonTemplate::DeserializeMember(m31, #m31, (int)sizeof(#m31)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m32): return CarpJsonTemplate::DeserializeMember(m32, #m32, (int)sizeof(#m32)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m33): return CarpJsonTemplate::DeserializeMember(m33, #m33, (int)sizeof(#m33)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m34): return CarpJsonTemplate::DeserializeMember(m34, #m34, (int)sizeof(#m34)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m35): return CarpJsonTemplate::DeserializeMember(m35, #m35, (int)sizeof(#m35)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m36): return CarpJsonTemplate::DeserializeMember(m36, #m36, (int)sizeof(#m36)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m37): return CarpJsonTemplate::DeserializeMember(m37, #m37, (int)sizeof(#m37)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m38): return CarpJsonTemplate::DeserializeMember(m38, #m38, (int)sizeof(#m38)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m39): return CarpJsonTemplate::DeserializeMember(m39, #m39, (int)sizeof(#m39)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m40): return CarpJsonTemplate::DeserializeMember(m40, #m40, (int)sizeof(#m40)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m41): return CarpJsonTemplate::DeserializeMember(m41, #m41, (int)sizeof(#m41)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m42): return CarpJsonTemplate::DeserializeMember(m42, #m42, (int)sizeof(#m42)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m43): return CarpJsonTemplate::DeserializeMember(m43, #m43, (int)sizeof(#m43)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m44): return CarpJsonTemplate::DeserializeMember(m44, #m44, (int)sizeof(#m44)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m45): return CarpJsonTemplate::DeserializeMember(m45, #m45, (int)sizeof(#m45)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m46): return CarpJsonTemplate::DeserializeMember(m46, #m46, (int)sizeof(#m46)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m47): return CarpJsonTemplate::DeserializeMember(m47, #m47, (int)sizeof(#m47)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m48): return CarpJsonTemplate::DeserializeMember(m48, #m48, (int)sizeof(#m48)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m49): return CarpJsonTemplate::DeserializeMember(m49, #m49, (int)sizeof(#m49)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m50): return CarpJsonTemplate::DeserializeMember(m50, #m50, (int)sizeof(#m50)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m51): return CarpJsonTemplate::DeserializeMember(m51, #m51, (int)sizeof(#m51)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m52): return CarpJsonTemplate::DeserializeMember(m52, #m52, (int)sizeof(#m52)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m53): return CarpJsonTemplate::DeserializeMember(m53, #m53, (int)sizeof(#m53)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m54): return CarpJsonTemplate::DeserializeMember(m54, #m54, (int)sizeof(#m54)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m55): return CarpJsonTemplate::DeserializeMember(m55, #m55, (int)sizeof(#m55)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m56): return CarpJsonTemplate::DeserializeMember(m56, #m56, (int)sizeof(#m56)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m57): return CarpJsonTemplate::DeserializeMember(m57, #m57, (int)sizeof(#m57)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m58): return CarpJsonTemplate::DeserializeMember(m58, #m58, (int)sizeof(#m58)-1, json_key, json_key_len, json_reader); \
+		case CarpJsonTemplate::HashName(#m59): return CarpJsonTemplate::DeserializeMember(m59, #m59, (int)sizeof(#m59)-1, json_key, json_key_len, json_reader); \
+		} return false; \
+	} \
 	virtual const std::vector<std::string>& GetNameList() const { \
 		static std::vector<std::string> s_list; \
 		if (s_list.empty()) { \
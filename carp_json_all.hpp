@@ -24,4 +24,59 @@
 // typedef CARP_JSON_MACRO(CarpEmptyJson) CarpEmptyJson;
 // typedef CARP_JSON_MACRO(CarpResultJson, bool, result) CarpResultJson;
 
+/* eg. 30ֶεļ¼ԱDOMʽдλ:/
+typedef CARP_JSON_MACRO(BenchRecord
+	, int, f0, int, f1, int, f2, int, f3, int, f4, int, f5, int, f6, int, f7, int, f8, int, f9
+	, std::string, f10, std::string, f11, std::string, f12, std::string, f13, std::string, f14
+	, std::string, f15, std::string, f16, std::string, f17, std::string, f18, std::string, f19
+	, double, f20, double, f21, double, f22, double, f23, double, f24
+	, bool, f25, long long, f26, unsigned int, f27, std::vector<int>, f28, std::vector<std::string>, f29) BenchRecord;
+
+BenchRecord record;
+record.f10 = "account_name"; record.f20 = 3.1415926; record.f26 = 1234567890123LL;
+record.f28 = { 1, 2, 3, 4, 5 }; record.f29 = { "a", "b", "c" };
+
+const int count = 1000000;
+std::string text;
+record.WriteToString(text);
+
+long long start = CarpTime::GetCurMSTime();
+for (int i = 0; i < count; ++i)
+{
+	rapidjson::Document v(rapidjson::kObjectType);
+	record.Serialize(v, v.GetAllocator());
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+	v.Accept(writer);
+	text = buffer.GetString();
+}
+long long dom_write = CarpTime::GetCurMSTime() - start;
+
+start = CarpTime::GetCurMSTime();
+for (int i = 0; i < count; ++i)
+{
+	BenchRecord out;
+	rapidjson::Document doc;
+	doc.Parse<0>(text.c_str());
+	out.Deserialize(doc);
+}
+long long dom_read = CarpTime::GetCurMSTime() - start;
+
+start = CarpTime::GetCurMSTime();
+for (int i = 0; i < count; ++i) record.WriteToString(text);
+long long stream_write = CarpTime::GetCurMSTime() - start;
+
+start = CarpTime::GetCurMSTime();
+for (int i = 0; i < count; ++i)
+{
+	BenchRecord out;
+	out.ReadFromString(text);
+}
+long long stream_read = CarpTime::GetCurMSTime() - start;
+
+printf("dom write:%lld read:%lld, stream write:%lld read:%lld\n"
+	, count * 1000LL / (dom_write + 1), count * 1000LL / (dom_read + 1)
+	, count * 1000LL / (stream_write + 1), count * 1000LL / (stream_read + 1));
+*/
+
 #endif
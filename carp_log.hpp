@@ -3,10 +3,12 @@
 
 #include "carp_thread_consumer.hpp"
 #include "carp_time.hpp"
+#include "carp_log_file.hpp"
 
 #include <string>
 #include <sstream>
 #include <vector>
+#include <atomic>
 
 #ifdef __ANDROID__
 #include <android/log.h>
@@ -35,6 +37,26 @@ enum CarpLogLevel
 	CARP_LOG_LEVEL_SYSTEM	= 3,
 	CARP_LOG_LEVEL_DATABASE	= 4,
 	CARP_LOG_LEVEL_EVENT	= 5,
+	CARP_LOG_LEVEL_COUNT	= 6,
+};
+
+#include "carp_log_binary.hpp"
+
+// ־𿪹أλӦCarpLogLevelĬȫ
+// 緢汾رINFO: -DCARP_LOG_COMPILE_MASK=0x3E
+// رյļڱȥʽᱻֵ
+#ifndef CARP_LOG_COMPILE_MASK
+#define CARP_LOG_COMPILE_MASK 0x3F
+#endif
+#define CARP_LOG_COMPILE_ENABLED(level) (((CARP_LOG_COMPILE_MASK) >> (level)) & 1)
+
+// ÿ־õ״̬Ϊľ̬ʹ
+// ԱǳʼҪ̰߳ȫľ̬ʼ
+struct CarpLogLimit
+{
+	std::atomic<long long> window{ 0 };		// ǰͳƴڣλ
+	std::atomic<int> count{ 0 };			// ǰѾ
+	std::atomic<int> suppressed{ 0 };		// ûб
 };
 
 // ־Ϣṹ
@@ -48,12 +70,14 @@ class CarpLog : public CarpThreadConsumer<CarpLogInfo, 10000>
 {
 public:
 	// ־ļǰ׺
-	void Setup(const std::string& path, const std::string& name, bool print)
+	// config ļѹͱ
+	void Setup(const std::string& path, const std::string& name, bool print, const CarpLogRotateConfig& config = CarpLogRotateConfig())
 	{
 		// ļ
 		m_file_name = name;
 		m_file_path = path;
 		m_print = print;
+		m_log_file.Setup(path, name, config);
 
 #ifdef _WIN32
 		// ȡ̨
@@ -66,12 +90,98 @@ public:
 #endif
 	}
 
+	/* ־Setup֮
+	 * ֮CARP_FAST_*дļ(.blog)CarpLogBinaryDecoder::DecodeFileԭı
+	 * @param ring_size: ÿ̵߳ĻλСдʱ־
+	 * @param interval_ms: ̨߳дļļ
+	 */
+	void SetupBinary(size_t ring_size = 1024 * 1024, int interval_ms = 10)
+	{
+#ifndef __EMSCRIPTEN__
+		CarpLogBinary::PRINT_FUNC print;
+		if (m_print) print = [this](const std::string& content, short level) { Print(content, level); };
+		m_binary.Start(m_file_path, m_file_name, print, ring_size, interval_ms);
+#endif
+	}
+
+	// ־Ϊд
+	long long GetBinaryDroppedCount() const { return m_binary.GetDroppedCount(); }
+
+public:
+	// ʱ־𿪹أλӦCarpLogLevel
+	void SetLevelMask(int mask) { m_level_mask.store(mask, std::memory_order_relaxed); }
+	int GetLevelMask() const { return m_level_mask.load(std::memory_order_relaxed); }
+	void SetLevelEnable(short level, bool enable)
+	{
+		if (level < 0 || level >= CARP_LOG_LEVEL_COUNT) return;
+		if (enable) m_level_mask.fetch_or(1 << level, std::memory_order_relaxed);
+		else m_level_mask.fetch_and(~(1 << level), std::memory_order_relaxed);
+	}
+	// ΧļܿؿƣԭһINFO
+	bool IsLevelEnabled(short level) const
+	{
+		if (level < 0 || level >= CARP_LOG_LEVEL_COUNT) return true;
+		return ((m_level_mask.load(std::memory_order_relaxed) >> level) & 1) != 0;
+	}
+
+	// ÿõÿ0ʾ
+	// ֱӶ(ᱻֵ)һʱϱ
+	void SetRateLimit(int count_per_second) { m_rate_limit.store(count_per_second, std::memory_order_relaxed); }
+	int GetRateLimit() const { return m_rate_limit.load(std::memory_order_relaxed); }
+
+	// Ϊ
+	long long GetSuppressedCount(short level) const
+	{
+		if (level < 0 || level >= CARP_LOG_LEVEL_COUNT) return 0;
+		return m_suppressed[level].load(std::memory_order_relaxed);
+	}
+	long long GetSuppressedCount() const
+	{
+		long long total = 0;
+		for (auto& count : m_suppressed) total += count.load(std::memory_order_relaxed);
+		return total;
+	}
+
+	/* жϵõǷ־ãڲֵ֮ǰж
+	 * @param level: ־
+	 * @param limit: õ״̬
+	 * @param suppressed: trueʱϴ֮󱻶
+	 * @return Ƿ
+	 */
+	bool Pass(short level, CarpLogLimit& limit, int& suppressed)
+	{
+		if (!IsLevelEnabled(level)) return false;
+
+		const int rate = m_rate_limit.load(std::memory_order_relaxed);
+		if (rate > 0)
+		{
+			const long long now = CarpTime::GetCurTime();
+			long long window = limit.window.load(std::memory_order_relaxed);
+			if (window != now && limit.window.compare_exchange_strong(window, now, std::memory_order_relaxed))
+				limit.count.store(0, std::memory_order_relaxed);
+
+			if (limit.count.fetch_add(1, std::memory_order_relaxed) >= rate)
+			{
+				limit.suppressed.fetch_add(1, std::memory_order_relaxed);
+				if (level >= 0 && level < CARP_LOG_LEVEL_COUNT) m_suppressed[level].fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+		}
+
+		suppressed = limit.suppressed.exchange(0, std::memory_order_relaxed);
+		return true;
+	}
+
 private:
 	// ־ļǰ׺
 	std::string m_file_name;
 	std::string m_file_path;
 	bool m_print = true;
 
+	std::atomic<int> m_level_mask{ (1 << CARP_LOG_LEVEL_COUNT) - 1 };	// ʱ𿪹
+	std::atomic<int> m_rate_limit{ 0 };								// ÿõÿ
+	std::atomic<long long> m_suppressed[CARP_LOG_LEVEL_COUNT] = {};		// ÿ
+
 #ifdef _WIN32
 	static std::string UTF82ANSI(const std::string& utf8)
 	{
@@ -93,6 +203,9 @@ public:
 	// content ʾ־
 	void Log(const char* content, short level)
 	{
+		// 𱻹رֱӷ
+		if (!IsLevelEnabled(level)) return;
+
 		// δֱӷ
 		if (!IsStart())
 		{
@@ -123,105 +236,101 @@ public:
 		Add(log);
 	}
 
+	// ʽ־{}ʾ
+	// ־ʱֻ¼ԭʼڵǰ̸߳ʽ֮Log
+	template <typename... Args>
+	void LogFast(CarpLogSite& site, const char* fmt, const Args&... args)
+	{
+		if (!IsLevelEnabled(site.level)) return;
+
+		if (m_binary.IsStart())
+		{
+			m_binary.Log(site, fmt, args...);
+			return;
+		}
+
+		char buffer[CARP_LOG_BINARY_RECORD_MAX];
+		CarpLogArgWriter writer(buffer, sizeof(buffer));
+		writer.AddAll(args...);
+		std::string content;
+		CarpLogBinaryDecoder::Expand(content, site.level, site.file, site.function, site.line, fmt, buffer, writer.GetSize());
+		Log(content.c_str(), site.level);
+	}
+
+	// ʽ־õ㱻
+	void LogSuppressed(const CarpLogSite& site, int suppressed)
+	{
+		static CarpLogSite s_site(CARP_LOG_LEVEL_WARN, __FILE__, __FUNCTION__, __LINE__);
+		LogFast(s_site, "{}:{} repeated {} times", site.file, site.line, suppressed);
+	}
+
 	// ر־ϵͳ
 	void Shutdown()
 	{
+		// ȹرն־ʣļ¼д
+		m_binary.Stop();
+
 		// ر
 		Stop();
 
 		// رļ
-		if (m_file)
-		{
-			fclose(m_file);
-			m_file = nullptr;
-		}
+		m_log_file.Close();
 	}
 
 protected:
 	// ִ־
 	virtual void Execute(CarpLogInfo& info) override
 	{
-		// ȡڵʱ
-		time_t cur_time = time(0);
-		// ǲǵڶ
-		if (cur_time - m_cur_day >= 60 * 60 * 24)
-		{
-			if (m_file != nullptr)
-			{
-				fclose(m_file);
-				m_file = nullptr;
-			}
-
-			std::string YMD, HMS;
-			CarpTime::FormatTime(cur_time, &YMD, '-', &HMS, '-');
+		// д뵽ļѹCarpLogFile洦
+		if (!m_log_file.Write(info.content.data(), info.content.size(), time(0))) return;
 
-			// һµļ
-			std::string file_path;
-			file_path.append(m_file_path).append(m_file_name).append("_").append(YMD).append("_").append(HMS).append(".log");
-#ifdef _WIN32
-			// ⲻʹfopen_sΪռļ
-			// ־ļرյʱ޷򿪲鿴Ҳ޷
-#pragma warning(push)  
-#pragma warning(disable:4996)
-			m_file = fopen(UTF82ANSI(file_path).c_str(), "a");
-#pragma warning(pop)
-#else
-			m_file = fopen(file_path.c_str(), "a");
-#endif
-
-			if (m_file == nullptr)
-				printf("log file open failed:%s\n", file_path.c_str());
-
-			// ʱ0㱣
-			m_cur_day = CarpTime::CalcTodayBeginTime(cur_time);
-		}
+		// ӡ̨
+		if (m_print) Print(info.content, info.level);
+	}
 
-		if (m_file == nullptr) return;
-		// д뵽ļ
-		std::fwrite(info.content.data(), 1, info.content.size(), m_file);
+	void Flush() override
+	{
+		m_log_file.Flush();
+	}
 
-		// ӡ̨
-		if (m_print)
-		{
-			// ÿ̨ɫ
+	// ӡ̨
+	void Print(const std::string& content, short level)
+	{
+		// ÿ̨ɫ
 #ifdef _WIN32
-			if (info.level == CARP_LOG_LEVEL_INFO)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_INFO);
-			else if (info.level == CARP_LOG_LEVEL_WARN)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_WARN);
-			else if (info.level == CARP_LOG_LEVEL_ERROR)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_ERROR);
-			else if (info.level == CARP_LOG_LEVEL_SYSTEM)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_SYSTEM);
-			else if (info.level == CARP_LOG_LEVEL_DATABASE)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_DATABASE);
-			else if (info.level == CARP_LOG_LEVEL_EVENT)
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_EVENT);
-			else
-				SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_INFO);
-			printf("%s", UTF82ANSI(info.content).c_str());
-			SetConsoleTextAttribute(m_out, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+		if (level == CARP_LOG_LEVEL_INFO)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_INFO);
+		else if (level == CARP_LOG_LEVEL_WARN)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_WARN);
+		else if (level == CARP_LOG_LEVEL_ERROR)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_ERROR);
+		else if (level == CARP_LOG_LEVEL_SYSTEM)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_SYSTEM);
+		else if (level == CARP_LOG_LEVEL_DATABASE)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_DATABASE);
+		else if (level == CARP_LOG_LEVEL_EVENT)
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_EVENT);
+		else
+			SetConsoleTextAttribute(m_out, CARP_LOG_COLOR_INFO);
+		printf("%s", UTF82ANSI(content).c_str());
+		SetConsoleTextAttribute(m_out, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
 #elif __ANDROID__
-			if (info.level == CARP_LOG_LEVEL_ERROR)
-				__android_log_write(ANDROID_LOG_ERROR, "SDL", info.content.c_str());
-			else if (info.level == CARP_LOG_LEVEL_WARN)
-				__android_log_write(ANDROID_LOG_WARN, "SDL", info.content.c_str());
-			else
-				__android_log_write(ANDROID_LOG_INFO, "SDL", info.content.c_str());
+		if (level == CARP_LOG_LEVEL_ERROR)
+			__android_log_write(ANDROID_LOG_ERROR, "SDL", content.c_str());
+		else if (level == CARP_LOG_LEVEL_WARN)
+			__android_log_write(ANDROID_LOG_WARN, "SDL", content.c_str());
+		else
+			__android_log_write(ANDROID_LOG_INFO, "SDL", content.c_str());
 #else
-			printf("%s", info.content.c_str());
+		printf("%s", content.c_str());
 #endif
-		}
 	}
 
-	void Flush() override
-	{
-		if (m_file) std::fflush(m_file);
-	}
+private:
+	CarpLogBinary m_binary;			// ־
 
 private:
-	FILE* m_file = nullptr;			// ־ļ
-	time_t m_cur_day = 0;		// 0ʱ
+	CarpLogFile m_log_file;			// ־ļ
 
 #ifdef _WIN32
 	HANDLE m_out = nullptr;		// ̨
@@ -230,20 +339,41 @@ private:
 
 extern CarpLog s_carp_log;
 
+// ־ǰжϣرջ߱ʱֱĲᱻֵ
+// ڹرյļ֧ᱻȥ
+#define CARP_LOG_PASS(level) \
+	if (!CARP_LOG_COMPILE_ENABLED(level)) break; \
+	static CarpLogLimit carp_log_limit; int carp_log_suppressed = 0; \
+	if (!s_carp_log.Pass(level, carp_log_limit, carp_log_suppressed)) break;
+// ׷ӵ־
+#define CARP_LOG_SUPPRESSED(stream) if (carp_log_suppressed > 0) stream << " (repeated " << carp_log_suppressed << " times)";
+#define CARP_LOG_TEXT(level, prefix) do{ CARP_LOG_PASS(level) std::ostringstream astream; astream << prefix; CARP_LOG_SUPPRESSED(astream) s_carp_log.Log(astream.str().c_str(), level); }while(0)
+
 // صĴڷǳģû뵽
-#define CARP_ERROR(text) do{ std::ostringstream astream; astream << "ERROR:" << __FILE__ << ":"<< __FUNCTION__ << "() " << __LINE__ << ":" << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_ERROR); }while(0)
+#define CARP_ERROR(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_ERROR, "ERROR:" << __FILE__ << ":"<< __FUNCTION__ << "() " << __LINE__ << ":" << text)
 // ϵͳĴִԤ֪ģѾϵͳ̹滮֮ڣҲ޹ؽҪ־
-#define CARP_SYSTEM(text) do{ std::ostringstream astream; astream << "SYSTEM:" << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_SYSTEM); }while(0)
+#define CARP_SYSTEM(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_SYSTEM, "SYSTEM:" << text)
 // ݿش
-#define CARP_DATABASE(text) do{ std::ostringstream astream; astream << "DATABASE:" << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_DATABASE); }while(0)
+#define CARP_DATABASE(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_DATABASE, "DATABASE:" << text)
 // ¼
-#define CARP_EVENT(text) do{ std::ostringstream astream; astream << "EVENT:" << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_EVENT); }while(0)
+#define CARP_EVENT(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_EVENT, "EVENT:" << text)
 // 棬縺غܸˣѹܴ
-#define CARP_WARN(text) do{ std::ostringstream astream; astream << "WARN:" << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_WARN); }while(0)
+#define CARP_WARN(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_WARN, "WARN:" << text)
 // ĵԴӡ
-#define CARP_INFO(text) do{ std::ostringstream astream; astream << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_INFO); }while(0)
+#define CARP_INFO(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_INFO, text)
 // صĴڷǳģû뵽ģṩűϵͳʹ
-#define CARP_SCRIPT_ERROR(text) do{ std::ostringstream astream; astream << text; s_carp_log.Log(astream.str().c_str(), CARP_LOG_LEVEL_ERROR); }while(0)
+#define CARP_SCRIPT_ERROR(text) CARP_LOG_TEXT(CARP_LOG_LEVEL_ERROR, text)
+
+// ʽ־÷ CARP_FAST_INFO("user {} login from {}", account_id, ip)
+// ־֮󣬵ֻ߳дԭʼʽƳٵ̨̻߽߳
+#define CARP_FAST_LOG(level, ...) do{ CARP_LOG_PASS(level) static CarpLogSite carp_log_site(level, __FILE__, __FUNCTION__, __LINE__); \
+	if (carp_log_suppressed > 0) s_carp_log.LogSuppressed(carp_log_site, carp_log_suppressed); s_carp_log.LogFast(carp_log_site, __VA_ARGS__); }while(0)
+#define CARP_FAST_ERROR(...) CARP_FAST_LOG(CARP_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define CARP_FAST_SYSTEM(...) CARP_FAST_LOG(CARP_LOG_LEVEL_SYSTEM, __VA_ARGS__)
+#define CARP_FAST_DATABASE(...) CARP_FAST_LOG(CARP_LOG_LEVEL_DATABASE, __VA_ARGS__)
+#define CARP_FAST_EVENT(...) CARP_FAST_LOG(CARP_LOG_LEVEL_EVENT, __VA_ARGS__)
+#define CARP_FAST_WARN(...) CARP_FAST_LOG(CARP_LOG_LEVEL_WARN, __VA_ARGS__)
+#define CARP_FAST_INFO(...) CARP_FAST_LOG(CARP_LOG_LEVEL_INFO, __VA_ARGS__)
 
 #define VA_CARP_LOG_CHECK_EXPAND(...)      __VA_ARGS__
 
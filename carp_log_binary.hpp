@@ -0,0 +1,811 @@
+#ifndef CARP_LOG_BINARY_INCLUDED
+#define CARP_LOG_BINARY_INCLUDED
+
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+
+#include "carp_time.hpp"
+
+// ־carp_log.hpp
+// ֻ߳Ѹʽidʱԭʼд߳˽еĻλʽҲڴ
+// ̶̨߳ʱлļ¼дļıCarpLogBinaryDecoder߻ԭ
+
+// ¼󳤶ȣַֻᱻض
+#define CARP_LOG_BINARY_RECORD_MAX 4096
+// ־ļͷ
+#define CARP_LOG_BINARY_MAGIC "CARPLOG1"
+#define CARP_LOG_BINARY_MAGIC_LEN 8
+
+// ¼ͣͨ־¼;Ǹʽid
+#define CARP_LOG_BINARY_RECORD_PAD 0xFFFFFFFFu			// λβ
+#define CARP_LOG_BINARY_RECORD_FORMAT 0xFFFFFFFEu		// ʽ
+
+enum CarpLogArgType
+{
+	CARP_LOG_ARG_END = 0,
+	CARP_LOG_ARG_BOOL = 1,
+	CARP_LOG_ARG_CHAR = 2,
+	CARP_LOG_ARG_INT = 3,
+	CARP_LOG_ARG_UINT = 4,
+	CARP_LOG_ARG_DOUBLE = 5,
+	CARP_LOG_ARG_STRING = 6,
+};
+
+// ¼ͷsize¼ͷҰ8ֽڶ
+struct CarpLogRecordHead
+{
+	unsigned int size;
+	unsigned int id;
+};
+
+// ־õ㣬ں涨Ϊ̬һд־ʱעʽ
+struct CarpLogSite
+{
+	CarpLogSite(short l, const char* f, const char* fn, int ln) : level(l), file(f), function(fn), line(ln) {}
+
+	short level;
+	const char* file;
+	const char* function;
+	int line;
+	std::atomic<int> id{ -1 };
+};
+
+// Ѳ뵽̶СĻ
+// ˲ʶҪͨostreamתַͶڴ
+class CarpLogArgWriter
+{
+public:
+	CarpLogArgWriter(char* buffer, size_t size) : m_begin(buffer), m_cur(buffer), m_end(buffer + size) {}
+
+	size_t GetSize() const { return m_cur - m_begin; }
+
+	template <typename... Args>
+	void AddAll(const Args&... args)
+	{
+		int dummy[] = { 0, (Add(args), 0)... };
+		(void)dummy;
+	}
+
+	void AddTime(long long time_us) { Put(&time_us, sizeof(time_us)); }
+
+public:
+	void Add(bool value) { char v = value ? 1 : 0; PutArg(CARP_LOG_ARG_BOOL, &v, sizeof(v)); }
+	void Add(char value) { PutArg(CARP_LOG_ARG_CHAR, &value, sizeof(value)); }
+	void Add(signed char value) { PutArg(CARP_LOG_ARG_CHAR, &value, sizeof(value)); }
+	void Add(unsigned char value) { PutArg(CARP_LOG_ARG_CHAR, &value, sizeof(value)); }
+	void Add(short value) { AddInt(value); }
+	void Add(int value) { AddInt(value); }
+	void Add(long value) { AddInt(value); }
+	void Add(long long value) { AddInt(value); }
+	void Add(unsigned short value) { AddUInt(value); }
+	void Add(unsigned int value) { AddUInt(value); }
+	void Add(unsigned long value) { AddUInt(value); }
+	void Add(unsigned long long value) { AddUInt(value); }
+	void Add(float value) { AddDouble(value); }
+	void Add(double value) { AddDouble(value); }
+	void Add(long double value) { AddDouble((double)value); }
+	void Add(const char* value) { if (value == nullptr) value = "(null)"; AddString(value, strlen(value)); }
+	void Add(char* value) { Add((const char*)value); }
+	void Add(const std::string& value) { AddString(value.data(), value.size()); }
+	template <typename T>
+	void Add(const T& value)
+	{
+		std::ostringstream stream;
+		stream << value;
+		const std::string text = stream.str();
+		AddString(text.data(), text.size());
+	}
+
+private:
+	void AddInt(long long value) { PutArg(CARP_LOG_ARG_INT, &value, sizeof(value)); }
+	void AddUInt(unsigned long long value) { PutArg(CARP_LOG_ARG_UINT, &value, sizeof(value)); }
+	void AddDouble(double value) { PutArg(CARP_LOG_ARG_DOUBLE, &value, sizeof(value)); }
+
+	void AddString(const char* value, size_t len)
+	{
+		// 1ֽڣ2ֽ
+		if (m_end - m_cur < 3) return;
+		const size_t left = m_end - m_cur - 3;
+		if (len > left) len = left;
+		if (len > 0xFFFF) len = 0xFFFF;
+		const unsigned short len16 = (unsigned short)len;
+		*m_cur++ = CARP_LOG_ARG_STRING;
+		Put(&len16, sizeof(len16));
+		Put(value, len);
+	}
+
+	void PutArg(char type, const void* data, size_t len)
+	{
+		if ((size_t)(m_end - m_cur) < len + 1) return;
+		*m_cur++ = type;
+		Put(data, len);
+	}
+
+	void Put(const void* data, size_t len)
+	{
+		if ((size_t)(m_end - m_cur) < len) return;
+		memcpy(m_cur, data, len);
+		m_cur += len;
+	}
+
+private:
+	char* m_begin;
+	char* m_cur;
+	char* m_end;
+};
+
+// ߵߵĻλ¼ڴģβŲʱ¼
+class CarpLogRing
+{
+public:
+	explicit CarpLogRing(size_t capacity)
+	{
+		// ȡ2ݣλÿһֱʱҲ
+		size_t size = 64 * 1024;
+		while (size < capacity) size <<= 1;
+		m_buffer.resize(size);
+	}
+
+public:
+	size_t GetCapacity() const { return m_buffer.size(); }
+	size_t GetUsed() const { return m_write.load(std::memory_order_relaxed) - m_read.load(std::memory_order_relaxed); }
+	bool IsEmpty() const { return GetUsed() == 0; }
+
+	// ̵߳ãд˾Ͷ
+	bool Write(unsigned int id, const char* data, size_t len)
+	{
+		const size_t capacity = m_buffer.size();
+		const size_t size = (sizeof(CarpLogRecordHead) + len + 7) & ~(size_t)7;
+
+		const size_t write = m_write.load(std::memory_order_relaxed);
+		const size_t read = m_read.load(std::memory_order_acquire);
+		size_t offset = write & (capacity - 1);
+		const size_t tail = capacity - offset;
+		const size_t need = tail < size ? tail + size : size;
+		if (write - read + need > capacity)
+		{
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		if (tail < size)
+		{
+			CarpLogRecordHead pad;
+			pad.size = (unsigned int)tail;
+			pad.id = CARP_LOG_BINARY_RECORD_PAD;
+			memcpy(m_buffer.data() + offset, &pad, sizeof(pad));
+			offset = 0;
+		}
+
+		CarpLogRecordHead head;
+		head.size = (unsigned int)size;
+		head.id = id;
+		char* dst = m_buffer.data() + offset;
+		memcpy(dst, &head, sizeof(head));
+		memcpy(dst + sizeof(head), data, len);
+		// 벿0ʱΪ0ͽ
+		memset(dst + sizeof(head) + len, 0, size - sizeof(head) - len);
+
+		m_write.store(write + need, std::memory_order_release);
+		return true;
+	}
+
+	// ̵߳ãǰеļ¼
+	template <typename F>
+	void Read(F func)
+	{
+		const size_t capacity = m_buffer.size();
+		size_t read = m_read.load(std::memory_order_relaxed);
+		const size_t write = m_write.load(std::memory_order_acquire);
+		while (read < write)
+		{
+			const char* src = m_buffer.data() + (read & (capacity - 1));
+			CarpLogRecordHead head;
+			memcpy(&head, src, sizeof(head));
+			if (head.id != CARP_LOG_BINARY_RECORD_PAD) func(head, src);
+			read += head.size;
+		}
+		m_read.store(read, std::memory_order_release);
+	}
+
+	unsigned int TakeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+	void Close() { m_closed = true; }
+	bool IsClosed() const { return m_closed; }
+
+private:
+	std::vector<char> m_buffer;
+	std::atomic<size_t> m_write{ 0 };
+	std::atomic<size_t> m_read{ 0 };
+	std::atomic<unsigned int> m_dropped{ 0 };
+	std::atomic<bool> m_closed{ false };
+};
+
+// ־ԭı
+class CarpLogBinaryDecoder
+{
+public:
+	/* ݸʽͱĲ־ݣʱͻ
+	 * ʽ{}ʾ{{}}ʾţǰ׺CARP_ERRORȺ걣һ
+	 */
+	static void Expand(std::string& out, short level, const char* file, const char* function, int line
+		, const char* fmt, const char* args, size_t args_len)
+	{
+		char text[64];
+		switch (level)
+		{
+		case CARP_LOG_LEVEL_ERROR:
+			out.append("ERROR:").append(file).append(":").append(function).append("() ");
+#ifdef _WIN32
+			sprintf_s(text, "%d:", line);
+#else
+			sprintf(text, "%d:", line);
+#endif
+			out.append(text);
+			break;
+		case CARP_LOG_LEVEL_WARN: out.append("WARN:"); break;
+		case CARP_LOG_LEVEL_SYSTEM: out.append("SYSTEM:"); break;
+		case CARP_LOG_LEVEL_DATABASE: out.append("DATABASE:"); break;
+		case CARP_LOG_LEVEL_EVENT: out.append("EVENT:"); break;
+		default: break;
+		}
+
+		const char* cur = args;
+		const char* end = args + args_len;
+		for (const char* p = fmt; *p != 0; ++p)
+		{
+			if (p[0] == '{' && p[1] == '{') { out.push_back('{'); ++p; continue; }
+			if (p[0] == '}' && p[1] == '}') { out.push_back('}'); ++p; continue; }
+			if (p[0] == '{' && p[1] == '}' && AppendArg(out, cur, end)) { ++p; continue; }
+			out.push_back(*p);
+		}
+	}
+
+	/* һ¼
+	 * @param head: ¼ͷ
+	 * @param data: ¼ͷ¼ͷ
+	 * @param out: ͨ־ں׷һı
+	 * @return ¼ʽ󷵻false
+	 */
+	bool Decode(const CarpLogRecordHead& head, const char* data, std::string& out)
+	{
+		const char* cur = data + sizeof(CarpLogRecordHead);
+		const char* end = data + head.size;
+
+		if (head.id == CARP_LOG_BINARY_RECORD_PAD) return true;
+		if (head.id == CARP_LOG_BINARY_RECORD_FORMAT)
+		{
+			unsigned int id = 0;
+			int level = 0, line = 0;
+			if (end - cur < 12) return false;
+			memcpy(&id, cur, 4); cur += 4;
+			memcpy(&level, cur, 4); cur += 4;
+			memcpy(&line, cur, 4); cur += 4;
+			if (id >= 0x100000) return false;
+
+			if (m_formats.size() <= id) m_formats.resize(id + 1);
+			Format& format = m_formats[id];
+			format.level = (short)level;
+			format.line = line;
+			format.valid = ReadString(cur, end, format.file) && ReadString(cur, end, format.function) && ReadString(cur, end, format.fmt);
+			return format.valid;
+		}
+
+		long long time_us = 0;
+		if (end - cur < (int)sizeof(time_us)) return false;
+		memcpy(&time_us, cur, sizeof(time_us));
+		cur += sizeof(time_us);
+
+		const time_t time = (time_t)(time_us / 1000000);
+		if (time != m_cache_time)
+		{
+			m_cache_time = time;
+			CarpTime::FormatTime(time, nullptr, '-', &m_cache_hms, ':');
+		}
+		out.append(m_cache_hms);
+		out.push_back(' ');
+
+		if (head.id < m_formats.size() && m_formats[head.id].valid)
+		{
+			const Format& format = m_formats[head.id];
+			Expand(out, format.level, format.file.c_str(), format.function.c_str(), format.line, format.fmt.c_str(), cur, end - cur);
+		}
+		else
+		{
+			out.append("unknown log format id:").append(std::to_string(head.id));
+		}
+		out.push_back('\n');
+		return true;
+	}
+
+	// Ѷ־ļԭıļ
+	static bool DecodeFile(const std::string& in_path, const std::string& out_path)
+	{
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable:4996)
+#endif
+		FILE* in = fopen(in_path.c_str(), "rb");
+		if (in == nullptr) return false;
+		FILE* out = fopen(out_path.c_str(), "wb");
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+		if (out == nullptr)
+		{
+			fclose(in);
+			return false;
+		}
+
+		char magic[CARP_LOG_BINARY_MAGIC_LEN];
+		bool result = fread(magic, 1, sizeof(magic), in) == sizeof(magic) && memcmp(magic, CARP_LOG_BINARY_MAGIC, sizeof(magic)) == 0;
+
+		CarpLogBinaryDecoder decoder;
+		std::vector<char> record;
+		std::string text;
+		while (result)
+		{
+			CarpLogRecordHead head;
+			const size_t read = fread(&head, 1, sizeof(head), in);
+			if (read == 0) break;
+			if (read != sizeof(head) || head.size < sizeof(head) || head.size > 1024 * 1024) { result = false; break; }
+
+			record.resize(head.size);
+			memcpy(record.data(), &head, sizeof(head));
+			const size_t body = head.size - sizeof(head);
+			if (fread(record.data() + sizeof(head), 1, body, in) != body) { result = false; break; }
+			if (!decoder.Decode(head, record.data(), text)) { result = false; break; }
+
+			if (text.size() >= 1024 * 1024)
+			{
+				fwrite(text.data(), 1, text.size(), out);
+				text.clear();
+			}
+		}
+
+		fwrite(text.data(), 1, text.size(), out);
+		fclose(out);
+		fclose(in);
+		return result;
+	}
+
+private:
+	static bool ReadString(const char*& cur, const char* end, std::string& out)
+	{
+		unsigned short len = 0;
+		if (end - cur < 2) return false;
+		memcpy(&len, cur, 2);
+		cur += 2;
+		if (end - cur < len) return false;
+		out.assign(cur, len);
+		cur += len;
+		return true;
+	}
+
+	static bool AppendArg(std::string& out, const char*& cur, const char* end)
+	{
+		if (cur >= end || *cur == CARP_LOG_ARG_END) return false;
+
+		char text[64];
+		const char type = *cur++;
+		if (type == CARP_LOG_ARG_BOOL || type == CARP_LOG_ARG_CHAR)
+		{
+			if (cur >= end) return false;
+			if (type == CARP_LOG_ARG_BOOL) out.push_back(*cur ? '1' : '0');
+			else out.push_back(*cur);
+			++cur;
+			return true;
+		}
+		if (type == CARP_LOG_ARG_INT || type == CARP_LOG_ARG_UINT || type == CARP_LOG_ARG_DOUBLE)
+		{
+			if (end - cur < 8) return false;
+			if (type == CARP_LOG_ARG_INT)
+			{
+				long long value = 0;
+				memcpy(&value, cur, 8);
+				snprintf(text, sizeof(text), "%lld", value);
+			}
+			else if (type == CARP_LOG_ARG_UINT)
+			{
+				unsigned long long value = 0;
+				memcpy(&value, cur, 8);
+				snprintf(text, sizeof(text), "%llu", value);
+			}
+			else
+			{
+				// ostreamĬϵһ
+				double value = 0;
+				memcpy(&value, cur, 8);
+				snprintf(text, sizeof(text), "%g", value);
+			}
+			cur += 8;
+			out.append(text);
+			return true;
+		}
+		if (type == CARP_LOG_ARG_STRING)
+		{
+			unsigned short len = 0;
+			if (end - cur < 2) return false;
+			memcpy(&len, cur, 2);
+			cur += 2;
+			if (end - cur < len) return false;
+			out.append(cur, len);
+			cur += len;
+			return true;
+		}
+		return false;
+	}
+
+private:
+	struct Format
+	{
+		short level = 0;
+		int line = 0;
+		std::string file;
+		std::string function;
+		std::string fmt;
+		bool valid = false;
+	};
+	std::vector<Format> m_formats;
+
+	time_t m_cache_time = -1;
+	std::string m_cache_hms;
+};
+
+// ־ĺ̨߳
+class CarpLogBinary
+{
+public:
+	typedef std::function<void(const std::string&, short)> PRINT_FUNC;
+
+	~CarpLogBinary() { Stop(); }
+
+public:
+	/* 
+	 * @param path: ļ·
+	 * @param name: ļǰ׺
+	 * @param print: ӡΪձʾӡ
+	 * @param ring_size: ÿ̵߳ĻλС
+	 * @param interval_ms: ̨߳дļļһʱǰ
+	 */
+	void Start(const std::string& path, const std::string& name, PRINT_FUNC print, size_t ring_size, int interval_ms)
+	{
+		if (m_thread != nullptr) return;
+
+		m_file_path = path;
+		m_file_name = name;
+		m_print = print;
+		m_ring_size = ring_size;
+		m_interval_ms = interval_ms > 0 ? interval_ms : 1;
+		Register(m_drop_site, "log ring is full, {} records dropped");
+
+		m_run = true;
+		m_thread = new std::thread(&CarpLogBinary::Run, this);
+		m_start = true;
+	}
+
+	void Stop()
+	{
+		if (m_thread == nullptr) return;
+
+		m_start = false;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_run = false;
+			m_cv.notify_all();
+		}
+		m_thread->join();
+		delete m_thread;
+		m_thread = nullptr;
+
+		if (m_file)
+		{
+			fclose(m_file);
+			m_file = nullptr;
+		}
+		m_cur_day = 0;
+	}
+
+	bool IsStart() const { return m_start; }
+	long long GetDroppedCount() const { return m_dropped_count; }
+
+public:
+	template <typename... Args>
+	void Log(CarpLogSite& site, const char* fmt, const Args&... args)
+	{
+		int id = site.id.load(std::memory_order_acquire);
+		if (id < 0) id = Register(site, fmt);
+
+		ThreadData& data = GetThreadData();
+		CarpLogArgWriter writer(data.buffer, sizeof(data.buffer));
+		writer.AddTime(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+		writer.AddAll(args...);
+		if (!data.ring->Write((unsigned int)id, data.buffer, writer.GetSize())) return;
+
+		// һǰѺ̨̣߳ȶʱд
+		if (data.ring->GetUsed() > data.ring->GetCapacity() / 2 && !m_notify.exchange(true))
+			m_cv.notify_one();
+	}
+
+	// עʽظʽid
+	int Register(CarpLogSite& site, const char* fmt)
+	{
+		std::unique_lock<std::mutex> lock(m_format_mutex);
+		int id = site.id.load(std::memory_order_relaxed);
+		if (id >= 0) return id;
+
+		id = (int)m_formats.size();
+		FormatInfo info;
+		info.level = site.level;
+		info.file = site.file;
+		info.function = site.function;
+		info.line = site.line;
+		info.fmt = fmt;
+		m_formats.push_back(info);
+		site.id.store(id, std::memory_order_release);
+		return id;
+	}
+
+private:
+	struct FormatInfo
+	{
+		short level = 0;
+		int line = 0;
+		const char* file = nullptr;
+		const char* function = nullptr;
+		const char* fmt = nullptr;
+	};
+
+	// ߳˽ݣ߳̽ʱֻǻرգɺ̨߳дͷ
+	struct ThreadData
+	{
+		~ThreadData() { if (ring) ring->Close(); }
+		std::shared_ptr<CarpLogRing> ring;
+		char buffer[CARP_LOG_BINARY_RECORD_MAX];
+	};
+
+	ThreadData& GetThreadData()
+	{
+		static thread_local ThreadData data;
+		if (!data.ring)
+		{
+			data.ring = std::make_shared<CarpLogRing>(m_ring_size);
+			std::unique_lock<std::mutex> lock(m_ring_mutex);
+			m_rings.push_back(data.ring);
+		}
+		return data;
+	}
+
+private:
+	void Run()
+	{
+		bool run = true;
+		while (run)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				if (m_run && !m_notify) m_cv.wait_for(lock, std::chrono::milliseconds(m_interval_ms));
+				run = m_run;
+			}
+			m_notify = false;
+			Drain();
+		}
+	}
+
+	void Drain()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_ring_mutex);
+			m_drain_rings.assign(m_rings.begin(), m_rings.end());
+		}
+
+		CheckFile();
+
+		bool has_closed = false;
+		for (auto& ring : m_drain_rings)
+		{
+			ring->Read([this](const CarpLogRecordHead& head, const char* data) { WriteRecord(head, data); });
+
+			const unsigned int dropped = ring->TakeDropped();
+			if (dropped > 0) WriteDropped(dropped);
+
+			if (ring->IsClosed() && ring->IsEmpty()) has_closed = true;
+		}
+		m_drain_rings.clear();
+
+		if (has_closed)
+		{
+			std::unique_lock<std::mutex> lock(m_ring_mutex);
+			for (auto it = m_rings.begin(); it != m_rings.end();)
+			{
+				if ((*it)->IsClosed() && (*it)->IsEmpty()) it = m_rings.erase(it);
+				else ++it;
+			}
+		}
+
+		// д
+		if (!m_out.empty() && m_file != nullptr)
+		{
+			std::fwrite(m_out.data(), 1, m_out.size(), m_file);
+			std::fflush(m_file);
+		}
+		m_out.clear();
+	}
+
+	void WriteRecord(const CarpLogRecordHead& head, const char* data)
+	{
+		// ǰļһõʽд붨
+		if (head.id >= m_written.size() || !m_written[head.id]) WriteFormat(head.id);
+
+		m_out.append(data, head.size);
+		if (m_print && head.id < m_formats_copy.size())
+		{
+			m_text.clear();
+			if (m_decoder.Decode(head, data, m_text)) m_print(m_text, m_formats_copy[head.id].level);
+		}
+	}
+
+	void WriteFormat(unsigned int id)
+	{
+		if (id >= m_formats_copy.size())
+		{
+			std::unique_lock<std::mutex> lock(m_format_mutex);
+			m_formats_copy = m_formats;
+		}
+		if (id >= m_formats_copy.size()) return;
+		if (m_written.size() <= id) m_written.resize(id + 1, false);
+		m_written[id] = true;
+
+		const FormatInfo& info = m_formats_copy[id];
+		const size_t begin = m_out.size();
+		m_out.resize(begin + sizeof(CarpLogRecordHead));
+		const int level = info.level;
+		m_out.append((const char*)&id, 4);
+		m_out.append((const char*)&level, 4);
+		m_out.append((const char*)&info.line, 4);
+		AppendString(info.file);
+		AppendString(info.function);
+		AppendString(info.fmt);
+		m_out.resize((m_out.size() + 7) & ~(size_t)7, 0);
+
+		CarpLogRecordHead head;
+		head.size = (unsigned int)(m_out.size() - begin);
+		head.id = CARP_LOG_BINARY_RECORD_FORMAT;
+		memcpy(&m_out[begin], &head, sizeof(head));
+
+		// ӡʱҲҪܽ
+		if (m_print) m_decoder.Decode(head, m_out.data() + begin, m_text);
+	}
+
+	void WriteDropped(unsigned int dropped)
+	{
+		m_dropped_count += dropped;
+
+		char buffer[64];
+		CarpLogArgWriter writer(buffer, sizeof(buffer));
+		writer.AddTime(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+		writer.Add(dropped);
+
+		std::string record;
+		record.resize((sizeof(CarpLogRecordHead) + writer.GetSize() + 7) & ~(size_t)7, 0);
+		CarpLogRecordHead head;
+		head.size = (unsigned int)record.size();
+		head.id = (unsigned int)m_drop_site.id.load();
+		memcpy(&record[0], &head, sizeof(head));
+		memcpy(&record[sizeof(head)], buffer, writer.GetSize());
+		WriteRecord(head, record.data());
+	}
+
+	void AppendString(const char* text)
+	{
+		size_t len = strlen(text);
+		if (len > 0xFFFF) len = 0xFFFF;
+		const unsigned short len16 = (unsigned short)len;
+		m_out.append((const char*)&len16, 2);
+		m_out.append(text, len);
+	}
+
+	// лļ
+	void CheckFile()
+	{
+		const time_t cur_time = time(0);
+		if (cur_time - m_cur_day < CARP_TIME_ONE_DAY_SECONDS) return;
+
+		// л֮ǰһдļ
+		if (m_file != nullptr)
+		{
+			std::fwrite(m_out.data(), 1, m_out.size(), m_file);
+			fclose(m_file);
+			m_file = nullptr;
+		}
+		m_out.clear();
+		m_written.clear();
+
+		std::string YMD, HMS;
+		CarpTime::FormatTime(cur_time, &YMD, '-', &HMS, '-');
+		std::string file_path;
+		file_path.append(m_file_path).append(m_file_name).append("_").append(YMD).append("_").append(HMS).append(".blog");
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable:4996)
+#endif
+		m_file = fopen(file_path.c_str(), "ab");
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+		if (m_file == nullptr)
+			printf("log file open failed:%s\n", file_path.c_str());
+		else
+			m_out.append(CARP_LOG_BINARY_MAGIC, CARP_LOG_BINARY_MAGIC_LEN);
+
+		m_cur_day = CarpTime::CalcTodayBeginTime(cur_time);
+	}
+
+private:
+	std::string m_file_path;
+	std::string m_file_name;
+	PRINT_FUNC m_print;
+	size_t m_ring_size = 1024 * 1024;
+	int m_interval_ms = 10;
+
+	CarpLogSite m_drop_site{ CARP_LOG_LEVEL_WARN, __FILE__, __FUNCTION__, __LINE__ };
+	std::atomic<long long> m_dropped_count{ 0 };
+
+private:
+	std::mutex m_format_mutex;
+	std::vector<FormatInfo> m_formats;			// иʽ±id
+
+	std::mutex m_ring_mutex;
+	std::list<std::shared_ptr<CarpLogRing>> m_rings;
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::atomic<bool> m_notify{ false };
+	bool m_run = false;
+	std::atomic<bool> m_start{ false };
+	std::thread* m_thread = nullptr;
+
+private:
+	// ֻں̷̨߳
+	FILE* m_file = nullptr;
+	time_t m_cur_day = 0;
+	std::string m_out;							// Ҫд
+	std::vector<bool> m_written;				// ǰļѾд붨ĸʽ
+	std::vector<FormatInfo> m_formats_copy;		// ʽĿÿ¼
+	std::vector<std::shared_ptr<CarpLogRing>> m_drain_rings;
+	CarpLogBinaryDecoder m_decoder;
+	std::string m_text;
+};
+
+/* eg. ̵߳ĺʱԱ
+s_carp_log.Setup("./", "bench", false);
+s_carp_log.SetupBinary(16 * 1024 * 1024);
+
+const int count = 200000;
+std::string name = "account_name";
+auto now_ns = []() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); };
+
+long long t0 = now_ns();
+for (int i = 0; i < count; ++i) CARP_INFO("user " << i << " login from " << name << " cost " << 1.5);
+long long t1 = now_ns();
+for (int i = 0; i < count; ++i) CARP_FAST_INFO("user {} login from {} cost {}", i, name, 1.5);
+long long t2 = now_ns();
+printf("CARP_INFO:%lldns CARP_FAST_INFO:%lldns dropped:%lld\n", (t1 - t0) / count, (t2 - t1) / count, s_carp_log.GetBinaryDroppedCount());
+s_carp_log.Shutdown();
+
+// ԭı
+CarpLogBinaryDecoder::DecodeFile("bench_2024-01-01_00-00-00.blog", "bench.txt");
+*/
+
+#endif
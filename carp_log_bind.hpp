@@ -12,6 +12,10 @@ public:
 		luabridge::getGlobalNamespace(l_state)
 			.beginNamespace("carp")
 			.addFunction("Log", Log)
+			.addFunction("DecodeBinaryLog", DecodeBinaryLog)
+			.addFunction("SetLogLevelEnable", SetLogLevelEnable)
+			.addFunction("SetLogRateLimit", SetLogRateLimit)
+			.addFunction("GetLogSuppressedCount", GetLogSuppressedCount)
 			.endNamespace();
 	}
 
@@ -20,6 +24,26 @@ private:
 	{
 		s_carp_log.Log(content, level);
 	}
+
+	static bool DecodeBinaryLog(const char* in_path, const char* out_path)
+	{
+		return CarpLogBinaryDecoder::DecodeFile(in_path, out_path);
+	}
+
+	static void SetLogLevelEnable(int level, bool enable)
+	{
+		s_carp_log.SetLevelEnable(level, enable);
+	}
+
+	static void SetLogRateLimit(int count_per_second)
+	{
+		s_carp_log.SetRateLimit(count_per_second);
+	}
+
+	static double GetLogSuppressedCount()
+	{
+		return static_cast<double>(s_carp_log.GetSuppressedCount());
+	}
 };
 
 #endif
@@ -0,0 +1,540 @@
+#ifndef CARP_LOG_FILE_INCLUDED
+#define CARP_LOG_FILE_INCLUDED
+
+#include "carp_thread_consumer.hpp"
+#include "carp_time.hpp"
+#include "carp_file.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef CARP_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef CARP_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+// ļʱĳȣʽΪYYYY-MM-DD_HH-MM-SS
+#define CARP_LOG_FILE_TIME_LEN 19
+
+// ֮ѹʽ
+enum CarpLogCompressType
+{
+	CARP_LOG_COMPRESS_NONE = 0,
+	CARP_LOG_COMPRESS_GZIP = 1,		// ҪCARP_HAS_ZLIB
+	CARP_LOG_COMPRESS_ZSTD = 2,		// ҪCARP_HAS_ZSTD
+};
+
+// ־ļ
+struct CarpLogRotateConfig
+{
+	size_t max_file_size = 512 * 1024 * 1024;		// ļֽ0ʾС
+	int rotate_seconds = CARP_TIME_ONE_DAY_SECONDS;	// ʱļӵ0㿪ʼ룬0ʾʱ
+	size_t buffer_size = 256 * 1024;				// û̬дС
+	int flush_seconds = 1;							// ־ͣ
+	int max_file_count = 0;							// ౣļ0ʾ
+	long long max_total_size = 0;					// ļռõֽ0ʾ
+#if defined(CARP_HAS_ZLIB)
+	int compress = CARP_LOG_COMPRESS_GZIP;			// ֮ѹʽ
+#elif defined(CARP_HAS_ZSTD)
+	int compress = CARP_LOG_COMPRESS_ZSTD;
+#else
+	int compress = CARP_LOG_COMPRESS_NONE;
+#endif
+	int compress_level = 0;							// ѹȼ0ʾʹĬϵȼ
+};
+
+// ֮ļѹ̴߳
+struct CarpLogCompressTask
+{
+	std::string file_path;		// ҪѹļΪձʾֻ
+	std::string folder;			// ־Ŀ¼
+	std::string prefix;			// ־ļǰ׺
+	CarpLogRotateConfig config;
+};
+
+// ѹ̣߳ѹ֮ļɾľļ
+// ͬһĿ¼ͬһǰ׺ֻһд
+class CarpLogCompressor : public CarpThreadConsumer<CarpLogCompressTask>
+{
+public:
+	// ѹ֮չ
+	static const char* GetCompressExt(int compress)
+	{
+		if (compress == CARP_LOG_COMPRESS_GZIP) return ".gz";
+		if (compress == CARP_LOG_COMPRESS_ZSTD) return ".zst";
+		return "";
+	}
+
+	// жǷǰ׺־ļʽΪprefix_YMD_HMS[_N].log[.gz|.zst]
+	static bool IsLogFile(const std::string& name, const std::string& prefix, bool& compressed)
+	{
+		if (name.size() <= prefix.size() + 1) return false;
+		if (name.compare(0, prefix.size(), prefix) != 0) return false;
+		if (name[prefix.size()] != '_') return false;
+		if (name[prefix.size() + 1] < '0' || name[prefix.size() + 1] > '9') return false;
+
+		compressed = false;
+		if (EndWith(name, ".log")) return true;
+		compressed = EndWith(name, ".log.gz") || EndWith(name, ".log.zst");
+		return compressed;
+	}
+
+	/* ѹļɹ֮ɾԭļ
+	 * дʱļٸ;˳²ѹļ
+	 * @param file_path: ԭļ
+	 * @param compress: ѹʽ
+	 * @param level: ѹȼ
+	 * @return Ƿɹ
+	 */
+	static bool CompressFile(const std::string& file_path, int compress, int level)
+	{
+		const std::string out_path = file_path + GetCompressExt(compress);
+		const std::string temp_path = out_path + ".tmp";
+
+		bool result = false;
+		if (compress == CARP_LOG_COMPRESS_GZIP)
+			result = CompressGzip(file_path, temp_path, level);
+		else if (compress == CARP_LOG_COMPRESS_ZSTD)
+			result = CompressZstd(file_path, temp_path, level);
+
+		if (!result)
+		{
+			std::remove(temp_path.c_str());
+			return false;
+		}
+
+		if (std::rename(temp_path.c_str(), out_path.c_str()) != 0)
+		{
+			std::remove(temp_path.c_str());
+			return false;
+		}
+
+		std::remove(file_path.c_str());
+		return true;
+	}
+
+	/* ɾߴСľļµļһ
+	 * @param folder: ־Ŀ¼
+	 * @param prefix: ־ļǰ׺
+	 * @param max_file_count: ౣļ0ʾ
+	 * @param max_total_size: ռõֽ0ʾ
+	 */
+	static void Retain(const std::string& folder, const std::string& prefix, int max_file_count, long long max_total_size)
+	{
+		if (max_file_count <= 0 && max_total_size <= 0) return;
+
+		std::vector<std::string> file_list, dir_list;
+		CarpFile::GetNameListInFolder(folder.empty() ? "." : folder, file_list, dir_list);
+
+		std::vector<std::string> log_list;
+		for (auto& name : file_list)
+		{
+			bool compressed = false;
+			if (IsLogFile(name, prefix, compressed)) log_list.push_back(name);
+		}
+
+		// ļʱţµ
+		const size_t offset = prefix.size() + 1;
+		std::sort(log_list.begin(), log_list.end(), [offset](const std::string& a, const std::string& b)
+		{
+			const int result = a.compare(offset, CARP_LOG_FILE_TIME_LEN, b, offset, CARP_LOG_FILE_TIME_LEN);
+			if (result != 0) return result > 0;
+			return GetFileIndex(a, offset) > GetFileIndex(b, offset);
+		});
+
+		long long total_size = 0;
+		for (size_t i = 0; i < log_list.size(); ++i)
+		{
+			const std::string path = folder + log_list[i];
+			CarpFile::PathAttribute attr;
+			if (!CarpFile::GetPathAttribute(path, attr)) continue;
+			total_size += static_cast<long long>(attr.size);
+
+			if (i == 0) continue;
+			if ((max_file_count > 0 && static_cast<int>(i) >= max_file_count)
+				|| (max_total_size > 0 && total_size > max_total_size))
+				std::remove(path.c_str());
+		}
+	}
+
+protected:
+	void Execute(CarpLogCompressTask& task) override
+	{
+		// ļѾΪɾ
+		if (!task.file_path.empty() && task.config.compress != CARP_LOG_COMPRESS_NONE && CarpFile::IsFileExist(task.file_path))
+		{
+			if (!CompressFile(task.file_path, task.config.compress, task.config.compress_level))
+				printf("log file compress failed:%s\n", task.file_path.c_str());
+		}
+
+		Retain(task.folder, task.prefix, task.config.max_file_count, task.config.max_total_size);
+	}
+
+	// ˳ʱѹ´ʱ´
+	void Abandon(CarpLogCompressTask& task) override {}
+
+private:
+	// ͬһڹţYMD_HMS_N
+	static int GetFileIndex(const std::string& name, size_t offset)
+	{
+		const size_t pos = offset + CARP_LOG_FILE_TIME_LEN;
+		if (pos >= name.size() || name[pos] != '_') return 0;
+		return atoi(name.c_str() + pos + 1);
+	}
+
+	static bool EndWith(const std::string& name, const char* ext)
+	{
+		const size_t len = strlen(ext);
+		return name.size() >= len && name.compare(name.size() - len, len, ext) == 0;
+	}
+
+	static bool CompressGzip(const std::string& in_path, const std::string& out_path, int level)
+	{
+#ifdef CARP_HAS_ZLIB
+		FILE* in = fopen(in_path.c_str(), "rb");
+		if (in == nullptr) return false;
+
+		char mode[8] = "wb";
+		if (level > 0 && level <= 9) { mode[2] = static_cast<char>('0' + level); mode[3] = 0; }
+		gzFile out = gzopen(out_path.c_str(), mode);
+		if (out == nullptr)
+		{
+			fclose(in);
+			return false;
+		}
+		gzbuffer(out, 128 * 1024);
+
+		bool result = true;
+		std::vector<char> buffer(256 * 1024);
+		while (true)
+		{
+			const size_t read = fread(buffer.data(), 1, buffer.size(), in);
+			if (read == 0) break;
+			if (gzwrite(out, buffer.data(), static_cast<unsigned>(read)) != static_cast<int>(read))
+			{
+				result = false;
+				break;
+			}
+		}
+		if (ferror(in)) result = false;
+
+		fclose(in);
+		if (gzclose(out) != Z_OK) result = false;
+		return result;
+#else
+		return false;
+#endif
+	}
+
+	static bool CompressZstd(const std::string& in_path, const std::string& out_path, int level)
+	{
+#ifdef CARP_HAS_ZSTD
+		FILE* in = fopen(in_path.c_str(), "rb");
+		if (in == nullptr) return false;
+		FILE* out = fopen(out_path.c_str(), "wb");
+		if (out == nullptr)
+		{
+			fclose(in);
+			return false;
+		}
+
+		ZSTD_CCtx* ctx = ZSTD_createCCtx();
+		ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, level > 0 ? level : ZSTD_CLEVEL_DEFAULT);
+
+		bool result = true;
+		std::vector<char> in_buffer(ZSTD_CStreamInSize());
+		std::vector<char> out_buffer(ZSTD_CStreamOutSize());
+		while (result)
+		{
+			const size_t read = fread(in_buffer.data(), 1, in_buffer.size(), in);
+			const bool last = read < in_buffer.size();
+			ZSTD_inBuffer input = { in_buffer.data(), read, 0 };
+			bool finished = false;
+			while (!finished)
+			{
+				ZSTD_outBuffer output = { out_buffer.data(), out_buffer.size(), 0 };
+				const size_t remaining = ZSTD_compressStream2(ctx, &output, &input, last ? ZSTD_e_end : ZSTD_e_continue);
+				if (ZSTD_isError(remaining)
+					|| fwrite(out_buffer.data(), 1, output.pos, out) != output.pos)
+				{
+					result = false;
+					break;
+				}
+				finished = last ? (remaining == 0) : (input.pos == input.size);
+			}
+			if (last) break;
+		}
+		if (ferror(in)) result = false;
+
+		ZSTD_freeCCtx(ctx);
+		fclose(in);
+		if (fclose(out) != 0) result = false;
+		return result;
+#else
+		return false;
+#endif
+	}
+};
+
+/* ־ļֻ־߳ʹ
+ * O_APPEND򿪣дȽû̬˻߳ʱ֮һд
+ * Сʱ֮ļѹ̣߳д־
+ */
+class CarpLogFile
+{
+public:
+	~CarpLogFile() { Close(); }
+
+public:
+	// ļĿ¼ǰ׺͹
+	void Setup(const std::string& path, const std::string& name, const CarpLogRotateConfig& config)
+	{
+		m_folder = path;
+		m_prefix = name;
+		m_config = config;
+		if (m_config.buffer_size < 4096) m_config.buffer_size = 4096;
+		m_buffer.resize(m_config.buffer_size);
+		m_used = 0;
+	}
+
+	/* д־
+	 * @param data: ־
+	 * @param len: 
+	 * @param now: ǰʱ
+	 * @return ļûд򿪷false
+	 */
+	bool Write(const char* data, size_t len, time_t now)
+	{
+		if (now >= m_next_rotate_time
+			|| (m_config.max_file_size > 0 && m_file_size + m_used > 0 && m_file_size + m_used + len > m_config.max_file_size))
+			Rotate(now);
+
+		if (m_fd < 0) return false;
+
+		if (m_used + len > m_buffer.size()) WriteOut(now);
+		if (len >= m_buffer.size())
+		{
+			WriteFd(data, len);
+		}
+		else
+		{
+			memcpy(m_buffer.data() + m_used, data, len);
+			m_used += len;
+		}
+
+		if (now - m_last_write_time >= m_config.flush_seconds) WriteOut(now);
+		return true;
+	}
+
+	// ѻдļ
+	void Flush()
+	{
+		WriteOut(CarpTime::GetCurTime());
+	}
+
+	// رļֹͣѹ߳
+	void Close()
+	{
+		if (m_fd >= 0)
+		{
+			WriteOut(CarpTime::GetCurTime());
+#ifdef _WIN32
+			_close(m_fd);
+#else
+			close(m_fd);
+#endif
+			m_fd = -1;
+		}
+		m_next_rotate_time = 0;
+		m_compressor.Stop();
+	}
+
+	// ǰдļ
+	const std::string& GetCurrentPath() const { return m_cur_path; }
+
+private:
+	void Rotate(time_t now)
+	{
+		std::string old_path;
+		if (m_fd >= 0)
+		{
+			WriteOut(now);
+#ifdef _WIN32
+			_close(m_fd);
+#else
+			close(m_fd);
+#endif
+			m_fd = -1;
+			old_path = m_cur_path;
+		}
+
+		// һδ򿪣ϴûѹļѹ߳
+		const bool first = !m_compressor.IsStart();
+		if (first) m_compressor.Start();
+
+		m_cur_path = MakeFilePath(now);
+		m_file_size = 0;
+		m_last_write_time = now;
+		if (!Open(m_cur_path))
+		{
+			printf("log file open failed:%s\n", m_cur_path.c_str());
+			// һ֮ٳ
+			m_next_rotate_time = now + 1;
+		}
+		else
+		{
+			m_next_rotate_time = CalcNextRotateTime(now);
+		}
+
+		if (first) AddLeftover();
+
+		CarpLogCompressTask task;
+		task.file_path = old_path;
+		task.folder = m_folder;
+		task.prefix = m_prefix;
+		task.config = m_config;
+		m_compressor.Add(task);
+	}
+
+	time_t CalcNextRotateTime(time_t now) const
+	{
+		if (m_config.rotate_seconds <= 0) return std::numeric_limits<time_t>::max();
+		const time_t day_begin = CarpTime::CalcTodayBeginTime(now);
+		return day_begin + ((now - day_begin) / m_config.rotate_seconds + 1) * m_config.rotate_seconds;
+	}
+
+	std::string MakeFilePath(time_t now)
+	{
+		std::string YMD, HMS;
+		CarpTime::FormatTime(now, &YMD, '-', &HMS, '-');
+
+		std::string base;
+		base.append(m_folder).append(m_prefix).append("_").append(YMD).append("_").append(HMS);
+
+		// ͬһڰСΣӵ
+		// ļѾɾŲֻļǷ
+		int index = 0;
+		if (now == m_last_path_time) index = m_last_path_index + 1;
+		std::string path;
+		while (true)
+		{
+			path = base;
+			if (index > 0) path.append("_").append(std::to_string(index));
+			path.append(".log");
+			if (!IsNameUsed(path)) break;
+			++index;
+		}
+
+		m_last_path_time = now;
+		m_last_path_index = index;
+		return path;
+	}
+
+	bool IsNameUsed(const std::string& path) const
+	{
+		return CarpFile::IsFileExist(path)
+			|| CarpFile::IsFileExist(path + CarpLogCompressor::GetCompressExt(CARP_LOG_COMPRESS_GZIP))
+			|| CarpFile::IsFileExist(path + CarpLogCompressor::GetCompressExt(CARP_LOG_COMPRESS_ZSTD));
+	}
+
+	// ϴνµδѹļѹ߳
+	void AddLeftover()
+	{
+		if (m_config.compress == CARP_LOG_COMPRESS_NONE) return;
+
+		std::vector<std::string> file_list, dir_list;
+		CarpFile::GetNameListInFolder(m_folder.empty() ? "." : m_folder, file_list, dir_list);
+		for (auto& name : file_list)
+		{
+			bool compressed = false;
+			if (!CarpLogCompressor::IsLogFile(name, m_prefix, compressed) || compressed) continue;
+
+			const std::string path = m_folder + name;
+			if (path == m_cur_path) continue;
+
+			CarpLogCompressTask task;
+			task.file_path = path;
+			task.folder = m_folder;
+			task.prefix = m_prefix;
+			task.config = m_config;
+			m_compressor.Add(task);
+		}
+	}
+
+	bool Open(const std::string& path)
+	{
+#ifdef _WIN32
+		// ʹöռʽ򿪣־ļرյʱҲԲ鿴͸
+		m_fd = _wopen(CarpFile::UTF82Unicode(path).c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		m_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+		return m_fd >= 0;
+	}
+
+	void WriteOut(time_t now)
+	{
+		m_last_write_time = now;
+		if (m_used == 0) return;
+		WriteFd(m_buffer.data(), m_used);
+		m_used = 0;
+	}
+
+	void WriteFd(const char* data, size_t len)
+	{
+		if (m_fd < 0) return;
+
+		m_file_size += len;
+		while (len > 0)
+		{
+#ifdef _WIN32
+			const int written = _write(m_fd, data, static_cast<unsigned int>(len));
+#else
+			const ssize_t written = write(m_fd, data, len);
+			if (written < 0 && errno == EINTR) continue;
+#endif
+			if (written <= 0) return;
+			data += written;
+			len -= static_cast<size_t>(written);
+		}
+	}
+
+private:
+	std::string m_folder;				// ־Ŀ¼
+	std::string m_prefix;				// ־ļǰ׺
+	CarpLogRotateConfig m_config;		// 
+
+	std::string m_cur_path;				// ǰļ
+	int m_fd = -1;						// ǰļ
+	size_t m_file_size = 0;				// ǰļС
+	time_t m_next_rotate_time = 0;		// һΰʱʱ
+	time_t m_last_write_time = 0;		// һдļʱ
+	time_t m_last_path_time = 0;		// һδļʱ
+	int m_last_path_index = 0;			// һδļ
+
+	std::vector<char> m_buffer;			// û̬
+	size_t m_used = 0;					// ѾʹõĴС
+
+	CarpLogCompressor m_compressor;		// ѹ߳
+};
+
+#endif
@@ -0,0 +1,441 @@
+#ifndef CARP_LUA_ALLOC_INCLUDED
+#define CARP_LUA_ALLOC_INCLUDED
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+
+#include "carp_lua.hpp"
+
+/* luaڴͨlua_newstate
+ * luaͷź·ʱһᴫԭĴС(osize)ԷҪ¼ͷ
+ * ͬһlua_State(Э)ֻһ߳ʹãҪ
+ */
+class CarpLuaAllocator
+{
+public:
+	virtual ~CarpLuaAllocator() {}
+
+public:
+	// lua_Allocһ£ptrΪʱosizeʾͶǴС
+	virtual void* Realloc(void* ptr, size_t osize, size_t nsize) = 0;
+
+	// lua_State֮͹ر֮ǰ
+	virtual void OnStateCreate(lua_State* L) {}
+	virtual void OnStateClose(lua_State* L) {}
+
+	// countӣֻҪķŻ
+	virtual void OnHook(lua_State* L, lua_Debug* ar) {}
+
+	// ڴͳƱ
+	virtual std::string Dump(size_t top) { return std::string(); }
+	// ¼ǰڴΪһα
+	virtual void Snapshot() {}
+
+	// ǰȥֽ
+	long long GetLiveBytes() const { return m_live_bytes; }
+	long long GetPeakBytes() const { return m_peak_bytes; }
+	long long GetAllocCount() const { return m_alloc_count; }
+
+public:
+	// lua_newstateķ亯
+	static void* Alloc(void* ud, void* ptr, size_t osize, size_t nsize)
+	{
+		return static_cast<CarpLuaAllocator*>(ud)->Realloc(ptr, osize, nsize);
+	}
+
+	// lua_sethookĹӣͨlua_getallocfȡ
+	static void Hook(lua_State* L, lua_Debug* ar)
+	{
+		void* ud = nullptr;
+		if (lua_getallocf(L, &ud) != Alloc || ud == nullptr) return;
+		static_cast<CarpLuaAllocator*>(ud)->OnHook(L, ar);
+	}
+
+protected:
+	void Account(void* ptr, size_t osize, size_t nsize)
+	{
+		if (ptr == nullptr) osize = 0;
+		m_live_bytes += static_cast<long long>(nsize) - static_cast<long long>(osize);
+		if (m_live_bytes > m_peak_bytes) m_peak_bytes = m_live_bytes;
+		if (nsize > osize) ++m_alloc_count;
+	}
+
+protected:
+	long long m_live_bytes = 0;		// ǰʹõֽ
+	long long m_peak_bytes = 0;		// ʹõֽ
+	long long m_alloc_count = 0;	// ·Ĵ
+};
+
+typedef std::shared_ptr<CarpLuaAllocator> CarpLuaAllocatorPtr;
+
+// luaL_newstateĬϷһֱʹreallocfree
+class CarpLuaSystemAllocator : public CarpLuaAllocator
+{
+public:
+	void* Realloc(void* ptr, size_t osize, size_t nsize) override
+	{
+		if (nsize == 0)
+		{
+			Account(ptr, osize, 0);
+			free(ptr);
+			return nullptr;
+		}
+
+		void* result = realloc(ptr, nsize);
+		if (result != nullptr) Account(ptr, osize, nsize);
+		return result;
+	}
+
+	std::string Dump(size_t top) override
+	{
+		std::ostringstream stream;
+		stream << "live:" << m_live_bytes << " peak:" << m_peak_bytes << " alloc:" << m_alloc_count << "\n";
+		return stream.str();
+	}
+};
+
+// Сڴ水Сּÿÿ
+#define CARP_LUA_POOL_ALIGN 16
+#define CARP_LUA_POOL_MAX_SIZE 256
+#define CARP_LUA_POOL_CLASS_COUNT (CARP_LUA_POOL_MAX_SIZE / CARP_LUA_POOL_ALIGN)
+#define CARP_LUA_POOL_CHUNK_SIZE (64 * 1024)
+
+/* Сط
+ * ַհЩС16ֽڷּ64KĴгͷ֮һؿ
+ * CARP_LUA_POOL_MAX_SIZEֱʹrealloc
+ * ڴֱŻ黹ϵͳԱlua_close֮
+ */
+class CarpLuaPoolAllocator : public CarpLuaAllocator
+{
+public:
+	~CarpLuaPoolAllocator()
+	{
+		for (auto* chunk : m_chunks) free(chunk);
+	}
+
+public:
+	void* Realloc(void* ptr, size_t osize, size_t nsize) override
+	{
+		if (ptr == nullptr) osize = 0;
+
+		if (nsize == 0)
+		{
+			Account(ptr, osize, 0);
+			Free(ptr, osize);
+			return nullptr;
+		}
+
+		const size_t old_class = GetClass(osize);
+		const size_t new_class = GetClass(nsize);
+
+		// ͬһԭʹ
+		if (ptr != nullptr && old_class == new_class && old_class < CARP_LUA_POOL_CLASS_COUNT)
+		{
+			Account(ptr, osize, nsize);
+			return ptr;
+		}
+
+		// Ǵ飬realloc
+		if (ptr != nullptr && old_class >= CARP_LUA_POOL_CLASS_COUNT && new_class >= CARP_LUA_POOL_CLASS_COUNT)
+		{
+			void* result = realloc(ptr, nsize);
+			if (result != nullptr) Account(ptr, osize, nsize);
+			return result;
+		}
+
+		// ʧʱԭĿ뱣ֲ
+		void* result = Malloc(nsize, new_class);
+		if (result == nullptr) return nullptr;
+		if (ptr != nullptr)
+		{
+			memcpy(result, ptr, osize < nsize ? osize : nsize);
+			Free(ptr, osize);
+		}
+		Account(ptr, osize, nsize);
+		return result;
+	}
+
+	std::string Dump(size_t top) override
+	{
+		std::ostringstream stream;
+		stream << "live:" << m_live_bytes << " peak:" << m_peak_bytes << " alloc:" << m_alloc_count
+			<< " pool_chunk:" << m_chunks.size() << " pool_bytes:" << m_chunks.size() * CARP_LUA_POOL_CHUNK_SIZE << "\n";
+		for (size_t i = 0; i < CARP_LUA_POOL_CLASS_COUNT; ++i)
+		{
+			if (m_class_used[i] == 0) continue;
+			stream << "size:" << (i + 1) * CARP_LUA_POOL_ALIGN << " used:" << m_class_used[i] << "\n";
+		}
+		return stream.str();
+	}
+
+private:
+	static size_t GetClass(size_t size)
+	{
+		if (size == 0 || size > CARP_LUA_POOL_MAX_SIZE) return CARP_LUA_POOL_CLASS_COUNT;
+		return (size + CARP_LUA_POOL_ALIGN - 1) / CARP_LUA_POOL_ALIGN - 1;
+	}
+
+	void* Malloc(size_t size, size_t index)
+	{
+		if (index >= CARP_LUA_POOL_CLASS_COUNT) return malloc(size);
+
+		ClassInfo& info = m_classes[index];
+		++m_class_used[index];
+
+		// ȴӿȡ
+		if (info.free_list != nullptr)
+		{
+			void* result = info.free_list;
+			info.free_list = *static_cast<void**>(result);
+			return result;
+		}
+
+		// ٴӵǰ
+		const size_t block = (index + 1) * CARP_LUA_POOL_ALIGN;
+		if (info.cursor == nullptr || info.cursor + block > info.end)
+		{
+			char* chunk = static_cast<char*>(malloc(CARP_LUA_POOL_CHUNK_SIZE));
+			if (chunk == nullptr)
+			{
+				--m_class_used[index];
+				return nullptr;
+			}
+			m_chunks.push_back(chunk);
+			info.cursor = chunk;
+			info.end = chunk + CARP_LUA_POOL_CHUNK_SIZE;
+		}
+
+		void* result = info.cursor;
+		info.cursor += block;
+		return result;
+	}
+
+	void Free(void* ptr, size_t size)
+	{
+		if (ptr == nullptr) return;
+
+		const size_t index = GetClass(size);
+		if (index >= CARP_LUA_POOL_CLASS_COUNT)
+		{
+			free(ptr);
+			return;
+		}
+
+		ClassInfo& info = m_classes[index];
+		*static_cast<void**>(ptr) = info.free_list;
+		info.free_list = ptr;
+		--m_class_used[index];
+	}
+
+private:
+	struct ClassInfo
+	{
+		void* free_list = nullptr;	// ǰ8ֽڴһ
+		char* cursor = nullptr;		// ǰеλ
+		char* end = nullptr;		// ǰĽλ
+	};
+
+	ClassInfo m_classes[CARP_LUA_POOL_CLASS_COUNT];
+	long long m_class_used[CARP_LUA_POOL_CLASS_COUNT] = {};
+	std::vector<char*> m_chunks;
+};
+
+/* ڴ٣װһѷֽǵluasource:line
+ * 亯lua_getstackǲȫ(ջ·)
+ * countÿhook_countָ¼һεǰλãǵһμ¼λ
+ * hook_countԽСԽ׼ȷҲԽ
+ * ½Э̻̳йӣCarpLuaProfilerʹluaӣͬʱ
+ */
+class CarpLuaTrackAllocator : public CarpLuaAllocator
+{
+public:
+	CarpLuaTrackAllocator(const CarpLuaAllocatorPtr& inner, int hook_count = 100)
+		: m_inner(inner), m_hook_count(hook_count > 0 ? hook_count : 1)
+	{
+		if (!m_inner) m_inner = std::make_shared<CarpLuaSystemAllocator>();
+
+		// 0λñʾûִеlua
+		SiteInfo info;
+		info.source = "[C]";
+		m_site_list.push_back(info);
+	}
+
+public:
+	void* Realloc(void* ptr, size_t osize, size_t nsize) override
+	{
+		void* result = m_inner->Realloc(ptr, osize, nsize);
+		if (nsize != 0 && result == nullptr) return result;
+		Account(ptr, osize, nsize);
+
+		// ȴԭλÿ۳
+		if (ptr != nullptr)
+		{
+			auto it = m_block_map.find(ptr);
+			if (it != m_block_map.end())
+			{
+				m_site_list[it->second.site].live_bytes -= static_cast<long long>(it->second.size);
+				m_block_map.erase(it);
+			}
+		}
+
+		if (nsize == 0 || !m_enable) return result;
+
+		// ǵǰλ
+		SiteInfo& site = m_site_list[m_cur_site];
+		site.live_bytes += static_cast<long long>(nsize);
+		if (ptr == nullptr || nsize > osize)
+		{
+			++site.alloc_count;
+			site.alloc_bytes += static_cast<long long>(ptr == nullptr ? nsize : nsize - osize);
+		}
+		BlockInfo& block = m_block_map[result];
+		block.site = m_cur_site;
+		block.size = nsize;
+		return result;
+	}
+
+	void OnStateCreate(lua_State* L) override
+	{
+		m_inner->OnStateCreate(L);
+		m_enable = true;
+		lua_sethook(L, CarpLuaAllocator::Hook, LUA_MASKCOUNT, m_hook_count);
+	}
+
+	void OnStateClose(lua_State* L) override
+	{
+		lua_sethook(L, nullptr, 0, 0);
+		m_enable = false;
+		m_cur_site = 0;
+		m_inner->OnStateClose(L);
+	}
+
+	void OnHook(lua_State* L, lua_Debug* ar) override
+	{
+		if (lua_getinfo(L, "Sl", ar) == 0) return;
+
+		SiteKey key;
+		key.source = ar->source;
+		key.line = ar->currentline;
+		auto it = m_site_map.find(key);
+		if (it != m_site_map.end())
+		{
+			m_cur_site = it->second;
+			return;
+		}
+
+		// һμŸַ
+		SiteInfo info;
+		info.source = ar->source != nullptr ? ar->source : "unknown";
+		info.line = ar->currentline;
+		m_cur_site = static_cast<int>(m_site_list.size());
+		m_site_list.push_back(info);
+		m_site_map.emplace(key, m_cur_site);
+	}
+
+	void Snapshot() override
+	{
+		for (auto& site : m_site_list) site.snapshot_bytes = site.live_bytes;
+		m_snapshot_bytes = m_live_bytes;
+	}
+
+	/* 棬ǰռ
+	 * @param top: λ0ʾȫ
+	 */
+	std::string Dump(size_t top) override
+	{
+		std::vector<const SiteInfo*> list;
+		for (auto& site : m_site_list)
+		{
+			if (site.alloc_count > 0 || site.live_bytes != 0) list.push_back(&site);
+		}
+		std::sort(list.begin(), list.end(), [](const SiteInfo* a, const SiteInfo* b) { return a->live_bytes > b->live_bytes; });
+		if (top > 0 && list.size() > top) list.resize(top);
+
+		std::ostringstream stream;
+		stream << "live:" << m_live_bytes << " peak:" << m_peak_bytes << " alloc:" << m_alloc_count
+			<< " growth:" << m_live_bytes - m_snapshot_bytes << " block:" << m_block_map.size() << "\n";
+		stream << "live_bytes\tgrowth\talloc_bytes\talloc_count\tsource:line\n";
+		for (auto* site : list)
+		{
+			stream << site->live_bytes << "\t" << site->live_bytes - site->snapshot_bytes
+				<< "\t" << site->alloc_bytes << "\t" << site->alloc_count
+				<< "\t" << site->source << ":" << site->line << "\n";
+		}
+		stream << "---- inner ----\n" << m_inner->Dump(top);
+		return stream.str();
+	}
+
+private:
+	struct SiteKey
+	{
+		const char* source = nullptr;	// luaڲַԭʹڵʱַ
+		int line = 0;
+
+		bool operator == (const SiteKey& key) const { return source == key.source && line == key.line; }
+	};
+
+	struct SiteKeyHash
+	{
+		size_t operator()(const SiteKey& key) const { return std::hash<const void*>()(key.source) ^ (static_cast<size_t>(key.line) * 0x9E3779B97F4A7C15ULL); }
+	};
+
+	struct SiteInfo
+	{
+		std::string source;
+		int line = 0;
+		long long alloc_count = 0;		// 
+		long long alloc_bytes = 0;		// ۼƷֽ
+		long long live_bytes = 0;		// ǰռõֽ
+		long long snapshot_bytes = 0;	// һSnapshotʱռõֽ
+	};
+
+	struct BlockInfo
+	{
+		int site = 0;
+		size_t size = 0;
+	};
+
+private:
+	CarpLuaAllocatorPtr m_inner;
+	int m_hook_count = 100;
+	bool m_enable = false;
+
+	int m_cur_site = 0;
+	std::unordered_map<SiteKey, int, SiteKeyHash> m_site_map;
+	std::vector<SiteInfo> m_site_list;
+	std::unordered_map<void*, BlockInfo> m_block_map;
+	long long m_snapshot_bytes = 0;
+};
+
+/* eg. ܼĸأȽĬϷͶطGCͣ
+	static void BenchLuaAlloc(const CarpLuaAllocatorPtr& allocator)
+	{
+		CarpScript script;
+		script.Init(allocator);
+		const char* code =
+			"local list = {}\n"
+			"local start = os.clock()\n"
+			"for i = 1, 2000000 do\n"
+			"	list[i % 50000 + 1] = { id = i, name = 'item' .. (i % 1000), pos = { x = i, y = i * 2 } }\n"
+			"end\n"
+			"local work = os.clock() - start\n"
+			"start = os.clock()\n"
+			"collectgarbage('collect')\n"
+			"print(string.format('work:%.3fs full_gc:%.3fms mem:%.1fMB', work, (os.clock() - start) * 1000, collectgarbage('count') / 1024))\n";
+		script.RunScript(code, strlen(code), "bench");
+		CARP_INFO(allocator->Dump(10));
+		script.Release();
+	}
+
+	BenchLuaAlloc(std::make_shared<CarpLuaSystemAllocator>());
+	BenchLuaAlloc(std::make_shared<CarpLuaPoolAllocator>());
+	BenchLuaAlloc(std::make_shared<CarpLuaTrackAllocator>(std::make_shared<CarpLuaPoolAllocator>()));
+*/
+
+#endif
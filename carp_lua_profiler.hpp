@@ -3,10 +3,22 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <chrono>
 
 #include "carp_lua.hpp"
 #include "carp_script.hpp"
 
+// Сλintд֮ϲ۵ջ
+#define CARP_LUA_PROFILER_SAMPLE_BUFFER (1024 * 1024)
+// ÿβ¼ջ
+#define CARP_LUA_PROFILER_MAX_DEPTH 128
+
 class CarpLuaProfiler
 {
 public:
@@ -19,6 +31,7 @@ public:
 			.beginNamespace("carp")
 			.beginClass<CarpLuaProfiler>("CarpLuaProfiler")
 			.addCFunction("Start", &CarpLuaProfiler::Start)
+			.addCFunction("StartSample", &CarpLuaProfiler::StartSample)
 			.addFunction("Stop", &CarpLuaProfiler::Stop)
 			.endClass()
 			.endNamespace();
@@ -79,10 +92,71 @@ public:
 		return 1;
 	}
 
+	/* ģʽÿεúͷضĹ
+	 * ʱ̰߳ñǣcountÿִhook_countָһαǣбʱ¼һεջ
+	 * Stop֮file_pathд۵ջ(ֱӽflamegraph.pl)file_path.summaryдÿself/totalʱ
+	 * : script, file_path, interval_us(Ĭ10001kHz), hook_count(Ĭ1000)
+	 * ע: ִֻluaָʱŻʱͣCʱ㵽֮lua
+	 */
+	int StartSample(lua_State* l_state)
+	{
+		auto* script = luabridge::Stack<CarpScript*>::get(l_state, 2);
+		auto* file_path = luabridge::Stack<const char*>::get(l_state, 3);
+		if (script == nullptr || file_path == nullptr || m_cur_l != nullptr)
+		{
+			lua_pushboolean(l_state, 0);
+			return 1;
+		}
+
+		int interval_us = 1000;
+		if (lua_isnumber(l_state, 4)) interval_us = static_cast<int>(lua_tointeger(l_state, 4));
+		if (interval_us < 10) interval_us = 10;
+		int hook_count = 1000;
+		if (lua_isnumber(l_state, 5)) hook_count = static_cast<int>(lua_tointeger(l_state, 5));
+		if (hook_count < 1) hook_count = 1;
+
+		m_file_path = file_path;
+		m_sample_interval_us = interval_us;
+
+		m_function_map.clear();
+		m_function_list.clear();
+		m_folded_map.clear();
+		m_sample_buffer.resize(CARP_LUA_PROFILER_SAMPLE_BUFFER);
+		m_sample_used = 0;
+		m_sample_count = 0;
+		m_sample_pending.store(false, std::memory_order_relaxed);
+		GetSampleProfiler() = this;
+
+		m_global_l = script->GetLuaState();
+		lua_sethook(m_global_l, SampleHook, LUA_MASKCOUNT, hook_count);
+		m_cur_l = l_state;
+		lua_sethook(m_cur_l, SampleHook, LUA_MASKCOUNT, hook_count);
+
+		// ʱֻ߳ñǣջlua߳ȡ
+		m_sample_run.store(true, std::memory_order_relaxed);
+		m_sample_thread = std::thread([this]()
+		{
+			while (m_sample_run.load(std::memory_order_relaxed))
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(m_sample_interval_us));
+				m_sample_pending.store(true, std::memory_order_relaxed);
+			}
+		});
+
+		lua_pushboolean(l_state, 1);
+		return 1;
+	}
+
 	void Stop()
 	{
 		if (m_cur_l == nullptr) return;
 
+		if (m_sample_thread.joinable())
+		{
+			StopSample();
+			return;
+		}
+
 		lua_sethook(m_global_l, nullptr, 0, 0);
 		m_global_l = nullptr;
 		lua_sethook(m_cur_l, nullptr, 0, 0);
@@ -212,6 +286,41 @@ public:
 		}
 	}
 
+	void SampleHookImpl(lua_State* L)
+	{
+		// 󲿷ʱֻһζ
+		if (!m_sample_pending.load(std::memory_order_relaxed)) return;
+		m_sample_pending.store(false, std::memory_order_relaxed);
+
+		// ԤһջŲ¾Ⱥϲ
+		if (m_sample_used + CARP_LUA_PROFILER_MAX_DEPTH + 1 > m_sample_buffer.size()) FoldSamples();
+
+		// ʽΪ , ҶӺid, ..., id
+		const size_t head = m_sample_used++;
+		int depth = 0;
+		lua_Debug frame;
+		while (depth < CARP_LUA_PROFILER_MAX_DEPTH && lua_getstack(L, depth, &frame) != 0)
+		{
+			m_sample_buffer[m_sample_used++] = InternFunction(L, frame);
+			++depth;
+		}
+		m_sample_buffer[head] = depth;
+		++m_sample_count;
+	}
+
+	// 治ͨluaȫֱңluaֻڿִ߳
+	static CarpLuaProfiler*& GetSampleProfiler()
+	{
+		static thread_local CarpLuaProfiler* profiler = nullptr;
+		return profiler;
+	}
+
+	static void SampleHook(lua_State* L, lua_Debug* ar)
+	{
+		auto* profiler = GetSampleProfiler();
+		if (profiler) profiler->SampleHookImpl(L);
+	}
+
 	static void DebugHook(lua_State* L, lua_Debug* ar)
 	{
 		const auto ref = luabridge::getGlobal(L, "carp_CarpLuaProfiler");
@@ -219,6 +328,168 @@ public:
 		if (server) server->DebugHookImpl(L, ar);
 	}
 
+private:
+	struct CarpLuaFunctionKey
+	{
+		const void* ptr = nullptr;	// luasourceַĵַCǺַ
+		int line = 0;
+
+		bool operator == (const CarpLuaFunctionKey& key) const { return ptr == key.ptr && line == key.line; }
+	};
+
+	struct CarpLuaFunctionKeyHash
+	{
+		size_t operator()(const CarpLuaFunctionKey& key) const { return std::hash<const void*>()(key.ptr) ^ (static_cast<size_t>(key.line) * 0x9E3779B97F4A7C15ULL); }
+	};
+
+	struct CarpLuaFunctionInfo
+	{
+		std::string name;
+		std::string source;
+		int linedefined = 0;
+		long long self_count = 0;	// ջĲ
+		long long total_count = 0;	// ջĲ
+		long long mark = -1;		// ͳtotalʱֹݹظ
+	};
+
+	// ѺתΪidֻеһμʱȡ
+	int InternFunction(lua_State* L, lua_Debug& frame)
+	{
+		lua_getinfo(L, "S", &frame);
+
+		CarpLuaFunctionKey key;
+		key.line = frame.linedefined;
+		if (frame.what != nullptr && frame.what[0] == 'C')
+		{
+			lua_getinfo(L, "f", &frame);
+			key.ptr = reinterpret_cast<const void*>(lua_tocfunction(L, -1));
+			lua_pop(L, 1);
+		}
+		else
+		{
+			// sourceluaڲַԭʹڵʱַ
+			key.ptr = frame.source;
+		}
+
+		auto it = m_function_map.find(key);
+		if (it != m_function_map.end()) return it->second;
+
+		lua_getinfo(L, "n", &frame);
+		CarpLuaFunctionInfo info;
+		if (frame.name != nullptr) info.name = frame.name;
+		else if (frame.what != nullptr && strcmp(frame.what, "main") == 0) info.name = "main";
+		else info.name = "unknown";
+		info.source = frame.source != nullptr ? frame.source : "unknown";
+		info.linedefined = frame.linedefined;
+
+		const int id = static_cast<int>(m_function_list.size());
+		m_function_list.emplace_back(std::move(info));
+		m_function_map.emplace(key, id);
+		return id;
+	}
+
+	// ѻĲϲ۵ջ
+	void FoldSamples()
+	{
+		size_t index = 0;
+		std::vector<int> stack;
+		while (index < m_sample_used)
+		{
+			const int depth = m_sample_buffer[index++];
+			// ۵ջӸҶ
+			stack.assign(m_sample_buffer.begin() + index, m_sample_buffer.begin() + index + depth);
+			std::reverse(stack.begin(), stack.end());
+			++m_folded_map[stack];
+			index += depth;
+		}
+		m_sample_used = 0;
+	}
+
+	void StopSample()
+	{
+		lua_sethook(m_global_l, nullptr, 0, 0);
+		m_global_l = nullptr;
+		lua_sethook(m_cur_l, nullptr, 0, 0);
+		m_cur_l = nullptr;
+
+		m_sample_run.store(false, std::memory_order_relaxed);
+		m_sample_thread.join();
+		GetSampleProfiler() = nullptr;
+
+		FoldSamples();
+
+		// ͳselftotal
+		long long sample_index = 0;
+		for (auto& pair : m_folded_map)
+		{
+			if (pair.first.empty()) continue;
+			m_function_list[pair.first.back()].self_count += pair.second;
+			for (int id : pair.first)
+			{
+				auto& info = m_function_list[id];
+				if (info.mark == sample_index) continue;
+				info.mark = sample_index;
+				info.total_count += pair.second;
+			}
+			++sample_index;
+		}
+
+		auto* file = CarpRWops::OpenFile(m_file_path, "wb");
+		if (file != nullptr)
+		{
+			std::string line;
+			for (auto& pair : m_folded_map)
+			{
+				line.clear();
+				for (size_t i = 0; i < pair.first.size(); ++i)
+				{
+					if (i > 0) line.push_back(';');
+					AppendFrameName(line, m_function_list[pair.first[i]]);
+				}
+				line.append(" ").append(std::to_string(pair.second)).append("\n");
+				SDL_RWwrite(file, line.c_str(), 1, line.size());
+			}
+			SDL_RWclose(file);
+		}
+
+		file = CarpRWops::OpenFile(m_file_path + ".summary", "wb");
+		if (file != nullptr)
+		{
+			std::vector<const CarpLuaFunctionInfo*> sort_list;
+			for (auto& info : m_function_list) sort_list.push_back(&info);
+			std::sort(sort_list.begin(), sort_list.end(), [](const CarpLuaFunctionInfo* a, const CarpLuaFunctionInfo* b) { return a->self_count > b->self_count; });
+
+			const double ms = m_sample_interval_us / 1000.0;
+			std::string desc = "samples:" + std::to_string(m_sample_count) + "\tinterval_us:" + std::to_string(m_sample_interval_us) + "\n";
+			desc += "self_ms\ttotal_ms\tself_count\ttotal_count\tname\tsource\tlinedefined\n";
+			SDL_RWwrite(file, desc.c_str(), 1, desc.size());
+			for (auto* info : sort_list)
+			{
+				desc = std::to_string(static_cast<long long>(info->self_count * ms)) + "\t" + std::to_string(static_cast<long long>(info->total_count * ms))
+					+ "\t" + std::to_string(info->self_count) + "\t" + std::to_string(info->total_count)
+					+ "\t" + info->name + "\t" + info->source + "\t" + std::to_string(info->linedefined) + "\n";
+				SDL_RWwrite(file, desc.c_str(), 1, desc.size());
+			}
+			SDL_RWclose(file);
+		}
+
+		m_function_map.clear();
+		m_function_list.clear();
+		m_folded_map.clear();
+		std::vector<int>().swap(m_sample_buffer);
+	}
+
+	// ۵ջʽ;ָ治ܳ;ͻ
+	static void AppendFrameName(std::string& line, const CarpLuaFunctionInfo& info)
+	{
+		const size_t start = line.size();
+		line.append(info.name).append(" (").append(info.source).append(":").append(std::to_string(info.linedefined)).append(")");
+		for (size_t i = start; i < line.size(); ++i)
+		{
+			if (line[i] == ';' || line[i] == '\n' || line[i] == '\r') line[i] = ' ';
+		}
+	}
+
 private:
 	static time_t GetCurTime() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count(); }
 
@@ -233,6 +504,19 @@ private:
 	std::vector<CarpLuaStack> m_stack;
 	size_t m_stack_size = 0;
 	std::unordered_map<std::string, std::unordered_map<int, CarpLuaRecordPtr>> m_record_map;
+
+private:
+	int m_sample_interval_us = 1000;				// 
+	std::atomic<bool> m_sample_pending{ false };	// ʱ߳ãȡջ֮
+	std::atomic<bool> m_sample_run{ false };		// ʱ߳Ƿ
+	std::thread m_sample_thread;					// ʱ߳
+	std::vector<int> m_sample_buffer;				// ԤĲ
+	size_t m_sample_used = 0;						// ѾʹõĴС
+	long long m_sample_count = 0;					// 
+
+	std::unordered_map<CarpLuaFunctionKey, int, CarpLuaFunctionKeyHash> m_function_map;	// id
+	std::vector<CarpLuaFunctionInfo> m_function_list;									// idϢ
+	std::map<std::vector<int>, long long> m_folded_map;									// ӸҶӵջ
 };
 
 #endif
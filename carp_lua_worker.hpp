@@ -19,21 +19,62 @@ extern "C" {
 #include "Carp/carp_rwops_bind.hpp"
 #include "Carp/carp_surface_bind.hpp"
 #include "Carp/carp_process_bind.hpp"
+#include "Carp/carp_spsc_queue.hpp"
 
 #include <thread>
 #include <mutex>
 #include <list>
 #include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <chrono>
+
+// ͨÿĲλ
+#ifndef CARP_LUA_WORKER_BINARY_CAPACITY
+#define CARP_LUA_WORKER_BINARY_CAPACITY 1024
+#endif
+
+// ͨһϢλڴһֱ
+struct CarpLuaWorkerBinary
+{
+    std::vector<char> memory;
+    CARP_MESSAGE_SIZE size = 0;
+    CARP_MESSAGE_ID id = 0;
+    CARP_MESSAGE_RPCID rpc_id = 0;
+};
+
+// Ͷݸ̵̵֧֧߳߳ȫֺname(payload)
+struct CarpLuaWorkerJob
+{
+    int job_id = 0;
+    std::string name;
+    std::string payload;
+    std::chrono::steady_clock::time_point post_time;
+};
+
+// resultluaĵһֵ
+struct CarpLuaWorkerJobResult
+{
+    int job_id = 0;
+    bool succeed = false;
+    std::string result;
+    long long latency_us = 0;   // Ͷݵִϣ΢
+};
 
 class CarpLuaWorker : public CarpScript
 {
 public:
-    CarpLuaWorker(const char* core_path, const char* std_path, const char* lua_path)
+    // chunk_cacheΪʱstateõֽ
+    CarpLuaWorker(const char* core_path, const char* std_path, const char* lua_path, const CarpScriptChunkCachePtr& chunk_cache = nullptr)
+        : m_binary_push(CARP_LUA_WORKER_BINARY_CAPACITY), m_binary_pull(CARP_LUA_WORKER_BINARY_CAPACITY)
     {
         // ·
         m_core_path = core_path;
         m_std_path = std_path;
         m_lua_path = lua_path;
+        m_chunk_cache = chunk_cache;
+        // ֪ͨ
+        m_notify = GetDefaultNotify();
         // Ϊִ
         m_run = true;
         // ̣߳ʼִ
@@ -53,18 +94,50 @@ public:
             .addConstructor<void(*)(const char*, const char*, const char*)>()
             .addFunction("Post", &CarpLuaWorker::PostToWorker)
             .addFunction("Pull", &CarpLuaWorker::Pull)
+            .addFunction("PostBinary", &CarpLuaWorker::PostBinaryToWorker)
+            .addFunction("PullBinary", &CarpLuaWorker::PullBinary)
             .addFunction("IsStopped", &CarpLuaWorker::IsStopped)
             .addFunction("Stop", &CarpLuaWorker::Stop)
+            .addFunction("SetUpdateInterval", &CarpLuaWorker::SetUpdateInterval)
             .endClass()
             .endNamespace();
     }
 
+public:
+    typedef std::function<void(CarpLuaWorker*)> NOTIFY_FUNC;
+
+    /* ֧߳нʱ֪֧ͨ߳ãֻͶݣ:
+     * CarpLuaWorker::SetDefaultNotify([](CarpLuaWorker* worker) { s_carp_schedule.Execute([]() { ... Pull ... }); });
+     * ̰߳PullPullBinaryPullJobȡûн֮ǰظ֪ͨ
+     */
+    static void SetDefaultNotify(const NOTIFY_FUNC& func) { GetDefaultNotify() = func; }
+    void SetNotify(const NOTIFY_FUNC& func)
+    {
+        std::unique_lock<std::mutex> lock(m_pull_mutex);
+        m_notify = func;
+    }
+
+    // __ALITTLEAPI_WorkerUpdateļСڵ0ʾãֻϢʱ
+    void SetUpdateInterval(int interval_ms)
+    {
+        std::unique_lock<std::mutex> lock(m_push_mutex);
+        m_update_interval = interval_ms;
+        m_push_cv.notify_one();
+    }
+
 public:
     bool IsStopped() const
     {
         return m_thread == nullptr;
     }
 
+    // ȴ֧̼߳luaļ
+    void WaitReady()
+    {
+        std::unique_lock<std::mutex> lock(m_push_mutex);
+        m_ready_cv.wait(lock, [this]() { return m_ready || !m_run; });
+    }
+
     // ̴֧߳߳
     bool PostToWorker(const char* info)
     {
@@ -73,6 +146,8 @@ public:
         // ־ӵб
         std::unique_lock<std::mutex> lock(m_push_mutex);
         m_push_list.emplace_back(info);
+        // ֧߳
+        m_push_cv.notify_one();
 
         return true;
     }
@@ -80,8 +155,11 @@ public:
     // ֧߳߷
     bool PostToMain(const char* info)
     {
-        std::unique_lock<std::mutex> lock(m_pull_mutex);
-        m_pull_list.emplace_back(info);
+        {
+            std::unique_lock<std::mutex> lock(m_pull_mutex);
+            m_pull_list.emplace_back(info);
+        }
+        NotifyMain();
         return true;
     }
 
@@ -91,6 +169,8 @@ public:
         if (m_handle_list.empty())
         {
             std::unique_lock<std::mutex> lock(m_pull_mutex);
+            // ֮Ľ֪ͨ
+            m_notify_pending = false;
             m_handle_list.swap(m_pull_list);
         }
 
@@ -101,6 +181,113 @@ public:
         return m_temp.c_str();
     }
 
+public:
+    // ߳Ͷ̵֧߳ȫֺname(payload)һֵΪ
+    bool PostJob(int job_id, const char* name, const char* payload)
+    {
+        if (m_thread == nullptr) return false;
+
+        ++m_job_depth;
+        std::unique_lock<std::mutex> lock(m_push_mutex);
+        m_job_list.emplace_back();
+        CarpLuaWorkerJob& job = m_job_list.back();
+        job.job_id = job_id;
+        job.name = name;
+        job.payload = payload;
+        job.post_time = std::chrono::steady_clock::now();
+        m_push_cv.notify_one();
+        return true;
+    }
+
+    // ߳ȡûнʱfalse
+    bool PullJob(CarpLuaWorkerJobResult& result)
+    {
+        if (m_job_handle_list.empty())
+        {
+            std::unique_lock<std::mutex> lock(m_pull_mutex);
+            // ֮Ľ֪ͨ
+            m_notify_pending = false;
+            m_job_handle_list.swap(m_job_result_list);
+        }
+
+        if (m_job_handle_list.empty()) return false;
+
+        result = std::move(m_job_handle_list.front());
+        m_job_handle_list.pop_front();
+        return true;
+    }
+
+    // Ͷݻûִ
+    int GetJobDepth() const { return m_job_depth; }
+    // ִ
+    long long GetJobDoneCount() const { return m_job_done; }
+    // ƽʱһκʱͶݵִϣ
+    double GetJobAverageLatency() const
+    {
+        const long long done = m_job_done;
+        return done > 0 ? m_job_latency_total / 1000.0 / done : 0.0;
+    }
+    double GetJobLastLatency() const { return m_job_latency_last / 1000.0; }
+
+public:
+    /* ͨÿһߵߵ
+     * ͶʱCarpMessageWriteFactoryڴͲλڴ潻ûпҲûб
+     * λһùڴ滻ظfactoryдȶ֮ٷڴ
+     * շCarpMessageReadFactoryֱӶλڴ棬ų
+     * ̵ֻ߳luaPostBinary/PullBinary̵֧߳luaPostBinaryʱfalse
+     */
+
+    // ̴֧̣߳߳ɹ֮factoryգԼдһ
+    bool PostBinaryToWorker(CarpMessageWriteFactory* factory)
+    {
+        if (m_thread == nullptr || factory == nullptr) return false;
+        if (!PushBinary(m_binary_push, factory)) return false;
+
+        // ֧߳ڵȴʱҪ
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_worker_waiting.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<std::mutex> lock(m_push_mutex);
+            m_push_cv.notify_one();
+        }
+        return true;
+    }
+
+    // ̷֧߳߳
+    bool PostBinaryToMain(CarpMessageWriteFactory* factory)
+    {
+        if (factory == nullptr) return false;
+        if (!PushBinary(m_binary_pull, factory)) return false;
+        NotifyMain();
+        return true;
+    }
+
+    // ֧߳߳ȡصĶһεPullBinary֮ǰЧ
+    CarpMessageReadFactory* PullBinary()
+    {
+        // һηصϢѾ
+        if (m_binary_reading)
+        {
+            m_binary_reading = false;
+            m_pull_factory.Deserialize(nullptr, 0);
+            m_binary_pull.Pop();
+        }
+
+        CarpLuaWorkerBinary* binary = m_binary_pull.Front();
+        if (binary == nullptr)
+        {
+            // ֪ͨټһΣ©ͶݵϢ
+            m_notify_pending = false;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            binary = m_binary_pull.Front();
+            if (binary == nullptr) return nullptr;
+        }
+
+        m_binary_reading = true;
+        ReadBinary(*binary, m_pull_factory);
+        return &m_pull_factory;
+    }
+
     // ر
     void Stop()
     {
@@ -110,6 +297,8 @@ public:
         {
             std::unique_lock<std::mutex> lock(m_push_mutex);
             m_run = false;
+            m_push_cv.notify_all();
+            m_ready_cv.notify_all();
         }
         // ȴ߳
         m_thread->join();
@@ -123,6 +312,87 @@ public:
             Execute(m_push_list.front());
             m_push_list.pop_front();
         }
+
+        // ûִеֱӷʧ
+        while (!m_job_list.empty())
+        {
+            CarpLuaWorkerJobResult result;
+            result.job_id = m_job_list.front().job_id;
+            m_job_result_list.emplace_back(std::move(result));
+            m_job_list.pop_front();
+        }
+        m_job_depth = 0;
+
+        // һηصϢѾ꣬PullBinaryһӣ´PullBinaryظ
+        if (m_binary_reading)
+        {
+            m_binary_reading = false;
+            m_pull_factory.Deserialize(nullptr, 0);
+            m_binary_pull.Pop();
+        }
+        // ϢѾûнշ
+        while (m_binary_push.Front() != nullptr) m_binary_push.Pop();
+    }
+
+private:
+    // factoryڴ滻λ
+    static bool PushBinary(CarpSpscQueue<CarpLuaWorkerBinary>& queue, CarpMessageWriteFactory* factory)
+    {
+        CarpLuaWorkerBinary* binary = queue.BeginPush();
+        if (binary == nullptr) return false;
+
+        binary->memory.swap(factory->m_memory);
+        binary->size = factory->m_size;
+        binary->id = factory->GetID();
+        binary->rpc_id = factory->GetRpcID();
+        queue.EndPush();
+
+        factory->ResetOffset();
+        factory->SetID(0);
+        factory->SetRpcID(0);
+        return true;
+    }
+
+    // factoryֱӶλڴ
+    static void ReadBinary(const CarpLuaWorkerBinary& binary, CarpMessageReadFactory& factory)
+    {
+        factory.Deserialize(binary.memory.data(), binary.size);
+        factory.SetID(binary.id);
+        factory.SetRpcID(binary.rpc_id);
+    }
+
+    // ִ񲢰ѽ߳
+    void ExecuteJob(const CarpLuaWorkerJob& job)
+    {
+        CarpLuaWorkerJobResult result;
+        result.job_id = job.job_id;
+        result.succeed = InvokeForString(job.name.c_str(), result.result, job.payload.c_str());
+        result.latency_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - job.post_time).count();
+
+        m_job_latency_total += result.latency_us;
+        m_job_latency_last = result.latency_us;
+        ++m_job_done;
+        --m_job_depth;
+
+        {
+            std::unique_lock<std::mutex> lock(m_pull_mutex);
+            m_job_result_list.emplace_back(std::move(result));
+        }
+        NotifyMain();
+    }
+
+    // ش߳ȡ֮ǰֻ֪ͨһ
+    void NotifyMain()
+    {
+        if (m_notify_pending.exchange(true)) return;
+
+        NOTIFY_FUNC notify;
+        {
+            std::unique_lock<std::mutex> lock(m_pull_mutex);
+            notify = m_notify;
+        }
+        if (notify) notify(this);
+        else m_notify_pending = false;
     }
 
 private:
@@ -150,6 +420,7 @@ private:
             .beginNamespace("carp")
             .beginClass<CarpLuaWorker>("CarpLuaWorker")
             .addFunction("Post", &CarpLuaWorker::PostToMain)
+            .addFunction("PostBinary", &CarpLuaWorker::PostBinaryToMain)
             .endClass()
             .endNamespace();
 
@@ -166,19 +437,50 @@ private:
         // luaļ
         Require(m_lua_path.c_str());
 
-        // ȡһ¼
-        auto last_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        // ÿ֡õĺã֮ÿһּһȫֺûбȸ滻
+        m_message_ref = RefFunction("__ALITTLEAPI_WorkerMessage");
+        m_binary_ref = RefFunction("__ALITTLEAPI_WorkerBinaryMessage");
+        m_update_ref = RefFunction("__ALITTLEAPI_WorkerUpdate");
+
+        // ֪ͨ
+        {
+            std::unique_lock<std::mutex> lock(m_push_mutex);
+            m_ready = true;
+            m_ready_cv.notify_all();
+        }
+
+        // ȡһʱ
+        auto last_time = std::chrono::steady_clock::now();
 
         // ʱб
         std::list<std::string> temp_list;
+        std::list<CarpLuaWorkerJob> temp_job_list;
         while (m_run)
         {
-            // ȡִж
+            // ȴϢһθ£Ϣʱ
+            int interval = 0;
             {
                 std::unique_lock<std::mutex> lock(m_push_mutex);
+                interval = m_update_interval;
+                // ȱڵȴټƶУPostBinaryToWorkerϲ©
+                m_worker_waiting = true;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto ready = [this]() { return !m_run || !m_push_list.empty() || !m_job_list.empty() || !m_binary_push.IsEmpty(); };
+                if (interval > 0)
+                    m_push_cv.wait_until(lock, last_time + std::chrono::milliseconds(interval), ready);
+                else
+                    m_push_cv.wait(lock, ready);
+                m_worker_waiting = false;
+                interval = m_update_interval;
                 temp_list.swap(m_push_list);
+                temp_job_list.swap(m_job_list);
             }
 
+            // һֵlua¸ֵЩȫֺȸ£øŻµĺ
+            RefreshFunction(m_message_ref, "__ALITTLEAPI_WorkerMessage");
+            RefreshFunction(m_binary_ref, "__ALITTLEAPI_WorkerBinaryMessage");
+            RefreshFunction(m_update_ref, "__ALITTLEAPI_WorkerUpdate");
+
             // ʼִ
             while (!temp_list.empty())
             {
@@ -186,13 +488,36 @@ private:
                 temp_list.pop_front();
             }
 
-            auto cur_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-            Invoke("__ALITTLEAPI_WorkerUpdate", cur_time - last_time);
-            last_time = cur_time;
+            // ִ
+            while (!temp_job_list.empty())
+            {
+                ExecuteJob(temp_job_list.front());
+                temp_job_list.pop_front();
+            }
+
+            // ִжϢlua֮ųӣԲҪ
+            while (CarpLuaWorkerBinary* binary = m_binary_push.Front())
+            {
+                ReadBinary(*binary, m_push_factory);
+                if (m_binary_ref != LUA_NOREF) InvokeRef(m_binary_ref, &m_push_factory);
+                else Invoke("__ALITTLEAPI_WorkerBinaryMessage", &m_push_factory);
+                m_push_factory.Deserialize(nullptr, 0);
+                m_binary_push.Pop();
+            }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            if (interval <= 0) continue;
+            auto cur_time = std::chrono::steady_clock::now();
+            if (cur_time - last_time < std::chrono::milliseconds(interval)) continue;
+            const auto delta_time = std::chrono::duration_cast<std::chrono::milliseconds>(cur_time - last_time).count();
+            if (m_update_ref != LUA_NOREF) InvokeRef(m_update_ref, delta_time);
+            else Invoke("__ALITTLEAPI_WorkerUpdate", delta_time);
+            last_time = cur_time;
         }
 
+        // ølua_Stateһͷ
+        m_message_ref = LUA_NOREF;
+        m_binary_ref = LUA_NOREF;
+        m_update_ref = LUA_NOREF;
         Release();
         return 0;
     }
@@ -201,24 +526,60 @@ protected:
     // ִ־
     void Execute(const std::string& info)
     {
-        Invoke("__ALITTLEAPI_WorkerMessage", info.c_str());
+        if (m_message_ref != LUA_NOREF) InvokeRef(m_message_ref, info.c_str());
+        else Invoke("__ALITTLEAPI_WorkerMessage", info.c_str());
     }
 
 private:
     std::mutex m_push_mutex;                 // 
+    std::condition_variable m_push_cv;      // Ϣʱ֧߳
     std::list<std::string> m_push_list;	// ȴ־б
+    int m_update_interval = 20;         // ¼
+    std::list<CarpLuaWorkerJob> m_job_list; // ȴִе
+    std::condition_variable m_ready_cv;     // ʱ
+    bool m_ready = false;               // luaļѾ
 
 private:
     std::mutex m_pull_mutex;            // 
     std::list<std::string> m_pull_list; // ȡб
     std::list<std::string> m_handle_list;   // б
     std::string m_temp;                 // ʱַ
+    std::list<CarpLuaWorkerJobResult> m_job_result_list;    // 
+    std::list<CarpLuaWorkerJobResult> m_job_handle_list;    // е
+    NOTIFY_FUNC m_notify;               // нʱ֪ͨ߳
+    std::atomic<bool> m_notify_pending{ false };    // Ѿ֪̻ͨ߳ûȡ
+
+private:
+    CarpSpscQueue<CarpLuaWorkerBinary> m_binary_push;   // ̵֧߳߳
+    CarpSpscQueue<CarpLuaWorkerBinary> m_binary_pull;   // ̵֧߳߳
+    CarpMessageReadFactory m_push_factory;  // ̶֧߳Ϣ
+    CarpMessageReadFactory m_pull_factory;  // ̶߳Ϣ
+    bool m_binary_reading = false;      // ߳ڶͷϢ
+
+private:
+    std::atomic<int> m_job_depth{ 0 };              // ûִ
+    std::atomic<long long> m_job_done{ 0 };         // ִ
+    std::atomic<long long> m_job_latency_total{ 0 };    // ܺʱ΢
+    std::atomic<long long> m_job_latency_last{ 0 };     // һκʱ΢
+    std::atomic<bool> m_worker_waiting{ false };    // ֧߳ڵȴ
 
 private:
     std::string m_core_path;        // Ŀ·
     std::string m_std_path;         // ׼·
     std::string m_lua_path;     // luaļ
 
+private:
+    int m_message_ref = LUA_NOREF;  // __ALITTLEAPI_WorkerMessage
+    int m_binary_ref = LUA_NOREF;   // __ALITTLEAPI_WorkerBinaryMessage
+    int m_update_ref = LUA_NOREF;   // __ALITTLEAPI_WorkerUpdate
+
+private:
+    static NOTIFY_FUNC& GetDefaultNotify()
+    {
+        static NOTIFY_FUNC func;
+        return func;
+    }
+
 private:
     volatile bool m_run = false;	// ֧߳Ƿִ
     std::thread* m_thread = nullptr;	// ̶߳
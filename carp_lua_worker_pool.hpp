@@ -0,0 +1,181 @@
+#ifndef CARP_LUA_WORKER_POOL_INCLUDED
+#define CARP_LUA_WORKER_POOL_INCLUDED
+
+#include "Carp/carp_lua_worker.hpp"
+
+#include <vector>
+#include <climits>
+
+/* ͬCarpLuaWorkerɵ̳߳
+ * һworker֮workerֱӼõֽ
+ * ָcache_dirʱֽͬʱ浽̣´һworkerҲñ
+ * ߳Post(name, payload)ͶѡŶٵworkerִȫֺname(payload)
+ * PullȡͨGetResultXXXȡPullfalseʾʱûн
+ * :
+ * local pool = carp.CarpLuaWorkerPool(core_path, std_path, lua_path, 4, cache_dir)
+ * local job_id = pool:Post("FindPath", payload)
+ * while pool:Pull() do
+ *     local job_id, result = pool:GetResultJobID(), pool:GetResult()
+ * end
+ */
+class CarpLuaWorkerPool
+{
+public:
+    CarpLuaWorkerPool(const char* core_path, const char* std_path, const char* lua_path, int count, const char* cache_dir = nullptr)
+    {
+        if (count <= 0) count = 1;
+        m_chunk_cache = std::make_shared<CarpScriptChunkCache>(cache_dir != nullptr ? cache_dir : "");
+
+        // õһworkerѽűһ飬ʱȴ
+        m_workers.push_back(new CarpLuaWorker(core_path, std_path, lua_path, m_chunk_cache));
+        m_workers.front()->WaitReady();
+        for (int i = 1; i < count; ++i)
+            m_workers.push_back(new CarpLuaWorker(core_path, std_path, lua_path, m_chunk_cache));
+    }
+
+    ~CarpLuaWorkerPool()
+    {
+        Stop();
+        for (auto* worker : m_workers) delete worker;
+        m_workers.clear();
+    }
+
+    static void Bind(lua_State* l_state)
+    {
+        luabridge::getGlobalNamespace(l_state)
+            .beginNamespace("carp")
+            .beginClass<CarpLuaWorkerPool>("CarpLuaWorkerPool")
+            .addConstructor<void(*)(const char*, const char*, const char*, int, const char*)>()
+            .addFunction("Post", &CarpLuaWorkerPool::Post)
+            .addFunction("Pull", &CarpLuaWorkerPool::Pull)
+            .addFunction("GetResultJobID", &CarpLuaWorkerPool::GetResultJobID)
+            .addFunction("GetResult", &CarpLuaWorkerPool::GetResult)
+            .addFunction("IsResultSucceed", &CarpLuaWorkerPool::IsResultSucceed)
+            .addFunction("GetResultWorker", &CarpLuaWorkerPool::GetResultWorker)
+            .addFunction("GetResultLatency", &CarpLuaWorkerPool::GetResultLatency)
+            .addFunction("GetWorkerCount", &CarpLuaWorkerPool::GetWorkerCount)
+            .addFunction("GetQueueDepth", &CarpLuaWorkerPool::GetQueueDepth)
+            .addFunction("GetTotalQueueDepth", &CarpLuaWorkerPool::GetTotalQueueDepth)
+            .addFunction("GetDoneCount", &CarpLuaWorkerPool::GetDoneCount)
+            .addFunction("GetAverageLatency", &CarpLuaWorkerPool::GetAverageLatency)
+            .addFunction("GetLastLatency", &CarpLuaWorkerPool::GetLastLatency)
+            .addFunction("IsStopped", &CarpLuaWorkerPool::IsStopped)
+            .addFunction("Stop", &CarpLuaWorkerPool::Stop)
+            .endClass()
+            .endNamespace();
+    }
+
+public:
+    // workerнʱ֪ͨCarpLuaWorker::SetNotifyһ߳Pullfalse֮ǰظ֪ͨ
+    void SetNotify(const std::function<void(CarpLuaWorkerPool*)>& func)
+    {
+        for (auto* worker : m_workers)
+        {
+            if (func) worker->SetNotify([this, func](CarpLuaWorker*) { func(this); });
+            else worker->SetNotify(nullptr);
+        }
+    }
+
+public:
+    // Ͷ񣬷IDʧܷ0
+    int Post(const char* name, const char* payload)
+    {
+        if (m_workers.empty() || name == nullptr) return 0;
+        if (payload == nullptr) payload = "";
+
+        // ѡŶٵģһʱһѡеһʼѡͬһ
+        const size_t count = m_workers.size();
+        size_t best = 0;
+        int best_depth = INT_MAX;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t index = (m_post_next + i) % count;
+            const int depth = m_workers[index]->GetJobDepth();
+            if (depth >= best_depth) continue;
+            best = index;
+            best_depth = depth;
+            if (depth == 0) break;
+        }
+        m_post_next = best + 1;
+
+        ++m_job_id;
+        if (m_job_id <= 0) m_job_id = 1;
+        if (!m_workers[best]->PostJob(m_job_id, name, payload)) return 0;
+        return m_job_id;
+    }
+
+    // ȡһ
+    bool Pull()
+    {
+        const size_t count = m_workers.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t index = (m_pull_next + i) % count;
+            if (!m_workers[index]->PullJob(m_result)) continue;
+            m_result_worker = static_cast<int>(index);
+            m_pull_next = index + 1;
+            return true;
+        }
+        return false;
+    }
+
+    int GetResultJobID() const { return m_result.job_id; }
+    const char* GetResult() const { return m_result.result.c_str(); }
+    bool IsResultSucceed() const { return m_result.succeed; }
+    int GetResultWorker() const { return m_result_worker; }
+    // Ͷݵִϣ
+    double GetResultLatency() const { return m_result.latency_us / 1000.0; }
+
+public:
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+    // index0ʼ
+    int GetQueueDepth(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(m_workers.size())) return 0;
+        return m_workers[index]->GetJobDepth();
+    }
+    int GetTotalQueueDepth() const
+    {
+        int depth = 0;
+        for (auto* worker : m_workers) depth += worker->GetJobDepth();
+        return depth;
+    }
+    double GetDoneCount(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(m_workers.size())) return 0;
+        return static_cast<double>(m_workers[index]->GetJobDoneCount());
+    }
+    double GetAverageLatency(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(m_workers.size())) return 0;
+        return m_workers[index]->GetJobAverageLatency();
+    }
+    double GetLastLatency(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(m_workers.size())) return 0;
+        return m_workers[index]->GetJobLastLatency();
+    }
+
+public:
+    bool IsStopped() const { return m_workers.empty() || m_workers.front()->IsStopped(); }
+
+    // رworkerûִеʧܵĽ
+    void Stop()
+    {
+        for (auto* worker : m_workers) worker->Stop();
+    }
+
+private:
+    std::vector<CarpLuaWorker*> m_workers;
+    CarpScriptChunkCachePtr m_chunk_cache;  // workerֽ
+
+    int m_job_id = 0;               // ID
+    size_t m_post_next = 0;         // һͶݴworkerʼ
+    size_t m_pull_next = 0;         // һȡworkerʼ
+
+    CarpLuaWorkerJobResult m_result;    // ǰ
+    int m_result_worker = -1;           // ǰĸworker
+};
+
+#endif
@@ -24,10 +24,168 @@
 #include<numeric>
 #include<complex>
 #include<vector>
-#include<map>
+#include<fstream>
+#include<sstream>
+#include<string>
+#include<cstdint>
 #include<math.h>
 
-class CarpMFCC
+// In-place iterative FFT of a real signal of n points (n is a power of 2).
+// The signal is packed into n/2 complex points, transformed with radix-4
+// butterflies (plus one radix-2 pass when log2(n/2) is odd), and then split
+// into the n/2+1 bins of the real spectrum. Real and imaginary parts are kept
+// in separate arrays so the butterfly loops vectorize. Bit-reversal and
+// twiddle tables are computed once in init(), so a transform never allocates.
+template <typename T>
+class CarpRealFFTTemplate
+{
+public:
+    typedef std::complex<T> c_t;
+
+    CarpRealFFTTemplate(size_t n = 0) { init(n); }
+
+    void init(size_t n) {
+        numPoints = n;
+        half = n / 2;
+        re.assign(half, 0);
+        im.assign(half, 0);
+        reverse.assign(half, 0);
+        stageTwiddle.clear();
+        splitRe.assign(half + 1, 0);
+        splitIm.assign(half + 1, 0);
+        if (half == 0)
+            return;
+
+        int bits = 0;
+        while (((size_t)1 << bits) < half)
+            bits++;
+        for (size_t i = 0; i < half; i++) {
+            size_t r = 0;
+            for (int b = 0; b < bits; b++)
+                if (i & ((size_t)1 << b))
+                    r |= (size_t)1 << (bits - 1 - b);
+            reverse[i] = r;
+        }
+
+        // Radix-4 passes merge four sub-transforms of length L into one of
+        // length 4L, each butterfly needs W(2L)^j and W(4L)^j.
+        // Every pass stores cos and sin of both twiddles, L values each
+        const double PI = 4*atan(1.0);
+        firstLength = bits % 2 ? 2 : 1;
+        for (size_t L = firstLength; L * 4 <= half; L *= 4) {
+            for (size_t j = 0; j < L; j++)
+                stageTwiddle.push_back((T)cos(PI * j / L));
+            for (size_t j = 0; j < L; j++)
+                stageTwiddle.push_back((T)-sin(PI * j / L));
+            for (size_t j = 0; j < L; j++)
+                stageTwiddle.push_back((T)cos(PI * j / (2 * L)));
+            for (size_t j = 0; j < L; j++)
+                stageTwiddle.push_back((T)-sin(PI * j / (2 * L)));
+        }
+
+        for (size_t k = 0; k <= half; k++) {
+            splitRe[k] = (T)cos(2 * PI * k / n);
+            splitIm[k] = (T)-sin(2 * PI * k / n);
+        }
+    }
+
+    size_t size() const { return numPoints; }
+
+    // Spectrum of in[0..n), out receives the n/2+1 bins
+    void forward(const T* in, c_t* out) {
+        transform(in);
+        for (size_t k = 0; k <= half; k++) {
+            T xr, xi;
+            split(k, xr, xi);
+            out[k] = c_t(xr, xi);
+        }
+    }
+
+    // Power spectrum |X[k]|^2 of in[0..n), out receives the n/2+1 bins
+    void power(const T* in, T* out) {
+        transform(in);
+        for (size_t k = 0; k <= half; k++) {
+            T xr, xi;
+            split(k, xr, xi);
+            out[k] = xr * xr + xi * xi;
+        }
+    }
+
+private:
+    // Complex FFT of the packed signal, the result stays in re and im
+    void transform(const T* in) {
+        T* zr = re.data();
+        T* zi = im.data();
+
+        // Pack even samples as real part and odd samples as imaginary part,
+        // and store them in bit-reversed order
+        for (size_t i = 0; i < half; i++) {
+            zr[reverse[i]] = in[2 * i];
+            zi[reverse[i]] = in[2 * i + 1];
+        }
+
+        // Radix-2 pass when the number of passes is odd
+        if (firstLength == 2)
+            for (size_t i = 0; i < half; i += 2) {
+                T ar = zr[i], ai = zi[i], br = zr[i + 1], bi = zi[i + 1];
+                zr[i] = ar + br;
+                zi[i] = ai + bi;
+                zr[i + 1] = ar - br;
+                zi[i + 1] = ai - bi;
+            }
+
+        // Radix-4 passes
+        const T* tw = stageTwiddle.data();
+        for (size_t L = firstLength; L * 4 <= half; L *= 4) {
+            const T* w1r = tw;
+            const T* w1i = tw + L;
+            const T* w2r = tw + 2 * L;
+            const T* w2i = tw + 3 * L;
+            for (size_t base = 0; base < half; base += 4 * L) {
+                T* r0 = zr + base; T* r1 = r0 + L; T* r2 = r1 + L; T* r3 = r2 + L;
+                T* i0 = zi + base; T* i1 = i0 + L; T* i2 = i1 + L; T* i3 = i2 + L;
+                for (size_t j = 0; j < L; j++) {
+                    // a1 = w1 * x1, a3 = w1 * x3
+                    const T a1r = w1r[j] * r1[j] - w1i[j] * i1[j], a1i = w1r[j] * i1[j] + w1i[j] * r1[j];
+                    const T a3r = w1r[j] * r3[j] - w1i[j] * i3[j], a3i = w1r[j] * i3[j] + w1i[j] * r3[j];
+                    const T b0r = r0[j] + a1r, b0i = i0[j] + a1i;
+                    const T b1r = r0[j] - a1r, b1i = i0[j] - a1i;
+                    const T c0r = r2[j] + a3r, c0i = i2[j] + a3i;
+                    const T c1r = r2[j] - a3r, c1i = i2[j] - a3i;
+                    // b2 = w2 * c0, b3 = -j * w2 * c1
+                    const T b2r = w2r[j] * c0r - w2i[j] * c0i, b2i = w2r[j] * c0i + w2i[j] * c0r;
+                    const T b3r = w2r[j] * c1i + w2i[j] * c1r, b3i = w2i[j] * c1i - w2r[j] * c1r;
+                    r0[j] = b0r + b2r; i0[j] = b0i + b2i;
+                    r2[j] = b0r - b2r; i2[j] = b0i - b2i;
+                    r1[j] = b1r + b3r; i1[j] = b1i + b3i;
+                    r3[j] = b1r - b3r; i3[j] = b1i - b3i;
+                }
+            }
+            tw += 4 * L;
+        }
+    }
+
+    // Bin k of the real spectrum from the packed complex spectrum
+    // X[k] = (Z[k] + conj(Z[N-k])) / 2 - j * W^k * (Z[k] - conj(Z[N-k])) / 2
+    void split(size_t k, T& xr, T& xi) const {
+        const size_t a = k == half ? 0 : k, b = k == 0 ? 0 : half - k;
+        const T er = (re[a] + re[b]) * (T)0.5, ei = (im[a] - im[b]) * (T)0.5;
+        const T orr = (im[a] + im[b]) * (T)0.5, oi = (re[b] - re[a]) * (T)0.5;
+        xr = er + splitRe[k] * orr - splitIm[k] * oi;
+        xi = ei + splitRe[k] * oi + splitIm[k] * orr;
+    }
+
+private:
+    size_t numPoints = 0, half = 0, firstLength = 1;
+    std::vector<T> re, im, stageTwiddle, splitRe, splitIm;
+    std::vector<size_t> reverse;
+};
+
+using CarpRealFFT = CarpRealFFTTemplate<double>;
+using CarpRealFFTF = CarpRealFFTTemplate<float>;
+
+template <typename T>
+class CarpMFCCTemplate
 {
 public:
     struct wavHeader {
@@ -49,20 +207,22 @@ public:
         uint32_t        Subchunk2Size;  // Sampled data length
     };
 
-    typedef std::vector<double> v_d;
-    typedef std::complex<double> c_d;
+    typedef std::vector<T> v_d;
+    typedef std::complex<T> c_d;
     typedef std::vector<v_d> m_d;
     typedef std::vector<c_d> v_c_d;
-    typedef std::map<int, std::map<int, c_d> > twmap;
 
 private:
     const double PI = 4*atan(1.0);   // Pi = 3.14...
     int fs;
-    twmap twiddle;
+    CarpRealFFTTemplate<T> fft;
     size_t winLengthSamples, frameShiftSamples, numCepstra, numFFT, numFFTBins, numFilters;
     double preEmphCoef, lowFreq, highFreq;
-    v_d frame, powerSpectralCoef, lmfbCoef, hamming, mfcc, prevsamples;
-    m_d fbank, dct;
+    v_d frame, fftInput, powerSpectralCoef, lmfbCoef, hamming, mfcc, prevsamples;
+    // Filters only cover a narrow band of bins, so each one keeps its first bin
+    // and its non-zero weights, all weights are stored back to back in fbank
+    v_d fbank, dct;
+    std::vector<size_t> fbankBegin, fbankCount, fbankOffset;
 
 private:
     // Hertz to Mel conversion
@@ -75,112 +235,81 @@ private:
         return 700*(std::pow(10,m/2595)-1);
     }
 
-    // Twiddle factor computation
-    void compTwiddle(void) {
-        const c_d J(0,1);      // Imaginary number 'j'
-        for (int N=2; N<=numFFT; N*=2)
-            for (int k=0; k<=N/2-1; k++)
-                twiddle[N][k] = exp(-2*PI*k/N*J);
-    }
-    
-    // Cooley-Tukey DIT-FFT recursive function
-    v_c_d fft(v_c_d x) {
-        int N = x.size();
-        if (N==1)
-            return x;
-    
-        v_c_d xe(N/2,0), xo(N/2,0), Xjo, Xjo2;
-        int i;
-    
-        // Construct arrays from even and odd indices
-        for (i=0; i<N; i+=2)
-            xe[i/2] = x[i];
-        for (i=1; i<N; i+=2)
-            xo[(i-1)/2] = x[i];
-    
-        // Compute N/2-point FFT
-        Xjo = fft(xe);
-        Xjo2 = fft(xo);
-        Xjo.insert (Xjo.end(), Xjo2.begin(), Xjo2.end());
-    
-        // Butterfly computations
-        for (i=0; i<=N/2-1; i++) {
-            c_d t = Xjo[i], tw = twiddle[N][i];
-            Xjo[i] = t + tw * Xjo[i+N/2];
-            Xjo[i+N/2] = t - tw * Xjo[i+N/2];
+    // Dot product with four partial sums, which the compiler can keep in vector registers
+    static T dot(const T* a, const T* b, size_t n) {
+        T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            s0 += a[i] * b[i];
+            s1 += a[i+1] * b[i+1];
+            s2 += a[i+2] * b[i+2];
+            s3 += a[i+3] * b[i+3];
         }
-        return Xjo;
+        for (; i < n; i++)
+            s0 += a[i] * b[i];
+        return (s0 + s1) + (s2 + s3);
     }
 
     //// Frame processing routines
-    // Pre-emphasis and Hamming window
-    void preEmphHam(void) {
-        v_d procFrame(frame.size(), hamming[0]*frame[0]);
-        for (int i=1; i<frame.size(); i++)
-            procFrame[i] = hamming[i] * (frame[i] - preEmphCoef * frame[i-1]);
-        frame = procFrame;
+    // Pre-emphasis and Hamming window, the result is zero padded to numFFT
+    template <typename S>
+    void preEmphHam(const S* samples, size_t N) {
+        N = std::min(N, std::min(hamming.size(), numFFT));
+        T* out = fftInput.data();
+        if (N > 0)
+            out[0] = hamming[0] * (T)samples[0];
+        for (size_t i=1; i<N; i++)
+            out[i] = hamming[i] * ((T)samples[i] - (T)preEmphCoef * (T)samples[i-1]);
+        std::fill(out + N, out + numFFT, (T)0);
     }
 
     // Power spectrum computation
     void computePowerSpec(void) {
-        frame.resize(numFFT); // Pads zeros
-        v_c_d framec (frame.begin(), frame.end()); // Complex frame
-        v_c_d fftc = fft(framec);
-    
-        for (int i=0; i<numFFTBins; i++)
-            powerSpectralCoef[i] = pow(abs(fftc[i]),2);
+        fft.power(fftInput.data(), powerSpectralCoef.data());
     }
 
     // Applying log Mel filterbank (LMFB)
     void applyLMFB(void) {
-        lmfbCoef.assign(numFilters,0);
-        
-        for (int i=0; i<numFilters; i++) {
-            // Multiply the filterbank matrix
-            for (int j=0; j<fbank[i].size(); j++)
-                lmfbCoef[i] += fbank[i][j] * powerSpectralCoef[j];
+        for (size_t i=0; i<numFilters; i++) {
+            // Multiply the non-zero band of the filter
+            T value = dot(fbank.data() + fbankOffset[i], powerSpectralCoef.data() + fbankBegin[i], fbankCount[i]);
             // Apply Mel-flooring
-            if (lmfbCoef[i] < 1.0)
-                lmfbCoef[i] = 1.0;
+            if (value < 1.0)
+                value = 1.0;
+            // Applying log on amplitude
+            lmfbCoef[i] = std::log (value);
         }
-        
-        // Applying log on amplitude
-        for (int i=0; i<numFilters; i++)
-            lmfbCoef[i] = std::log (lmfbCoef[i]);
     }
-    
+
     // Computing discrete cosine transform
-    void applyDct(void) {
-        mfcc.assign(numCepstra+1,0);
-        for (int i=0; i<=numCepstra; i++) {
-            for (int j=0; j<numFilters; j++)
-                mfcc[i] += dct[i][j] * lmfbCoef[j];
-        }
+    void applyDct(T* out) {
+        for (size_t i=0; i<=numCepstra; i++)
+            out[i] = dot(dct.data() + i*numFilters, lmfbCoef.data(), numFilters);
     }
-   
+
+    // Full pipeline for one frame of samples, out receives numCepstra+1 values
+    template <typename S>
+    void extract(const S* samples, size_t N, T* out) {
+        preEmphHam(samples, N);
+        computePowerSpec();
+        applyLMFB();
+        applyDct(out);
+    }
+
     // Initialisation routines
     // Pre-computing Hamming window and dct matrix
     void initHamDct(void) {
-        int i, j;
+        size_t i, j;
 
         hamming.assign(winLengthSamples,0);
         for (i=0; i<winLengthSamples; i++)
             hamming[i] = 0.54 - 0.46 * cos(2 * PI * i / (winLengthSamples-1));
 
-        v_d v1(numCepstra+1,0), v2(numFilters,0);
-        for (i=0; i <= numCepstra; i++)
-            v1[i] = i;
-        for (i=0; i < numFilters; i++)
-            v2[i] = i + 0.5;
-
-        dct.reserve (numFilters*(numCepstra+1));        
+        dct.assign(numFilters*(numCepstra+1), 0);
         double c = sqrt(2.0/numFilters);
-        for (i=0; i<=numCepstra; i++) {
-            v_d dtemp;
+        for (i=0; i<=numCepstra; i++)
             for (j=0; j<numFilters; j++)
-                dtemp.push_back (c * cos(PI / numFilters * v1[i] * v2[j]));
-            dct.push_back(dtemp);
-        }
+                dct[i*numFilters+j] = c * cos(PI / numFilters * i * (j + 0.5));
     }
 
     // Precompute filterbank
@@ -190,24 +319,25 @@ private:
         double highFreqMel = hz2mel (highFreq);
 
         // Calculate filter centre-frequencies
-        v_d filterCentreFreq;
+        std::vector<double> filterCentreFreq;
         filterCentreFreq.reserve (numFilters+2);
-        for (int i=0; i<numFilters+2; i++)
+        for (size_t i=0; i<numFilters+2; i++)
             filterCentreFreq.push_back (mel2hz(lowFreqMel + (highFreqMel-lowFreqMel)/(numFilters+1)*i));
 
         // Calculate FFT bin frequencies
-        v_d fftBinFreq;
+        std::vector<double> fftBinFreq;
         fftBinFreq.reserve(numFFTBins);
-        for (int i=0; i<numFFTBins; i++)
+        for (size_t i=0; i<numFFTBins; i++)
             fftBinFreq.push_back (fs/2.0/(numFFTBins-1)*i);
-            
-        // Filterbank: Allocate memory
-        fbank.reserve (numFilters*numFFTBins);
-        
-        // Populate the fbank matrix
-        for (int filt=1; filt<=numFilters; filt++) {
-            v_d ftemp;
-            for (int bin=0; bin<numFFTBins; bin++) {
+
+        // Populate the fbank bands
+        fbank.clear();
+        fbankBegin.assign(numFilters, 0);
+        fbankCount.assign(numFilters, 0);
+        fbankOffset.assign(numFilters, 0);
+        for (size_t filt=1; filt<=numFilters; filt++) {
+            std::vector<double> ftemp;
+            for (size_t bin=0; bin<numFFTBins; bin++) {
                 double weight;
                 if (fftBinFreq[bin] < filterCentreFreq[filt-1])
                     weight = 0;
@@ -219,14 +349,59 @@ private:
                     weight = 0;
                 ftemp.push_back (weight);
             }
-            fbank.push_back(ftemp);
+
+            // Keep the bins between the first and the last non-zero weight
+            size_t begin = 0, end = ftemp.size();
+            while (begin < end && ftemp[begin] == 0)
+                begin++;
+            while (end > begin && ftemp[end-1] == 0)
+                end--;
+            fbankBegin[filt-1] = begin;
+            fbankCount[filt-1] = end - begin;
+            fbankOffset[filt-1] = fbank.size();
+            fbank.insert(fbank.end(), ftemp.begin() + begin, ftemp.begin() + end);
         }
     }
 
+    // Check the wav header and read all samples after it
+    bool readWav(std::ifstream& wavFp, std::vector<int16_t>& samples, std::string& error) {
+        // Read the wav header
+        wavHeader hdr;
+        int headerSize = sizeof(wavHeader);
+        wavFp.read((char*)&hdr, headerSize);
+
+        // Check audio format
+        if (hdr.AudioFormat != 1 || hdr.bitsPerSample != 16) {
+            error = "Unsupported audio format, use 16 bit PCM Wave";
+            return false;
+        }
+        // Check sampling rate
+        if (hdr.SamplesPerSec != fs) {
+            error = "Sampling rate mismatch: Found " + std::to_string(hdr.SamplesPerSec) + " instead of " + std::to_string(fs);
+            return false;
+        }
+
+        // Check sampling rate
+        if (hdr.NumOfChan != 1) {
+            error = std::to_string(hdr.NumOfChan) + " channel files are unsupported. Use mono.";
+            return false;
+        }
+
+        // Read the rest of the file at once
+        std::streampos begin = wavFp.tellg();
+        wavFp.seekg(0, std::ios::end);
+        std::streamoff size = wavFp.tellg() - begin;
+        wavFp.seekg(begin);
+        samples.resize(size > 0 ? (size_t)size / sizeof(int16_t) : 0);
+        wavFp.read((char*)samples.data(), samples.size() * sizeof(int16_t));
+        samples.resize((size_t)wavFp.gcount() / sizeof(int16_t));
+        return true;
+    }
+
     // Convert vector of double to string (for writing MFCC file output)
     std::string v_d_to_string (v_d vec) {
         std::stringstream vecStream;
-        for (int i=0; i<vec.size()-1; i++) {
+        for (size_t i=0; i<vec.size()-1; i++) {
             vecStream << std::scientific << vec[i];
             vecStream << ", ";
         }
@@ -237,7 +412,7 @@ private:
 
 public:
     // MFCC class constructor
-    CarpMFCC(int sampFreq=8000, int nCep=12, int winLength=25, int frameShift=10, int numFilt=40, double lf=50, double hf=6500) {
+    CarpMFCCTemplate(int sampFreq=8000, int nCep=12, int winLength=25, int frameShift=10, int numFilt=40, double lf=50, double hf=6500) {
         fs          = sampFreq;             // Sampling frequency
         numCepstra  = nCep;                 // Number of cepstra
         numFilters  = numFilt;              // Number of Mel warped filters
@@ -247,84 +422,90 @@ public:
         numFFT      = fs<=20000?512:2048;   // FFT size
         winLengthSamples   = winLength * fs / 1e3;  // winLength in milliseconds
         frameShiftSamples  = frameShift * fs / 1e3; // frameShift in milliseconds
-        
+
         numFFTBins = numFFT/2 + 1;
         powerSpectralCoef.assign (numFFTBins, 0);
+        fftInput.assign (numFFT, 0);
+        lmfbCoef.assign (numFilters, 0);
+        mfcc.assign (numCepstra+1, 0);
         prevsamples.assign (winLengthSamples-frameShiftSamples, 0);
+        frame.reserve (std::max(winLengthSamples, numFFT));
 
         initFilterbank();
         initHamDct();
-        compTwiddle();
+        fft.init(numFFT);
+    }
+
+    // Number of values of each frame
+    size_t getFeatureSize() const { return numCepstra + 1; }
+
+    // Number of frames of a buffer of N samples
+    size_t getFrameCount(size_t N) const {
+        return N >= winLengthSamples ? (N - winLengthSamples) / frameShiftSamples + 1 : 0;
     }
 
     // Process each frame and extract MFCC
-    void processFrame(int16_t* samples, size_t N, std::vector<double>& mfcc_out) {
+    void processFrame(int16_t* samples, size_t N, std::vector<T>& mfcc_out) {
         // Add samples from the previous frame that overlap with the current frame
         // to the current samples and create the frame.
-        frame = prevsamples;
-        for (int i=0; i<N; i++)
-            frame.push_back(samples[i]);
+        frame.assign(prevsamples.begin(), prevsamples.end());
+        frame.insert(frame.end(), samples, samples + N);
         prevsamples.assign(frame.begin()+frameShiftSamples, frame.end());
 
-        preEmphHam();
-        computePowerSpec();
-        applyLMFB();
-        applyDct();
-
+        extract(frame.data(), frame.size(), mfcc.data());
         mfcc_out = mfcc;
     }
 
-    // Read input file stream, extract MFCCs and write to output file stream
-    bool process (std::ifstream& wavFp, std::vector<std::vector<double>>& mfcc_list, std::string& error) {
-        // Read the wav header    
-        wavHeader hdr;
-        int headerSize = sizeof(wavHeader);
-        wavFp.read((char*)&hdr, headerSize);
+    // Extract MFCCs of a whole mono 16-bit PCM buffer. Frame i starts at sample
+    // i*frameShift, the features are stored row by row in one contiguous buffer
+    // with getFeatureSize() values per frame. Returns the number of frames.
+    size_t processBuffer(const int16_t* samples, size_t N, std::vector<T>& features) {
+        const size_t count = getFrameCount(N);
+        const size_t featureSize = getFeatureSize();
+        features.resize(count * featureSize);
+        for (size_t i = 0; i < count; i++)
+            extract(samples + i * frameShiftSamples, winLengthSamples, features.data() + i * featureSize);
+        return count;
+    }
 
-        // Check audio format
-        if (hdr.AudioFormat != 1 || hdr.bitsPerSample != 16) {
-            error = "Unsupported audio format, use 16 bit PCM Wave";
+    // Read input file stream and extract MFCCs into one contiguous buffer
+    bool process (std::ifstream& wavFp, std::vector<T>& features, std::string& error) {
+        std::vector<int16_t> samples;
+        if (!readWav(wavFp, samples, error))
             return false;
-        }
-        // Check sampling rate
-        if (hdr.SamplesPerSec != fs) {
-            error = "Sampling rate mismatch: Found " + std::to_string(hdr.SamplesPerSec) + " instead of " + std::to_string(fs);
-            return false;
-        }
+        processBuffer(samples.data(), samples.size(), features);
+        return true;
+    }
 
-        // Check sampling rate
-        if (hdr.NumOfChan != 1) {
-            error = std::to_string(hdr.NumOfChan) + " channel files are unsupported. Use mono.";
+    // Read input file stream, extract MFCCs and write to output file stream
+    bool process (std::ifstream& wavFp, std::vector<std::vector<T>>& mfcc_list, std::string& error) {
+        v_d features;
+        if (!process(wavFp, features, error))
             return false;
-        }
-
-
-        // Initialise buffer
-        uint16_t bufferLength = winLengthSamples - frameShiftSamples;
-        int16_t* buffer = new int16_t[bufferLength];
-        int bufferBPS = (sizeof buffer[0]);
 
-        // Read and set the initial samples        
-        wavFp.read((char*)buffer, bufferLength * bufferBPS);
-        for (int i = 0; i < bufferLength; i++)
-            prevsamples[i] = buffer[i];
-        delete[] buffer;
-
-        // Recalculate buffer size
-        bufferLength = frameShiftSamples;
-        buffer = new int16_t[bufferLength];
-
-        // Read data and process each frame
-        wavFp.read((char*)buffer, bufferLength * bufferBPS);
-        while (wavFp.gcount() == bufferLength * bufferBPS && !wavFp.eof()) {
-            mfcc_list.emplace_back(std::vector<double>());
-            processFrame(buffer, bufferLength, mfcc_list.back());
-            wavFp.read((char*)buffer, bufferLength * bufferBPS);
-        }
-        delete[] buffer;
-        buffer = nullptr;
+        const size_t featureSize = getFeatureSize();
+        for (size_t i = 0; i < features.size(); i += featureSize)
+            mfcc_list.emplace_back(features.begin() + i, features.begin() + i + featureSize);
         return true;
     }
 };
 
-#endif
\ No newline at end of file
+using CarpMFCC = CarpMFCCTemplate<double>;
+using CarpMFCCF = CarpMFCCTemplate<float>;
+
+/* eg.
+    // Whole file
+    std::ifstream wav_file("record.wav", std::ios::binary);
+    CarpMFCC mfcc;
+    std::vector<double> features;
+    std::string error;
+    if (mfcc.process(wav_file, features, error))
+        frame_count = features.size() / mfcc.getFeatureSize();
+
+    // PCM already in memory, single precision
+    CarpMFCCF mfcc_f(16000, 12, 25, 10, 40, 50, 7600);
+    std::vector<float> features_f;
+    size_t frame_count = mfcc_f.processBuffer(pcm.data(), pcm.size(), features_f);
+*/
+
+#endif
@@ -7,6 +7,7 @@
 #include "Mysql/errmsg.h"
 
 #include "Carp/carp_log.hpp"
+#include "Carp/carp_stmt_cache.hpp"
 
 #ifdef _WIN32
 #pragma comment(lib, "libmysql.lib")
@@ -160,20 +161,8 @@ public:
 	{
 		if (!m_mysql) return;
 
-		// release all stmt
-		for (auto& pair : m_stmt_map)
-		{
-			for (size_t i = 0; i < pair.second->bind_output.size(); ++i)
-			{
-				if (pair.second->bind_output[i].buffer != nullptr)
-					free(pair.second->bind_output[i].buffer);
-			}
-			// free stmt
-			mysql_stmt_close(pair.second->stmt);
-			// flag stmt to 0
-			pair.second->stmt = nullptr;
-		}
-		m_stmt_map.clear();
+		// release all stmt, keep stats
+		m_stmt_cache.ReleaseAll();
 
 		// release mysql object
 		mysql_close(m_mysql);
@@ -204,14 +193,16 @@ public:
 		std::vector<MYSQL_BIND> bind_output;				// output bind for read
 		std::vector<unsigned long> value_length;		// output max length for read
 		CarpMysqlConnection* conn = nullptr;								// come from
+		bool in_used = false;								// stmt is only used inside CarpMysqlStatementQuery::Begin
+		CarpStmtStatsPtr stats;								// usage stats
 	};
 	typedef std::shared_ptr<CarpMysqlStmtInfo> CarpMysqlStmtInfoPtr;
 
 	/* get stmt object
-	 * @param sql: sql string
+	 * @param handle: sql handle
 	 * @return MysqlStmtInfo
 	 */
-	CarpMysqlStmtInfoPtr GetStmt(const std::string& sql, bool& need_reconnect)
+	CarpMysqlStmtInfoPtr GetStmt(const CarpSqlHandle& handle, bool& need_reconnect)
 	{
 		need_reconnect = false;
 		if (!m_mysql)
@@ -221,11 +212,12 @@ public:
 		}
 
 		// find stmt
-		auto it = m_stmt_map.find(sql);
-		if (it != m_stmt_map.end()) return it->second;
+		auto info = m_stmt_cache.Find(handle);
+		if (info) return info;
 
 		// mysql stmt info
-		auto info = std::make_shared<CarpMysqlStmtInfo>();
+		const std::string& sql = handle.GetSQL();
+		info = std::make_shared<CarpMysqlStmtInfo>();
 		info->conn = this;
 
 		// create stmt
@@ -290,32 +282,56 @@ public:
 		}
 
 		// save and return
-		m_stmt_map[sql] = info;
+		if (!m_stmt_cache.Add(handle, info))
+		{
+			CARP_ERROR("stmt instance count reach max:" << m_stmt_cache.GetMaxInstance() << ", sql:" << sql);
+			ReleaseStmtInfo(info);
+			return CarpMysqlStmtInfoPtr();
+		}
 		return info;
 	}
+	CarpMysqlStmtInfoPtr GetStmt(const std::string& sql, bool& need_reconnect) { return GetStmt(CarpSqlHandle(sql), need_reconnect); }
 
-	bool ReleaseStmt(const char* sql)
+	bool ReleaseStmt(const CarpSqlHandle& handle)
 	{
-		StmtMap::iterator it = m_stmt_map.find(sql);
-		if (it == m_stmt_map.end())
+		if (!m_stmt_cache.Remove(handle))
 		{
-			CARP_ERROR("can't find stmt by sql:" << sql);
+			CARP_ERROR("can't find stmt by sql:" << handle.GetSQL());
 			return false;
 		}
-		for (size_t i = 0; i < it->second->bind_output.size(); ++i)
+		return true;
+	}
+	bool ReleaseStmt(const char* sql) { return ReleaseStmt(CarpSqlHandle(sql)); }
+
+	/* stmt cache setting
+	 * @param capacity: max sql count, the least recently used sql is evicted
+	 * @param max_instance: max instance count of one sql
+	 */
+	void SetStmtCacheCapacity(size_t capacity, size_t max_instance)
+	{
+		m_stmt_cache.SetCapacity(capacity);
+		m_stmt_cache.SetMaxInstance(max_instance);
+	}
+
+	// dump stmt usage stats for tuning, order by total time
+	std::string DumpStmtStats(size_t top = 0) const { return m_stmt_cache.DumpStats(top); }
+
+private:
+	static void ReleaseStmtInfo(CarpMysqlStmtInfoPtr& info)
+	{
+		for (size_t i = 0; i < info->bind_output.size(); ++i)
 		{
-			if (it->second->bind_output[i].buffer != nullptr)
-				free(it->second->bind_output[i].buffer);
+			if (info->bind_output[i].buffer != nullptr)
+				free(info->bind_output[i].buffer);
+			info->bind_output[i].buffer = nullptr;
 		}
 		// free stmt
-		mysql_stmt_close(it->second->stmt);
+		if (info->stmt) mysql_stmt_close(info->stmt);
 		// flag stmt to 0
-		it->second->stmt = nullptr;
-
-		m_stmt_map.erase(it);
-		return true;
+		info->stmt = nullptr;
 	}
 
+public:
 	// execute simple sql
 	bool ExecuteQuery(const char* sql, std::string& reason) const
 	{
@@ -351,8 +367,7 @@ public:
 private:
 	MYSQL* m_mysql = nullptr;
 
-	typedef std::map<std::string, CarpMysqlStmtInfoPtr> StmtMap;
-	StmtMap m_stmt_map;
+	CarpStmtCache<CarpMysqlStmtInfo> m_stmt_cache{ &CarpMysqlConnection::ReleaseStmtInfo };
 
 private:
 	std::string m_db_name;
@@ -377,13 +392,21 @@ public:
 	 * notice:!!!!  if you use COUNT, then please use long long to receive the value
 	 */
 	void SetSQL(const char* sql)
+	{
+		Reset();
+		m_sql = CarpSqlHandle(sql);
+	}
+	/* set sql handle, keep the handle to avoid hashing sql on every execute
+	 * @param sql: sql handle
+	 */
+	void SetSQL(const CarpSqlHandle& sql)
 	{
 		Reset();
 		m_sql = sql;
 	}
 	const char* GetSQL() const
 	{
-		return m_sql.c_str();
+		return m_sql.GetSQL().c_str();
 	}
 
 public:
@@ -875,9 +898,10 @@ private:
 	{
 		// must be reset after begin
 		m_need_reset = true;
+		const long long begin_time = CarpStmtStats::GetCurUSTime();
 
 		// sql must not be empty
-		if (m_sql.empty())
+		if (m_sql.IsEmpty())
 		{
 			reason = "m_sql is empty";
 			End();
@@ -899,7 +923,7 @@ private:
 		{
 			if (!need_reconnect)
 			{
-				reason = "stmt create failed:" + m_sql;
+				reason = "stmt create failed:" + m_sql.GetSQL();
 				End();
 				return false;
 			}
@@ -908,7 +932,7 @@ private:
 			if (!m_conn->ReOpen())
 			{
 				reason = "reconnect mysql failed!";
-				reason += " stmt create failed:" + m_sql;
+				reason += " stmt create failed:" + m_sql.GetSQL();
 				CARP_WARN(reason);
 				End();
 				return false;
@@ -918,12 +942,15 @@ private:
 			stmt_info = m_conn->GetStmt(m_sql, need_reconnect);
 			if (!stmt_info)
 			{
-				reason = "stmt create failed:" + m_sql;
+				reason = "stmt create failed:" + m_sql.GetSQL();
 				End();
 				return false;
 			}
 		}
 
+		// flag in used, so it is not evicted from cache
+		TakeStmt(stmt_info);
+
 		// bind param input
 		if (m_bind_input.size() && mysql_stmt_bind_param(stmt_info->stmt, &m_bind_input[0]))
 		{
@@ -956,10 +983,11 @@ private:
 				stmt_info = m_conn->GetStmt(m_sql, need_reconnect);
 				if (!stmt_info)
 				{
-					reason = "stmt create failed:" + m_sql;
+					reason = "stmt create failed:" + m_sql.GetSQL();
 					End();
 					return false;
 				}
+				TakeStmt(stmt_info);
 
 				// bind param input
 				if (m_bind_input.size() && mysql_stmt_bind_param(stmt_info->stmt, &m_bind_input[0]))
@@ -1085,6 +1113,12 @@ private:
 			}
 		}
 
+		// record stats, rows is affected count for write statement
+		if (stmt_info->stats)
+			stmt_info->stats->Record(CarpStmtStats::GetCurUSTime() - begin_time, m_row_count > 0 ? m_row_count : m_affect_count);
+
+		// result is copied, give back stmt
+		ReturnStmt();
 		return result;
 	}
 	/* clear
@@ -1100,6 +1134,7 @@ private:
 		}
 		m_bind_input.clear();
 		m_bind_outputs.clear();
+		ReturnStmt();
 	}
 
 private:
@@ -1109,11 +1144,26 @@ private:
 		Clear();
 	}
 
+	void TakeStmt(const CarpMysqlConnection::CarpMysqlStmtInfoPtr& stmt_info)
+	{
+		ReturnStmt();
+		m_stmt_info = stmt_info;
+		m_stmt_info->in_used = true;
+	}
+
+	void ReturnStmt()
+	{
+		if (!m_stmt_info) return;
+		m_stmt_info->in_used = false;
+		m_stmt_info = CarpMysqlConnection::CarpMysqlStmtInfoPtr();
+	}
+
 private:
 	CarpMysqlConnection* m_conn = nullptr;		// connect object
+	CarpMysqlConnection::CarpMysqlStmtInfoPtr m_stmt_info;	// stmt in used, only hold inside Begin
 
 private:
-	std::string m_sql;				// SQL string
+	CarpSqlHandle m_sql;				// SQL string
 	int m_input_index = 0;
 	unsigned int m_col_index = 0;
 	unsigned int m_row_index = 0;
@@ -6,6 +6,8 @@
 #include <sstream>
 #include <vector>
 #include <random>
+#include <memory>
+#include <initializer_list>
 
 // 쳣
 #define CARP_ROBOT_ASSERT(e, text) \
@@ -128,6 +130,8 @@ public:
 
 		return value;
 	}
+	// ǷѾļĩβ
+	bool IsEnd() { return !m_in_file.is_open() || m_in_file.peek() == std::char_traits<char>::eof(); }
 
 private:
 	std::ifstream m_in_file;
@@ -146,44 +150,72 @@ public:
 	}
 };
 
+// άޣάϢֱӴڶڲ͹춼Ҫڴ
+#define CARP_ROBOT_MAX_DIM 7
+
 // 洢ʽάϢ
 class CarpRobotDim
 {
 public:
 	// 캯ʼ
 	CarpRobotDim() { }
-	CarpRobotDim(const std::vector<int>& d) : m_d(d) { m_total = m_d.empty() ? 0 : 1; for (size_t i = 0; i < m_d.size(); ++i) m_total *= m_d[i]; }
+	CarpRobotDim(std::initializer_list<int> d) { for (auto value : d) Push(value); Calc(); }
+	CarpRobotDim(std::initializer_list<int> d, int bd) : m_bd(bd) { for (auto value : d) Push(value); Calc(); }
+	CarpRobotDim(const std::vector<int>& d, int bd = 1) : m_bd(bd) { for (auto value : d) Push(value); Calc(); }
 
 public:
-	// ȡܴС
+	// ȡܴС
 	int GetTotalSize() const { return m_total; }
+	// ȡεĴС
+	int GetBatchSize() const { return m_batch_size; }
+	// ȡ
+	int GetBatch() const { return m_bd; }
+	// 
+	void SetBatch(int bd)
+	{
+		CARP_ROBOT_ASSERT(bd >= 1, u8"0:" << bd);
+		m_bd = bd;
+		Calc();
+	}
 
 public:
 	// ǿ
-	bool Equal(const CarpRobotDim& right) const { return m_total == right.m_total && m_d == right.m_d; }
+	bool Equal(const CarpRobotDim& right) const
+	{
+		if (m_total != right.m_total || m_nd != right.m_nd || m_bd != right.m_bd) return false;
+		for (int i = 0; i < m_nd; ++i)
+			if (m_d[i] != right.m_d[i]) return false;
+		return true;
+	}
 
 public:
 	// ȷϵǰǶάʱȡһάȵĴС
-	int Rows() const { return m_d.empty() ? 0 : m_d[0]; }
+	int Rows() const { return m_nd == 0 ? 0 : m_d[0]; }
 	// ȷϵǰǶάʱȡڶάȵĴСûоͷ1
-	int Cols() const { return m_d.size() > 1 ? m_d[1] : 1; }
+	int Cols() const { return m_nd > 1 ? m_d[1] : 1; }
 	// ȡά
-	int Count() const { return (int)m_d.size(); }
+	int Count() const { return m_nd; }
 	// ȡ
-	int operator[](size_t index) const { return index >= 0 && index < m_d.size() ? m_d[index] : 1; }
+	int operator[](size_t index) const { return index < (size_t)m_nd ? m_d[index] : 1; }
 	// ȡ
-	int Get(int index) const { return index >= 0 && index < m_d.size() ? m_d[index] : 1; }
+	int Get(int index) const { return index >= 0 && index < m_nd ? m_d[index] : 1; }
 	// 
-	void Set(int index, int dim) { if (index < 0 || index >= (int)m_d.size()) return; m_d[index] = dim; }
+	void Set(int index, int dim) { if (index < 0 || index >= m_nd) return; m_d[index] = dim; Calc(); }
 	// ôС
-	void Resize(int size) { m_d.resize(size); m_total = m_d.empty() ? 0 : 1; for (size_t i = 0; i < m_d.size(); ++i) m_total *= m_d[i]; }
+	void Resize(int size)
+	{
+		CARP_ROBOT_ASSERT(size >= 0 && size <= CARP_ROBOT_MAX_DIM, u8"ά:" << size);
+		for (int i = m_nd; i < size; ++i) m_d[i] = 0;
+		m_nd = size;
+		Calc();
+	}
 
 public:
 	// ɾĳά
 	void Delete(int index)
 	{
 		// ±곬ôͲɾ
-		int nd = (int)m_d.size();
+		int nd = m_nd;
 		if (index >= nd) return;
 
 		// ɾһά
@@ -194,7 +226,7 @@ public:
 			if (nd == 1)
 				m_d[0] = 1;
 			else
-				m_d.resize(nd - 1);
+				m_nd = nd - 1;
 		}
 		else
 		{
@@ -202,56 +234,93 @@ public:
 			for (; index + 1 < nd; ++index)
 				m_d[index] = m_d[index + 1];
 			// Ȼɾһ
-			m_d.resize(nd - 1);
+			m_nd = nd - 1;
 		}
 
 		// ¼
-		m_total = m_d.empty() ? 0 : 1; for (size_t i = 0; i < m_d.size(); ++i) m_total *= m_d[i];
+		Calc();
 	}
 
 public:
-	// л
+	// лǵΣ
 	void Serialize(CarpRobotModelSerializer& file)
 	{
-		file.WriteInt((int)m_d.size());
-		for (size_t i = 0; i < m_d.size(); ++i)
+		file.WriteInt(m_nd);
+		for (int i = 0; i < m_nd; ++i)
 			file.WriteInt(m_d[i]);
 	}
 	// л
 	void Deserialize(CarpRobotModelDeserializer& file)
 	{
-		m_d.resize(file.ReadInt());
-		for (size_t i = 0; i < m_d.size(); ++i)
+		Resize(file.ReadInt());
+		for (int i = 0; i < m_nd; ++i)
 			m_d[i] = file.ReadInt();
-		m_total = m_d.empty() ? 0 : 1;
-		for (size_t i = 0; i < m_d.size(); ++i) m_total *= m_d[i];
+		m_bd = 1;
+		Calc();
 	}
 	// תַ
 	std::string ToString() const
 	{
 		std::string result = "{";
-		for (size_t i = 0; i < m_d.size(); ++i)
+		for (int i = 0; i < m_nd; ++i)
 		{
 			if (i) result += ",";
 			result += std::to_string(m_d[i]);
 		}
+		if (m_bd > 1) result += "X" + std::to_string(m_bd);
 		result += "}";
 		return result;
 	}
 
 private:
-	// άȵ飬234ôdĳΪ30Ԫ22Ԫ3Ԫ4
-	std::vector<int> m_d;
+	// һά
+	void Push(int value)
+	{
+		CARP_ROBOT_ASSERT(m_nd < CARP_ROBOT_MAX_DIM, u8"ά:" << CARP_ROBOT_MAX_DIM);
+		m_d[m_nd++] = value;
+	}
+	// ܴС
+	void Calc()
+	{
+		m_batch_size = m_nd == 0 ? 0 : 1;
+		for (int i = 0; i < m_nd; ++i) m_batch_size *= m_d[i];
+		m_total = m_batch_size * m_bd;
+	}
+
+private:
+	// άȵ飬234ôάΪ30Ԫ22Ԫ3Ԫ4
+	int m_d[CARP_ROBOT_MAX_DIM] = { 0 };
+	// ά
+	int m_nd = 0;
+	// ݰУһμԴ
+	int m_bd = 1;
+	// εĴС
+	int m_batch_size = 0;
 	// ܴС
 	int m_total = 0;
 };
 
+// ҳụ̂߳ƽ̨̼߳㣬EigenҪڰ֮ǰEIGEN_USE_THREADSThreadPoolDevice
+#ifndef __EMSCRIPTEN__
+#define CARP_ROBOT_THREADS
+#ifndef EIGEN_USE_THREADS
+#define EIGEN_USE_THREADS
+#endif
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#endif
+
 #include <eigen/Eigen/Eigen>
 #include <eigen/unsupported/Eigen/CXX11/Tensor>
 #include <eigen_third_party/eigen_spatial_convolutions.h>
 #include <eigen_third_party/eigen_backward_spatial_convolutions.h>
 #include <eigen_third_party/eigen_pooling.h>
 
+#include "carp_robot_simd.hpp"
+
 class CarpRobotTensor
 {
 public:
@@ -260,8 +329,17 @@ public:
 	CarpRobotTensor(const CarpRobotDim& d, bool init_zero=false) { SetDim(d, init_zero); }
 	CarpRobotTensor(const CarpRobotDim& d, cr_real* value) { m_dim = d; m_value = value; m_shared = true; }
 	CarpRobotTensor(const CarpRobotTensor& t) { Copy(t); }
+	// ƶ죬std::vectorݵʱֱתڴ棬Ҳƻڴص
+	CarpRobotTensor(CarpRobotTensor&& t) noexcept : m_shared(t.m_shared), m_value(t.m_value), m_dim(t.m_dim) { t.m_value = nullptr; t.m_shared = false; }
 	~CarpRobotTensor() { ReleaseMemory(); }
 	void operator = (const CarpRobotTensor& t) { Copy(t); }
+	void operator = (CarpRobotTensor&& t) noexcept
+	{
+		if (&t == this) return;
+		ReleaseMemory();
+		m_shared = t.m_shared; m_value = t.m_value; m_dim = t.m_dim;
+		t.m_value = nullptr; t.m_shared = false;
+	}
 
 public:
 	// Tensorڴ
@@ -405,7 +483,7 @@ public:
 		int other_axis = axis ^ 1;
 
 		// һά1˵ǰһάģԵ
-		if (m_dim[other_axis] == 1)
+		if (m_dim[other_axis] == 1 && m_dim.GetBatch() == 1)
 		{
 			// maximum ʾȡĳάȵֵ
 			// tvec().maximum() ʾǰǸʱõһ
@@ -417,6 +495,18 @@ public:
 			// ԭֵ
 			z.t<0>() = z.t<0>().log() + mval;
 		}
+		// εÿε㣬mzάΪ({1}, bd)
+		else if (m_dim[other_axis] == 1)
+		{
+			int size = m_dim.GetBatchSize();
+			for (int b = 0; b < m_dim.GetBatch(); ++b)
+			{
+				Eigen::Map<Eigen::VectorXf> col(m_value + b * size, size);
+				cr_real mval = col.maxCoeff();
+				m.GetValue()[b] = mval;
+				z.GetValue()[b] = std::log((col.array() - mval).exp().sum()) + mval;
+			}
+		}
 		// һάȲ1Ȼά
 		else
 		{
@@ -426,8 +516,8 @@ public:
 			// ȡָ
 			auto* miter = m.GetValue();
 
-			// Ϊʱֶ֧δдΪ1
-			for (int b = 0; b < 1; ++b)
+			// ÿδ
+			for (int b = 0; b < m_dim.GetBatch(); ++b)
 			{
 				for (int i = 0; i < m_dim[other_axis]; ++i, ++miter)
 				{
@@ -450,6 +540,14 @@ public:
 	Eigen::Map<Eigen::MatrixXf> m() { return Eigen::Map<Eigen::MatrixXf>(m_value, m_dim.Rows(), m_dim.Cols()); }
 	const Eigen::Map<Eigen::MatrixXf> m() const { return Eigen::Map<Eigen::MatrixXf>(m_value, m_dim.Rows(), m_dim.Cols()); }
 
+	// ȡbεĶάֻһʱι
+	Eigen::Map<Eigen::MatrixXf> m(int b) { return Eigen::Map<Eigen::MatrixXf>(m_value + (m_dim.GetBatch() == 1 ? 0 : b) * m_dim.GetBatchSize(), m_dim.Rows(), m_dim.Cols()); }
+	const Eigen::Map<Eigen::MatrixXf> m(int b) const { return Eigen::Map<Eigen::MatrixXf>(m_value + (m_dim.GetBatch() == 1 ? 0 : b) * m_dim.GetBatchSize(), m_dim.Rows(), m_dim.Cols()); }
+
+	// ΰƴӳһάάΪ(d[0], d[1] * bd)һʱһξ˷
+	Eigen::Map<Eigen::MatrixXf> mb() { return Eigen::Map<Eigen::MatrixXf>(m_value, m_dim.Rows(), m_dim.Cols() * m_dim.GetBatch()); }
+	const Eigen::Map<Eigen::MatrixXf> mb() const { return Eigen::Map<Eigen::MatrixXf>(m_value, m_dim.Rows(), m_dim.Cols() * m_dim.GetBatch()); }
+
 	Eigen::Map<Eigen::VectorXf> vec() { return Eigen::Map<Eigen::VectorXf>(m_value, m_dim.GetTotalSize()); }
 	const Eigen::Map<Eigen::VectorXf> vec() const { return Eigen::Map<Eigen::VectorXf>(m_value, m_dim.GetTotalSize()); }
 
@@ -457,21 +555,22 @@ public:
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 1>> tvec() { return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, m_dim.GetTotalSize()); }
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 1>> tvec() const { return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, m_dim.GetTotalSize()); }
 
-	Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tbvec() { return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim.GetTotalSize(), 1); }
-	const Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tbvec() const { return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim.GetTotalSize(), 1); }
+	// ʹõǰݣһ(εĴС, bd)Tensor
+	Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tbvec() { return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim.GetBatchSize(), m_dim.GetBatch()); }
+	const Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tbvec() const { return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim.GetBatchSize(), m_dim.GetBatch()); }
 
 	// ʹõǰݣһOrderάȵTensor
 	template <int Order>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, Order>> t()
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= Order, u8"ǷάϢ t<" << Order << ">(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= Order && m_dim.GetBatch() == 1, u8"ǷάϢ t<" << Order << ">(): dim=" << m_dim.ToString());
 		std::array<int, Order> dim; for (int i = 0; i < Order; ++i) dim[i] = m_dim[i];
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, Order>>(m_value, dim);
 	}
 	template <int Order>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, Order>> t() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= Order, u8"ǷάϢ t<" << Order << ">(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= Order && m_dim.GetBatch() == 1, u8"ǷάϢ t<" << Order << ">(): dim=" << m_dim.ToString());
 		std::array<int, Order> dim; for (int i = 0; i < Order; ++i) dim[i] = m_dim[i];
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, Order>>(m_value, dim);
 	}
@@ -505,49 +604,49 @@ public:
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> t<2>()
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 2, u8"ǷάϢ t<2>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 2 && m_dim.GetBatch() == 1, u8"ǷάϢ t<2>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], m_dim[1]);
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> t<2>() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 2, u8"ǷάϢ t<2>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 2 && m_dim.GetBatch() == 1, u8"ǷάϢ t<2>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], m_dim[1]);
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 3>> t<3>()
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 3, u8"ǷάϢ t<3>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 3 && m_dim.GetBatch() == 1, u8"ǷάϢ t<3>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], m_dim[2]);
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 3>> t<3>() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 3, u8"ǷάϢ t<3>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 3 && m_dim.GetBatch() == 1, u8"ǷάϢ t<3>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], m_dim[2]);
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 4>> t<4>()
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 4, u8"ǷάϢ t<4>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 4 && m_dim.GetBatch() == 1, u8"ǷάϢ t<4>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3]);
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 4>> t<4>() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() <= 4, u8"ǷάϢ t<4>(): dim=" << m_dim.ToString());
+		CARP_ROBOT_ASSERT(m_dim.Count() <= 4 && m_dim.GetBatch() == 1, u8"ǷάϢ t<4>(): dim=" << m_dim.ToString());
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3]);
 	}
 
-	// ʹõǰݣһݵOrderάȵTensor
+	// ʹõǰݣһݵOrderάȵTensorһά
 	template <int Order>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, Order + 1>> tb()
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= Order, u8"ǷάϢ tb<" << Order << ">(): dim=" << m_dim.ToString());
 		std::array<int, Order + 1> dim; for (int i = 0; i < Order; ++i) dim[i] = m_dim[i];
-		m_dim[Order] = 1;
+		dim[Order] = m_dim.GetBatch();
 		return Eigen::TensorMap<Eigen::Tensor<cr_real, Order + 1>>(m_value, dim);
 	}
 	template <int Order>
@@ -555,73 +654,73 @@ public:
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= Order, u8"ǷάϢ tb<" << Order << ">(): dim=" << m_dim.ToString());
 		std::array<int, Order + 1> dim; for (int i = 0; i < Order; ++i) dim[i] = m_dim[i];
-		m_dim[Order] = 1;
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, Order>>(m_value, dim);
+		dim[Order] = m_dim.GetBatch();
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, Order + 1>>(m_value, dim);
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 1>> tb<0>()
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() == 1 && m_dim.GetTotalSize() == 1, u8"ǷάϢ tb<0>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, 1);
+		CARP_ROBOT_ASSERT(m_dim.Count() == 1 && m_dim.GetBatchSize() == 1, u8"ǷάϢ tb<0>(): dim=" << m_dim.ToString());
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, m_dim.GetBatch());
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 1>> tb<0>() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.Count() == 1 && m_dim.GetTotalSize() == 1, u8"ǷάϢ tb<0>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, 1);
+		CARP_ROBOT_ASSERT(m_dim.Count() == 1 && m_dim.GetBatchSize() == 1, u8"ǷάϢ tb<0>(): dim=" << m_dim.ToString());
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 1>>(m_value, m_dim.GetBatch());
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tb<1>()
 	{
-		CARP_ROBOT_ASSERT(m_dim.GetTotalSize() == m_dim.Rows(), u8"ǷάϢ tb<1>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], 1);
+		CARP_ROBOT_ASSERT(m_dim.GetBatchSize() == m_dim.Rows(), u8"ǷάϢ tb<1>(): dim=" << m_dim.ToString());
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], m_dim.GetBatch());
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 2>> tb<1>() const
 	{
-		CARP_ROBOT_ASSERT(m_dim.GetTotalSize() == m_dim.Rows(), u8"ǷάϢ tb<1>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], 1);
+		CARP_ROBOT_ASSERT(m_dim.GetBatchSize() == m_dim.Rows(), u8"ǷάϢ tb<1>(): dim=" << m_dim.ToString());
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 2>>(m_value, m_dim[0], m_dim.GetBatch());
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 3>> tb<2>()
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 2, u8"ǷάϢ tb<2>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], m_dim.GetBatch());
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 3>> tb<2>() const
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 2, u8"ǷάϢ tb<2>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 3>>(m_value, m_dim[0], m_dim[1], m_dim.GetBatch());
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 4>> tb<3>()
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 3, u8"ǷάϢ tb<3>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim.GetBatch());
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 4>> tb<3>() const
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 3, u8"ǷάϢ tb<3>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 4>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim.GetBatch());
 	}
 
 	template <>
 	Eigen::TensorMap<Eigen::Tensor<cr_real, 5>> tb<4>()
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 4, u8"ǷάϢ tb<4>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 5>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 5>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3], m_dim.GetBatch());
 	}
 	template <>
 	const Eigen::TensorMap<Eigen::Tensor<cr_real, 5>> tb<4>() const
 	{
 		CARP_ROBOT_ASSERT(m_dim.Count() <= 4, u8"ǷάϢ tb<4>(): dim=" << m_dim.ToString());
-		return Eigen::TensorMap<Eigen::Tensor<cr_real, 5>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3], 1);
+		return Eigen::TensorMap<Eigen::Tensor<cr_real, 5>>(m_value, m_dim[0], m_dim[1], m_dim[2], m_dim[3], m_dim.GetBatch());
 	}
 
 public:
@@ -653,6 +752,21 @@ public:
 		return index;
 	}
 
+	// ѵbεҷֵǸ±
+	int AsBatchVectorAndArgmax(int b) const
+	{
+		if (b < 0 || b >= m_dim.GetBatch()) return 0;
+		int vector_size = m_dim.GetBatchSize();
+		const cr_real* value = m_value + b * vector_size;
+		int index = 0;
+		for (int i = 1; i < vector_size; ++i)
+		{
+			if (value[index] < value[i])
+				index = i;
+		}
+		return index;
+	}
+
 	// ҷֵǸֵ
 	cr_real AsVectorAndMaxValue() const { return m_value[AsVectorAndArgmax()]; }
 
@@ -664,6 +778,146 @@ public:
 	void Deserialize(CarpRobotModelDeserializer& file) { CarpRobotDim tmp; tmp.Deserialize(file); SetDim(tmp); file.ReadRealArray(m_value, m_dim.GetTotalSize()); }
 };
 
+// ڴأڴ棬ƫзָ
+// PlanAllocPlanFreeģһ䣬õÿƫԼֵСȻReserveһ
+// ƫƺʹСĵλcr_realĸ
+class CarpRobotArena
+{
+public:
+	CarpRobotArena() {}
+	~CarpRobotArena() { if (m_memory) free(m_memory); }
+
+private:
+	CarpRobotArena(const CarpRobotArena&) {}
+	void operator = (const CarpRobotArena&) {}
+
+public:
+	// 뵽4cr_real֤ÿڴ涼16ֽڶ
+	static size_t Align(size_t count) { return (count + 3) & ~(size_t)3; }
+
+public:
+	// ֤㹻ڴַ仯ͷtrue
+	// keepʾǷҪԭ
+	bool Reserve(size_t count, bool keep)
+	{
+		if (count <= m_capacity) return false;
+
+		// 𲽹ͼʱƵ
+		size_t capacity = m_capacity * 2;
+		if (capacity < count) capacity = count;
+
+		cr_real* memory = nullptr;
+		if (keep)
+		{
+			memory = (cr_real*)realloc(m_memory, capacity * sizeof(cr_real));
+		}
+		else
+		{
+			memory = (cr_real*)malloc(capacity * sizeof(cr_real));
+			if (memory && m_memory) free(m_memory);
+		}
+		CARP_ROBOT_ASSERT(memory, u8"ڴʧ:" << capacity * sizeof(cr_real));
+
+		m_memory = memory;
+		m_capacity = capacity;
+		++m_alloc_count;
+		return true;
+	}
+
+	// ȡڴ
+	cr_real* GetMemory() const { return m_memory; }
+	// ȡ
+	size_t GetCapacity() const { return m_capacity; }
+	// ȡϵͳڴĴ
+	int GetAllocCount() const { return m_alloc_count; }
+
+public:
+	// ʼµĹ滮
+	void ResetPlan() { m_free_list.clear(); m_plan_size = 0; }
+
+	// 滮һڴ棬ƫ
+	size_t PlanAlloc(size_t count)
+	{
+		count = Align(count);
+		if (count == 0) return 0;
+
+		// ڿпʵһ
+		size_t best = m_free_list.size();
+		for (size_t i = 0; i < m_free_list.size(); ++i)
+		{
+			if (m_free_list[i].size < count) continue;
+			if (best == m_free_list.size() || m_free_list[i].size < m_free_list[best].size) best = i;
+		}
+		if (best < m_free_list.size())
+		{
+			auto& block = m_free_list[best];
+			size_t offset = block.offset;
+			block.offset += count;
+			block.size -= count;
+			if (block.size == 0) m_free_list.erase(m_free_list.begin() + best);
+			return offset;
+		}
+
+		// һп鰤ĩβôʼչ
+		if (!m_free_list.empty() && m_free_list.back().offset + m_free_list.back().size == m_plan_size)
+		{
+			size_t offset = m_free_list.back().offset;
+			m_free_list.pop_back();
+			m_plan_size = offset + count;
+			return offset;
+		}
+
+		size_t offset = m_plan_size;
+		m_plan_size += count;
+		return offset;
+	}
+
+	// 黹滮ڴ棬ҺڵĿпϲ
+	void PlanFree(size_t offset, size_t count)
+	{
+		count = Align(count);
+		if (count == 0) return;
+
+		// п鰴ƫ
+		size_t index = 0;
+		while (index < m_free_list.size() && m_free_list[index].offset < offset) ++index;
+		CarpRobotArenaBlock block;
+		block.offset = offset;
+		block.size = count;
+		m_free_list.insert(m_free_list.begin() + index, block);
+
+		// ͺһϲ
+		if (index + 1 < m_free_list.size() && offset + count == m_free_list[index + 1].offset)
+		{
+			m_free_list[index].size += m_free_list[index + 1].size;
+			m_free_list.erase(m_free_list.begin() + index + 1);
+		}
+		// ǰһϲ
+		if (index > 0 && m_free_list[index - 1].offset + m_free_list[index - 1].size == offset)
+		{
+			m_free_list[index - 1].size += m_free_list[index].size;
+			m_free_list.erase(m_free_list.begin() + index);
+		}
+	}
+
+	// ȡ滮ķֵС
+	size_t GetPlanSize() const { return m_plan_size; }
+
+private:
+	struct CarpRobotArenaBlock
+	{
+		size_t offset = 0;
+		size_t size = 0;
+	};
+	std::vector<CarpRobotArenaBlock> m_free_list;	// 滮ʱĿп飬ƫ
+	size_t m_plan_size = 0;					// 滮ķֵС
+
+private:
+	cr_real* m_memory = nullptr;			// ڴ
+	size_t m_capacity = 0;					// 
+	int m_alloc_count = 0;					// ϵͳڴĴ
+};
+
 class ICarpRobotParameter
 {
 public:
@@ -692,6 +946,8 @@ public:
 	// ۼȨ grad <- grad + d
 	void AccumulateGrad(const CarpRobotTensor& d)
 	{
+		CARP_ROBOT_ASSERT(!m_read_only, u8"õֻڴ棬ѵ:" << m_name);
+
 		// ݶȲΪ0
 		m_has_grad = true;
 
@@ -714,6 +970,32 @@ public:
 	// ȡݶ
 	CarpRobotTensor& GetGradient() { return m_grad; }
 
+	// ڲռе±
+	int GetIndex() const { return m_index; }
+	void SetIndex(int index) { m_index = index; }
+
+public:
+	// ֱֵⲿֻڴ(ӳģļ)ݶڴҲһͷţֻ֮
+	void RefrenceValue(const cr_real* value)
+	{
+		CarpRobotDim dim = m_values.GetDim();
+		m_values.RefrenceMemory(dim, const_cast<cr_real*>(value));
+		m_grad.SetDim(CarpRobotDim());
+		m_has_grad = false;
+		m_read_only = true;
+	}
+	// õⲿڴ渴һݣָɿѵĲ
+	void DetachValue()
+	{
+		if (!m_read_only) return;
+		CarpRobotTensor copy(m_values);
+		m_values = std::move(copy);
+		m_grad.SetDim(m_values.GetDim(), true);
+		m_read_only = false;
+	}
+	// Ƿֻڴ
+	bool IsReadOnly() const { return m_read_only; }
+
 public:
 	// ȡ
 	virtual const std::string& GetFullName() const override { return m_name; }
@@ -732,6 +1014,7 @@ public:
 		if (name) name_copy = name;
 		std::string read_name = file.ReadString();
 		CARP_ROBOT_ASSERT(read_name == name_copy, u8"лƴ, ǰ:" << read_name << "Ӧ:" << name_copy);
+		DetachValue();
 		m_values.Deserialize(file);
 	}
 
@@ -740,6 +1023,8 @@ private:
 	CarpRobotTensor m_values;				// ǰֵ
 	CarpRobotTensor m_grad;					// ǰ
 	bool m_has_grad = false;			// Ƿ
+	bool m_read_only = false;			// ֵǷֻڴ
+	int m_index = -1;					// ڲռе±
 };
 
 // ռ
@@ -763,6 +1048,7 @@ public:
 		// ʼΪֵ
 		p->GetValue().RandomizeUniform();
 		// ӵб
+		p->SetIndex((int)m_params.size());
 		m_params.push_back(p);
 		return p;
 	}
@@ -786,7 +1072,7 @@ public:
 		return result;
 	}
 
-	// л
+	// лǵΣ
 	void Serialize(CarpRobotModelSerializer& file)
 	{
 		for (size_t i = 0; i < m_params.size(); ++i)
@@ -797,6 +1083,16 @@ public:
 	{
 		for (size_t i = 0; i < m_params.size(); ++i)
 			m_params[i]->Deserialize(file, nullptr);
+		m_holder.reset();
+	}
+
+	// в˳ⲿֻڴ棬holderڴ(ӳģļ)ֱ¼ػ
+	void RefrenceMemory(const std::vector<const cr_real*>& values, const std::shared_ptr<void>& holder)
+	{
+		CARP_ROBOT_ASSERT(values.size() == m_params.size(), u8"һ, ǰ:" << values.size() << "Ӧ:" << m_params.size());
+		for (size_t i = 0; i < m_params.size(); ++i)
+			m_params[i]->RefrenceValue(values[i]);
+		m_holder = holder;
 	}
 
 	void Load(const char* file_path)
@@ -815,11 +1111,19 @@ public:
 
 private:
 	std::vector<CarpRobotParameter*> m_params;					// Parameterļ
+	std::shared_ptr<void> m_holder;								// õⲿڴ
 	
 private:
 	std::string m_name;									// ռ
 };
 
+// ڵڲмʹõ豸û̵߳ʱĬ豸Ҳᱻõڵ
+#ifdef CARP_ROBOT_THREADS
+typedef Eigen::ThreadPoolDevice CarpRobotDevice;
+#else
+typedef Eigen::DefaultDevice CarpRobotDevice;
+#endif
+
 // ڵ
 class CarpRobotNode
 {
@@ -834,8 +1138,19 @@ public:
 	const std::vector<int>& GetArgs() const { return m_args; }
 	// ȡάϢ
 	const CarpRobotDim& GetDim() const { return m_dim_out; }
+	// ȡڴĴСǰͷ򴫲֮һֱdropout
+	int GetAuxSize() const { return m_aux_size; }
+	// ȡʱڴĴСֻһForwardBackwardڲʹ
+	int GetScratchSize() const { return m_scratch_size; }
+	// Ƿֱⲿڴ棬ֽڵ㲻Ҫڴз
+	bool IsRefrenceMemory() const { return m_refrence_memory; }
+	// ɼͼÿμ֮ǰãڴԼͼڴ
+	void SetMemory(cr_real* aux, cr_real* scratch) { m_aux = aux; m_scratch = scratch; }
+	// ɼͼÿμ֮ǰãΪձʾ̼߳
+	void SetDevice(const CarpRobotDevice* device) { m_device = device; }
 
 public:
+	// άȣҪڴĽڵm_aux_sizem_scratch_size
 	virtual void Dim(const std::vector<const CarpRobotDim*>& xs) = 0;
 	// ִǰ
 	virtual void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) = 0;
@@ -845,15 +1160,136 @@ public:
 		const CarpRobotTensor& dEdf,									// ýڵڵ
 		int xs_i,														// ýڵڵ
 		CarpRobotTensor& dEdxi) = 0;									// ڵ
+
+protected:
+	// ʽֵв豸ʱɶ߳һ
+	template <typename L, typename R>
+	void Assign(L lhs, const R& rhs) const
+	{
+		if (m_device) lhs.device(*m_device) = rhs;
+		else lhs = rhs;
+	}
+	template <typename L, typename R>
+	void AssignAdd(L lhs, const R& rhs) const
+	{
+		if (m_device) lhs.device(*m_device) += rhs;
+		else lhs += rhs;
+	}
+
+	// [0, n)зֳɶβִfunc(first, last)costÿԪصĴ¼
+	template <typename F>
+	void ParallelFor(int n, double cost, const F& func) const
+	{
+#ifdef CARP_ROBOT_THREADS
+		if (m_device && n > 1)
+		{
+			m_device->parallelFor(n, Eigen::TensorOpCost(0, 0, cost), [&func](Eigen::Index first, Eigen::Index last) { func((int)first, (int)last); });
+			return;
+		}
+#endif
+		func(0, n);
+	}
+
+	// ɢԪ fx = f(a, b)abÿά()ҪôfxȣҪô1
+	template <typename F>
+	static void Broadcast(const CarpRobotTensor& a, const CarpRobotTensor& b, CarpRobotTensor& fx, const F& f)
+	{
+		const auto& da = a.GetDim();
+		const auto& db = b.GetDim();
+		const auto& df = fx.GetDim();
+		const int nd = df.Count() + 1;
+		int dims[CARP_ROBOT_MAX_DIM + 1];
+		size_t a_strides[CARP_ROBOT_MAX_DIM + 1], b_strides[CARP_ROBOT_MAX_DIM + 1];
+		size_t a_stride = 1, b_stride = 1;
+		for (int i = 0; i < nd; ++i)
+		{
+			// һά
+			const int size_a = i < df.Count() ? da[i] : da.GetBatch();
+			const int size_b = i < df.Count() ? db[i] : db.GetBatch();
+			dims[i] = i < df.Count() ? df[i] : df.GetBatch();
+			a_strides[i] = size_a == 1 ? 0 : a_stride;
+			b_strides[i] = size_b == 1 ? 0 : b_stride;
+			a_stride *= size_a;
+			b_stride *= size_b;
+		}
+		CarpRobotSimd::Broadcast(nd, dims, a.GetValue(), a_strides, b.GetValue(), b_strides, fx.GetValue(), f);
+	}
+
+	// ɢۼ out += f(a, b)outabСά()ѽͣڷ򴫲
+	template <typename F>
+	static void BroadcastAdd(const CarpRobotTensor& a, const CarpRobotTensor& b, CarpRobotTensor& out, const F& f)
+	{
+		const CarpRobotDim* ds[3] = { &a.GetDim(), &b.GetDim(), &out.GetDim() };
+		int nd = 0;
+		for (auto* d : ds) nd = std::max(nd, d->Count());
+		++nd;
+		int dims[CARP_ROBOT_MAX_DIM + 1];
+		size_t strides[3][CARP_ROBOT_MAX_DIM + 1];
+		size_t stride[3] = { 1, 1, 1 };
+		for (int i = 0; i < nd; ++i)
+		{
+			// һά
+			dims[i] = 1;
+			for (int k = 0; k < 3; ++k)
+			{
+				const int size = i + 1 < nd ? (*ds[k])[i] : ds[k]->GetBatch();
+				dims[i] = std::max(dims[i], size);
+				strides[k][i] = size == 1 ? 0 : stride[k];
+				stride[k] *= size;
+			}
+		}
+		CarpRobotSimd::BroadcastAdd(nd, dims, a.GetValue(), strides[0], b.GetValue(), strides[1], out.GetValue(), strides[2], f);
+	}
+
+	// ˷ out = a * b  out += a * b
+	// зֵ֣ʱз֣ÿһζǶľ˷
+	template <typename A, typename B>
+	void Gemm(Eigen::Map<Eigen::MatrixXf> out, const A& a, const B& b, bool add) const
+	{
+		if (m_device == nullptr)
+		{
+			if (add) out.noalias() += a * b;
+			else out.noalias() = a * b;
+			return;
+		}
+
+		const double cost = 2.0 * a.cols();
+		if (out.cols() >= 16 || out.cols() >= out.rows())
+		{
+			ParallelFor((int)out.cols(), cost * out.rows(), [&](int first, int last)
+			{
+				if (add) out.middleCols(first, last - first).noalias() += a * b.middleCols(first, last - first);
+				else out.middleCols(first, last - first).noalias() = a * b.middleCols(first, last - first);
+			});
+		}
+		else
+		{
+			ParallelFor((int)out.rows(), cost * out.cols(), [&](int first, int last)
+			{
+				if (add) out.middleRows(first, last - first).noalias() += a.middleRows(first, last - first) * b;
+				else out.middleRows(first, last - first).noalias() = a.middleRows(first, last - first) * b;
+			});
+		}
+	}
 	
 protected:
 	// ڵ±
 	std::vector<int> m_args;
 	// ڵάϢ
 	CarpRobotDim m_dim_out;
+
+protected:
+	bool m_refrence_memory = false;	// Ƿֱⲿڴ
+	int m_aux_size = 0;				// ڴС
+	int m_scratch_size = 0;			// ʱڴС
+	cr_real* m_aux = nullptr;		// ڴ
+	cr_real* m_scratch = nullptr;	// ʱڴ
+	const CarpRobotDevice* m_device = nullptr;	// м豸
 };
 
 // ڵ
+// ǰֱݵڴ棬ʹõַĹ캯ʱⲿڷ򴫲֮ǰ޸Ļͷ
+// ģʽҲһҪͬһstd::vectorһݣһBackward֮
 class CarpRobotInputNode : public CarpRobotNode
 {
 public:
@@ -867,10 +1303,13 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 0, u8"ڵ㲻в");
 		m_dim_out = m_dim;
+		m_refrence_memory = true;
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
+		// εⲿţ
+		CARP_ROBOT_ASSERT((int)m_pdata->size() >= m_dim.GetTotalSize(), u8"ݵĳСάϢܴС: dim=" << m_dim.ToString() << " size=" << m_pdata->size());
 		// ֱڴ
 		fx.RefrenceMemory(m_dim, (cr_real*)m_pdata->data());
 	}
@@ -892,6 +1331,7 @@ public:
 };
 
 // ڵ
+// ;ڵһֱڴ棬ʹõַʱⲿıڷ򴫲֮ǰ޸
 class CarpRobotScalarInputNode : public CarpRobotNode
 {
 public:
@@ -905,6 +1345,7 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 0, u8"ڵ㲻в");
 		m_dim_out = m_dim;
+		m_refrence_memory = true;
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
@@ -937,6 +1378,8 @@ public:
 public:
 	// 򴫲
 	virtual void AccumulateGrad(const CarpRobotTensor& graph) {}
+	// ӦĲ
+	virtual CarpRobotParameter* GetParameter() const { return nullptr; }
 };
 
 // ͨڵ
@@ -948,17 +1391,20 @@ public:
 public:
 	// ִз򴫵ݶ
 	void AccumulateGrad(const CarpRobotTensor& grad) override { m_parameter->AccumulateGrad(grad); }
+	CarpRobotParameter* GetParameter() const override { return m_parameter; }
 
 protected:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 0, u8"ڵ㲻в");
 		m_dim_out = m_parameter->GetValue().GetDim();
+		m_refrence_memory = true;
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		fx.tvec() = m_parameter->GetValue().tvec();
+		// ֱòڴ棬Ҫ
+		fx.RefrenceMemory(m_dim_out, m_parameter->GetValue().GetValue());
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -985,11 +1431,13 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 0, u8"ڵ㲻в");
 		m_dim_out = m_parameter->GetValue().GetDim();
+		m_refrence_memory = true;
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		fx.tvec() = m_parameter->GetValue().tvec();
+		// ֱòڴ棬Ҫ
+		fx.RefrenceMemory(m_dim_out, m_parameter->GetValue().GetValue());
 	}
 	
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1054,6 +1502,8 @@ protected:
 		for (int i = 0; i < std::min(xs[0]->Count(), xs[1]->Count()); ++i)
 			CARP_ROBOT_ASSERT((*xs[0])[i] == (*xs[1])[i] || std::min((*xs[0])[i], (*xs[1])[i]) == 1
 				, u8"CwiseSum: άȻ1");
+		CARP_ROBOT_ASSERT(xs[0]->GetBatch() == xs[1]->GetBatch() || std::min(xs[0]->GetBatch(), xs[1]->GetBatch()) == 1
+			, u8"CwiseSum: Ȼ1");
 		
 		std::vector<int> dims;
 		// άȱȽϴ
@@ -1070,61 +1520,16 @@ protected:
 				dims.push_back((*xs[1])[i]);
 		}
 
-		// ά
-		m_dim_out = CarpRobotDim(dims);
+		// άȣȡǸ
+		m_dim_out = CarpRobotDim(dims, std::max(xs[0]->GetBatch(), xs[1]->GetBatch()));
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 2, u8"CarpRobotCwiseSumNode ");
-		
-		auto& dim_left = xs[0]->GetDim();
-		auto& dim_right = xs[1]->GetDim();
-
-		// iƫƵȵλ
-		int i = 0;
-		while (i < fx.GetDim().Count() && dim_left[i] == dim_right[i])
-			i++;
 
-		// ˵ȫ
-		if (i == fx.GetDim().Count())
-		{
-			// ֱӰӼ
-			fx.tvec() = xs[0]->tvec() + xs[1]->tvec();
-		}
-		else
-		{
-			// ɢ
-			Eigen::array<ptrdiff_t, 5> bcast_left = { 1,1,1,1,1 }, bcast_right = { 1,1,1,1,1 };
-
-			// ԼұǷҪɢ
-			bool has_left = false, has_right = false;
-
-			// ʣµά
-			for (; i < fx.GetDim().Count(); ++i)
-			{
-				// ߵάȴұߣôұҪɢ
-				if (dim_left[i] > dim_right[i])
-				{
-					has_right = true;
-					bcast_right[i] = dim_left[i];
-				}
-				// ߵάСұߣôҪɢ
-				else if (dim_left[i] < dim_right[i])
-				{
-					has_left = true;
-					bcast_left[i] = dim_right[i];
-				}
-			}
-
-			// ɢ
-			if (has_right && has_left)
-				fx.tb<4>() = xs[0]->tb<4>().broadcast(bcast_left) + xs[1]->tb<4>().broadcast(bcast_right);
-			else if (has_right)
-				fx.tb<4>() = xs[0]->tb<4>() + xs[1]->tb<4>().broadcast(bcast_right);
-			else
-				fx.tb<4>() = xs[0]->tb<4>().broadcast(bcast_left) + xs[1]->tb<4>();
-		}
+		// άȵʱֱӰӣκ͸άȰҪɢ
+		Broadcast(*xs[0], *xs[1], fx, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Add(a, b); });
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1133,8 +1538,8 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		// ȵάȵ
-		int n_red = 0;
+		// ȵάȵҲһ
+		int n_red = xs[xs_i]->GetDim().GetBatch() != fx.GetDim().GetBatch() ? 1 : 0;
 		for (int j = 0; j < fx.GetDim().Count(); ++j)
 			n_red += xs[xs_i]->GetDim()[j] != fx.GetDim()[j] ? 1 : 0;
 
@@ -1161,13 +1566,13 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) const {
 
+		// ҪôһάȾΣǰά֮ʣµľ
 		Eigen::array<ptrdiff_t, ReductionOrder> red_axis;
 		if (ReductionOrder > 0) red_axis[ReductionOrder - 1] = 4;
 		int curr_red_axis = 0;
 
-		// morphһ1
-		// Ϊʱֶ֧Σд1
-		Eigen::array<ptrdiff_t, 5> morph = { 1,1,1,1,1 };
+		// morphһ
+		Eigen::array<ptrdiff_t, 5> morph = { 1,1,1,1,(ptrdiff_t)xs[xs_i]->GetDim().GetBatch() };
 		for (int di = 0; di < fx.GetDim().Count(); ++di)
 		{
 			// ǰάȳ룬ߺһ
@@ -1200,6 +1605,10 @@ class CarpRobotConstantPlusXNode : public CarpRobotNode
 public:
 	CarpRobotConstantPlusXNode(const std::vector<int>& a, cr_real v) : CarpRobotNode(a), m_value(v) {}
 
+public:
+	// ȡϵĳ
+	cr_real GetConstant() const { return m_value; }
+
 protected:
 	struct ConstAddOp
 	{
@@ -1290,13 +1699,23 @@ protected:
 		CARP_ROBOT_ASSERT(xs.size() == 2, "CarpRobotMatrixMultiplyNode ");
 		CARP_ROBOT_ASSERT(xs[0]->Cols() == xs[1]->Rows(), u8"CarpRobotMatrixMultiplyNode ǰбں:" << xs[0]->Cols() << "!=" << xs[1]->Rows());
 		CARP_ROBOT_ASSERT(xs[0]->Count() <= 2 && xs[1]->Count() <= 2, "CarpRobotMatrixMultiplyNode 2ά");
+		CARP_ROBOT_ASSERT(xs[0]->GetBatch() == xs[1]->GetBatch() || std::min(xs[0]->GetBatch(), xs[1]->GetBatch()) == 1, u8"CarpRobotMatrixMultiplyNode Ȼ1");
 
-		m_dim_out = CarpRobotDim({ xs[0]->Rows(), xs[1]->Cols() });
+		m_dim_out = CarpRobotDim({ xs[0]->Rows(), xs[1]->Cols() }, std::max(xs[0]->GetBatch(), xs[1]->GetBatch()));
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		fx.m().noalias() = xs[0]->m() * xs[1]->m();
+		// ֻһ(һǲ)ұΰƴһξ˷
+		if (xs[0]->GetDim().GetBatch() == 1)
+		{
+			Gemm(fx.mb(), xs[0]->m(), xs[1]->mb(), false);
+		}
+		else
+		{
+			for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+				Gemm(fx.m(b), xs[0]->m(b), xs[1]->m(b), false);
+		}
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1307,9 +1726,31 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs_i < 2, "CarpRobotMatrixMultiplyNode ");
 		if (xs_i == 0)
-			dEdxi.m().noalias() += dEdf.m() * xs[1]->m().transpose();
+		{
+			// ֻһΣεݶھ˷ֱۼ
+			if (xs[0]->GetDim().GetBatch() == 1)
+			{
+				Gemm(dEdxi.m(), dEdf.mb(), xs[1]->mb().transpose(), true);
+			}
+			else
+			{
+				for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+					Gemm(dEdxi.m(b), dEdf.m(b), xs[1]->m(b).transpose(), true);
+			}
+		}
 		else
-			dEdxi.m().noalias() += xs[0]->m().transpose() * dEdf.m();
+		{
+			if (xs[0]->GetDim().GetBatch() == 1)
+			{
+				Gemm(dEdxi.mb(), xs[0]->m().transpose(), dEdf.mb(), true);
+			}
+			else
+			{
+				// ұֻһʱm(b)ʼͬһεݶȶۼӵ
+				for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+					Gemm(dEdxi.m(b), xs[0]->m(b).transpose(), dEdf.m(b), true);
+			}
+		}
 	}
 };
 
@@ -1362,6 +1803,8 @@ protected:
 		for (int i = 0; i < std::min(xs[0]->Count(), xs[1]->Count()); ++i)
 			CARP_ROBOT_ASSERT((*xs[0])[i] == (*xs[1])[i] || std::min((*xs[0])[i], (*xs[1])[i]) == 1
 				, u8"CwiseMultiply: άȻ1");
+		CARP_ROBOT_ASSERT(xs[0]->GetBatch() == xs[1]->GetBatch() || std::min(xs[0]->GetBatch(), xs[1]->GetBatch()) == 1
+			, u8"CwiseMultiply: Ȼ1");
 
 		std::vector<int> dims;
 		// άȱȽϴ
@@ -1378,61 +1821,16 @@ protected:
 				dims.push_back((*xs[1])[i]);
 		}
 
-		// ά
-		m_dim_out = CarpRobotDim(dims);
+		// άȣȡǸ
+		m_dim_out = CarpRobotDim(dims, std::max(xs[0]->GetBatch(), xs[1]->GetBatch()));
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		CARP_ROBOT_ASSERT(xs.size() == 2, u8"CarpRobotCwiseSumNode ");
-
-		auto& dim_left = xs[0]->GetDim();
-		auto& dim_right = xs[1]->GetDim();
-
-		// iƫƵȵλ
-		int i = 0;
-		while (i < fx.GetDim().Count() && dim_left[i] == dim_right[i])
-			i++;
-
-		// ˵ȫ
-		if (i == fx.GetDim().Count())
-		{
-			// ֱӰӼ
-			fx.tvec() = xs[0]->tvec() + xs[1]->tvec();
-		}
-		else
-		{
-			// ɢ
-			Eigen::array<ptrdiff_t, 5> bcast_left = { 1,1,1,1,1 }, bcast_right = { 1,1,1,1,1 };
-
-			// ԼұǷҪɢ
-			bool has_left = false, has_right = false;
-
-			// ʣµά
-			for (; i < fx.GetDim().Count(); ++i)
-			{
-				// ߵάȴұߣôұҪɢ
-				if (dim_left[i] > dim_right[i])
-				{
-					has_right = true;
-					bcast_right[i] = dim_left[i];
-				}
-				// ߵάСұߣôҪɢ
-				else if (dim_left[i] < dim_right[i])
-				{
-					has_left = true;
-					bcast_left[i] = dim_right[i];
-				}
-			}
+		CARP_ROBOT_ASSERT(xs.size() == 2, u8"CarpRobotCwiseMultiplyNode ");
 
-			// ɢ
-			if (has_right && has_left)
-				fx.tb<4>() = xs[0]->tb<4>().broadcast(bcast_left) * xs[1]->tb<4>().broadcast(bcast_right);
-			else if (has_right)
-				fx.tb<4>() = xs[0]->tb<4>() * xs[1]->tb<4>().broadcast(bcast_right);
-			else
-				fx.tb<4>() = xs[0]->tb<4>().broadcast(bcast_left) * xs[1]->tb<4>();
-		}
+		// άȵʱֱӰˣκ͸άȰҪɢ
+		Broadcast(*xs[0], *xs[1], fx, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Mul(a, b); });
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1441,70 +1839,8 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		// ȵάȵ
-		int n_red = 0;
-		bool must_red = false;
-		for (int j = 0; j < fx.GetDim().Count(); ++j)
-		{
-			n_red += xs[xs_i]->GetDim()[j] != fx.GetDim()[j] ? 1 : 0;
-			must_red = must_red || xs[0]->GetDim()[j] != xs[1]->GetDim()[j];
-		}
-
-		// ȫȣôֱ
-		if (!must_red)
-		{
-			dEdxi.tvec() += dEdf.tvec();
-		}
-		else
-		{
-			CARP_ROBOT_ASSERT(n_red < 5, u8"ֵֻ֧4ά");
-			// ݲȵάѡͬķ򴫲
-			if (n_red == 0) BackwardImpl<0>(xs, fx, dEdf, xs_i, dEdxi);
-			else if (n_red == 1) BackwardImpl<1>(xs, fx, dEdf, xs_i, dEdxi);
-			else if (n_red == 2) BackwardImpl<2>(xs, fx, dEdf, xs_i, dEdxi);
-			else if (n_red == 3) BackwardImpl<3>(xs, fx, dEdf, xs_i, dEdxi);
-			else if (n_red == 4) BackwardImpl<4>(xs, fx, dEdf, xs_i, dEdxi);
-		}
-	}
-
-	template <int ReductionOrder>
-	void BackwardImpl(const std::vector<const CarpRobotTensor*>& xs,
-		const CarpRobotTensor& fx,
-		const CarpRobotTensor& dEdf,
-		int xs_i,
-		CarpRobotTensor& dEdxi) const {
-
-		Eigen::array<ptrdiff_t, ReductionOrder> red_axis;
-		if (ReductionOrder > 0) red_axis[ReductionOrder - 1] = 4;
-		int curr_red_axis = 0;
-
-		// morphһ1
-		// Ϊʱֶ֧Σд1
-		Eigen::array<ptrdiff_t, 5> morph = { 1,1,1,1,1 };
-		Eigen::array<ptrdiff_t, 5> bcast_other = { 1,1,1,1,1 };
-		for (int di = 0; di < fx.GetDim().Count(); ++di)
-		{
-			// ǰάȳ룬ߺһ
-			// ôά±¼ЩάҪsum
-			if (xs[xs_i]->GetDim()[di] != fx.GetDim()[di])
-			{
-				red_axis[curr_red_axis] = di;
-				curr_red_axis++;
-			}
-
-			// άһ
-			morph[di] = xs[xs_i]->GetDim()[di];
-			if (xs[1 - xs_i]->GetDim()[di] == 1)
-				bcast_other[di] = fx.GetDim()[di];
-		}
-
-		// dEdf.tb<4>() άΪ (d[0], d[1], d[2], d[3], d[4], bd)
-		// dEdf.tb<4>().sum(red_axis) red_axisбǵάȫ
-		// dEdf.tb<4>().sum(red_axis).reshape(morph) άΪΪ(d[0], d[1], d[2], d[3], d[4], bd)
-
-		// sum൱ڰѵʱɢȥĶӦֵɢǸά
-		// ʹreshapeֵΪľʽȻ򴫲
-		dEdxi.tb<4>() += (dEdf.tb<4>() * xs[1 - xs_i]->tb<4>().broadcast(bcast_other)).sum(red_axis).reshape(morph);
+		// dEdxi += dEdf * һ룬һ밴Ҫɢʱɢȥά֮
+		BroadcastAdd(dEdf, *xs[1 - xs_i], dEdxi, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Mul(a, b); });
 	}
 };
 
@@ -1525,6 +1861,8 @@ protected:
 		for (int i = 0; i < std::min(xs[0]->Count(), xs[1]->Count()); ++i)
 			CARP_ROBOT_ASSERT((*xs[0])[i] == (*xs[1])[i] || (*xs[1])[i] == 1
 				, u8"CwiseQuotient: άȻҲά1");
+		CARP_ROBOT_ASSERT(xs[0]->GetBatch() == xs[1]->GetBatch() || xs[1]->GetBatch() == 1
+			, u8"CwiseQuotient: ȻҲ1");
 
 		std::vector<int> dims;
 		// άȱȽϴ
@@ -1542,28 +1880,16 @@ protected:
 		}
 
 		// ά
-		m_dim_out = CarpRobotDim(dims);
+		m_dim_out = CarpRobotDim(dims, xs[0]->GetBatch());
+
+		// Ҳɢʱ򣬷򴫲ҪһҲСڴݶ
+		m_scratch_size = xs[0]->GetTotalSize() == xs[1]->GetTotalSize() ? 0 : xs[1]->GetTotalSize();
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		// ܺһ£ôֱӳ
-		if (xs[0]->GetDim().GetTotalSize() == xs[1]->GetDim().GetTotalSize())
-		{
-			fx.tb<4>() = xs[0]->tb<4>() / xs[1]->tb<4>();
-		}
-		else
-		{
-			// ұСάȱΪɢ
-			Eigen::array<ptrdiff_t, 5> bcast = { 1,1,1,1,1 };
-			for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
-			{
-				if (xs[1]->GetDim()[di] == 1)
-					bcast[di] = xs[0]->GetDim()[di];
-			}
-			// ұ߲ɢ֮Ȼг
-			fx.tb<4>() = xs[0]->tb<4>() / xs[1]->tb<4>().broadcast(bcast);
-		}
+		// ұߵĲҪɢȻг
+		Broadcast(*xs[0], *xs[1], fx, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Div(a, b); });
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1574,93 +1900,26 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs_i < 2, "CarpRobotCwiseQuotientNode ");
 
-		// ߵĲ
+		// ߵĲ dEdx0 += dEdf / x1ұߵĲҪɢ
 		if (xs_i == 0)
 		{
-			// ܺһ£ôֱӳ
-			if (xs[0]->GetDim().GetTotalSize() == xs[1]->GetDim().GetTotalSize())
-			{
-				dEdxi.tb<4>() += dEdf.tb<4>() / xs[1]->tb<4>();
-			}
-			else
-			{
-				// ұ߲άȺ߲һ£ôͱΪɢ
-				Eigen::array<ptrdiff_t, 5> bcast = { 1,1,1,1,1 };
-				for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
-				{
-					if (xs[0]->GetDim()[di] != xs[1]->GetDim()[di])
-						bcast[di] = xs[0]->GetDim()[di];
-				}
-
-				// ұ߲ɢ֮Ȼг
-				dEdxi.tb<4>() += dEdf.tb<4>() / xs[1]->tb<4>().broadcast(bcast);
-			}
+			BroadcastAdd(dEdf, *xs[1], dEdxi, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Div(a, b); });
 		}
 		// ұߵĲ
-		else
+		else if (xs[0]->GetDim().GetTotalSize() == xs[1]->GetDim().GetTotalSize())
 		{
-			if (xs[0]->GetDim().GetTotalSize() == xs[1]->GetDim().GetTotalSize())
-			{
-				dEdxi.tb<4>() -= (dEdf.tb<4>() / xs[1]->tb<4>().square() * xs[0]->tb<4>());
-			}
-			else
-			{
-				// ͳάȲȵ
-				int n_red = 0;
-				for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
-					if (xs[0]->GetDim()[di] != xs[1]->GetDim()[di]) n_red++;
-				CARP_ROBOT_ASSERT(n_red < 5, u8"ֵֻ֧4ά");
-				if (n_red == 0)      BackwardImpl<0>(xs, fx, dEdf, xs_i, dEdxi);
-				else if (n_red == 1) BackwardImpl<1>(xs, fx, dEdf, xs_i, dEdxi);
-				else if (n_red == 2) BackwardImpl<2>(xs, fx, dEdf, xs_i, dEdxi);
-				else if (n_red == 3) BackwardImpl<3>(xs, fx, dEdf, xs_i, dEdxi);
-				else if (n_red == 4) BackwardImpl<4>(xs, fx, dEdf, xs_i, dEdxi);
-			}
+			dEdxi.tb<4>() -= (dEdf.tb<4>() / xs[1]->tb<4>().square() * xs[0]->tb<4>());
 		}
-	}
-
-	template <int ReductionOrder>
-	void BackwardImpl(const std::vector<const CarpRobotTensor*>& xs,
-		const CarpRobotTensor& fx,
-		const CarpRobotTensor& dEdf,
-		int xs_i,
-		CarpRobotTensor& dEdxi) const {
-
-		Eigen::array<ptrdiff_t, ReductionOrder> red_axis;
-		if (ReductionOrder > 0) red_axis[ReductionOrder - 1] = 4;
-
-		// Ѳȵά±ȫ
-		int curr_red_axis = 0;
-		for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
-		{
-			if (xs[0]->GetDim()[di] != xs[1]->GetDim()[di])
-			{
-				red_axis[curr_red_axis] = di;
-				curr_red_axis++;
-			}
-		}
-
-		// morphһ1
-		// Ϊʱֶ֧Σд1
-		Eigen::array<ptrdiff_t, 5> morph = { 1,1,1,1,1 };
-		for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
-		{
-			morph[di] = xs[xs_i]->GetDim()[di];
-		}
-
-		// ɢϢ
-		Eigen::array<ptrdiff_t, 5> bcast = { 1,1,1,1,1 };
-		for (int di = 0; di < xs[0]->GetDim().Count(); ++di)
+		else
 		{
-			if (xs[0]->GetDim()[di] != xs[1]->GetDim()[di])
-				bcast[di] = xs[0]->GetDim()[di];
+			// dEdx1 -= sum(dEdf * x0 / x1^2) = sum(dEdf * fx) / x1
+			// Ϊx1ɢάǳȰdEdf * fxx1ĴСٳx1
+			CarpRobotTensor sum(xs[1]->GetDim(), m_scratch);
+			sum.Zero();
+			BroadcastAdd(dEdf, fx, sum, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b) { return CarpRobotSimd::Mul(a, b); });
+			CarpRobotSimd::Binary(sum.GetValue(), xs[1]->GetValue(), dEdxi.GetValue(), xs[1]->GetDim().GetTotalSize()
+				, [](CarpRobotSimd::Pack a, CarpRobotSimd::Pack b, CarpRobotSimd::Pack y) { return CarpRobotSimd::Sub(y, CarpRobotSimd::Div(a, b)); });
 		}
-
-		CarpRobotTensor xs1_squared(xs[1]->GetDim());
-		// xs1ƽ
-		xs1_squared.tb<4>() = xs[1]->tb<4>().square();
-		// 򴫲
-		dEdxi.tb<4>() -= (dEdf.tb<4>() / xs1_squared.tb<4>().broadcast(bcast) * xs[0]->tb<4>()).sum(red_axis).reshape(morph);
 	}
 };
 
@@ -1676,10 +1935,6 @@ protected:
 	{
 		inline const cr_real operator() (cr_real x) const { return 1.0f / (1.0f + std::exp(-x)); }
 	};
-	struct ScalarLogisticSigmoidBackwardOp
-	{
-		inline const cr_real operator() (cr_real t, cr_real d) const { return (1.0f - t) * t * d; }
-	};
 
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
@@ -1689,7 +1944,10 @@ protected:
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		fx.tvec() = xs[0]->tvec().unaryExpr(ScalarLogisticSigmoidOp());
+		if (CarpRobotSimd::IsApproximate())
+			CarpRobotSimd::Sigmoid(xs[0]->GetValue(), fx.GetValue(), fx.GetDim().GetTotalSize());
+		else
+			fx.tvec() = xs[0]->tvec().unaryExpr(ScalarLogisticSigmoidOp());
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1698,7 +1956,9 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		dEdxi.tvec() += fx.tvec().binaryExpr(dEdf.tvec(), ScalarLogisticSigmoidBackwardOp());
+		// dEdxi += (1 - t) * t * d
+		CarpRobotSimd::Binary(fx.GetValue(), dEdf.GetValue(), dEdxi.GetValue(), fx.GetDim().GetTotalSize(),
+			[](CarpRobotSimd::Pack t, CarpRobotSimd::Pack d, CarpRobotSimd::Pack y) { return CarpRobotSimd::Add(y, CarpRobotSimd::Mul(CarpRobotSimd::Mul(CarpRobotSimd::Sub(CarpRobotSimd::Set(1.0f), t), t), d)); });
 	}
 };
 
@@ -1710,11 +1970,6 @@ public:
 	~CarpRobotTanhNode() {}
 
 protected:
-	struct ScalarTanhBackwardOp
-	{
-		inline const cr_real operator() (const cr_real& t, const cr_real& d) const { return (1 - t * t) * d; }
-	};
-
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotTanhNode һ");
@@ -1723,7 +1978,10 @@ protected:
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		fx.tvec() = xs[0]->tvec().tanh();
+		if (CarpRobotSimd::IsApproximate())
+			CarpRobotSimd::Tanh(xs[0]->GetValue(), fx.GetValue(), fx.GetDim().GetTotalSize());
+		else
+			fx.tvec() = xs[0]->tvec().tanh();
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -1732,7 +1990,9 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		dEdxi.tvec() += fx.tvec().binaryExpr(dEdf.tvec(), ScalarTanhBackwardOp());
+		// dEdxi += (1 - t * t) * d
+		CarpRobotSimd::Binary(fx.GetValue(), dEdf.GetValue(), dEdxi.GetValue(), fx.GetDim().GetTotalSize(),
+			[](CarpRobotSimd::Pack t, CarpRobotSimd::Pack d, CarpRobotSimd::Pack y) { return CarpRobotSimd::Add(y, CarpRobotSimd::Mul(CarpRobotSimd::Sub(CarpRobotSimd::Set(1.0f), CarpRobotSimd::Mul(t, t)), d)); });
 	}
 };
 
@@ -1778,18 +2038,28 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotRectifyNode һ");
 		m_dim_out = *xs[0];
+		// ǰҪֵܺͣ򴫲ÿεÿһҪһֵ
+		m_scratch_size = std::max(2, m_dim_out.Cols() * m_dim_out.GetBatch());
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		CarpRobotTensor z(CarpRobotDim({ 1 }));
-		CarpRobotTensor m(CarpRobotDim({ 1 }));
+		CarpRobotTensor z(CarpRobotDim({ 1 }), m_scratch);
+		CarpRobotTensor m(CarpRobotDim({ 1 }), m_scratch + 1);
 
+		// εݰУÿεÿһе
 		int size = xs[0]->GetDim()[0];
-		int num_cols = xs[0]->GetDim()[1];
+		int num_cols = xs[0]->GetDim()[1] * xs[0]->GetDim().GetBatch();
 
 		cr_real* col_x_value = xs[0]->GetValue();
 		cr_real* col_fx_value = fx.GetValue();
+		if (CarpRobotSimd::IsApproximate())
+		{
+			for (int col = 0; col < num_cols; ++col)
+				CarpRobotSimd::Softmax(col_x_value + (size_t)col * size, col_fx_value + (size_t)col * size, size);
+			return;
+		}
+
 		CarpRobotDim col_dim = CarpRobotDim({ xs[0]->GetDim()[0] });
 		for (size_t col = 0; col < num_cols; ++col)
 		{
@@ -1817,12 +2087,12 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		CarpRobotTensor z(CarpRobotDim({ fx.GetDim().Cols() }));
+		CarpRobotTensor z(CarpRobotDim({ fx.GetDim().Cols() }, fx.GetDim().GetBatch()), m_scratch);
 		Eigen::array<ptrdiff_t, 1> red_axis = { 0 };
 		z.tb<1>() = (fx.tb<2>() * dEdf.tb<2>()).sum(red_axis);
 
 		int size = xs[0]->GetDim()[0];
-		int num_cols = xs[0]->GetDim()[1];
+		int num_cols = xs[0]->GetDim()[1] * xs[0]->GetDim().GetBatch();
 
 		cr_real* col_fx_value = fx.GetValue();
 		cr_real* col_dEdf_value = dEdf.GetValue();
@@ -1855,12 +2125,24 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotLogSoftmaxNode һ");
 		m_dim_out = *xs[0];
+		// ÿεÿһҪһֵһܺ
+		m_scratch_size = m_dim_out.Cols() * m_dim_out.GetBatch() * 2;
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		CarpRobotTensor z(CarpRobotDim({ xs[0]->GetDim().Cols() }));
-		CarpRobotTensor m(CarpRobotDim({ xs[0]->GetDim().Cols() }));
+		const int bd = xs[0]->GetDim().GetBatch();
+		if (CarpRobotSimd::IsApproximate())
+		{
+			const int size = xs[0]->GetDim()[0];
+			const int num_cols = xs[0]->GetDim()[1] * bd;
+			for (int col = 0; col < num_cols; ++col)
+				CarpRobotSimd::LogSoftmax(xs[0]->GetValue() + (size_t)col * size, fx.GetValue() + (size_t)col * size, size);
+			return;
+		}
+
+		CarpRobotTensor z(CarpRobotDim({ xs[0]->GetDim().Cols() }, bd), m_scratch);
+		CarpRobotTensor m(CarpRobotDim({ xs[0]->GetDim().Cols() }, bd), m_scratch + xs[0]->GetDim().Cols() * bd);
 		xs[0]->Logsumexp(m, z);
 
 		if (fx.GetDim().GetTotalSize() == fx.GetDim().Rows())
@@ -1869,8 +2151,9 @@ protected:
 		}
 		else
 		{
+			// εݰУzеֵҲǰ
 			int size = xs[0]->GetDim()[0];
-			int num_cols = xs[0]->GetDim()[1];
+			int num_cols = xs[0]->GetDim()[1] * bd;
 
 			auto col_fx_value = fx.GetValue();
 			auto col_x_value = xs[0]->GetValue();
@@ -1892,12 +2175,12 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		CarpRobotTensor z(CarpRobotDim({ xs[0]->GetDim().Cols() }));
+		CarpRobotTensor z(CarpRobotDim({ xs[0]->GetDim().Cols() }, xs[0]->GetDim().GetBatch()), m_scratch);
 		Eigen::array<ptrdiff_t, 1> red_axis = { 0 };
 		z.tb<1>() = dEdf.tb<2>().sum(red_axis);
 
 		int size = xs[0]->GetDim()[0];
-		int num_cols = xs[0]->GetDim()[1];
+		int num_cols = xs[0]->GetDim()[1] * xs[0]->GetDim().GetBatch();
 
 		cr_real* col_fx_value = fx.GetValue();
 		cr_real* col_dEdf_value = dEdf.GetValue();
@@ -1931,15 +2214,17 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotDropoutNode һ");
 		m_dim_out = *xs[0];
+		// Ҫ򴫲
+		m_aux_size = m_dim_out.GetTotalSize();
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
 		if (*m_ptraining)
 		{
-			m_aux_mem.SetDim(fx.GetDim());
-			m_aux_mem.RandomizeBernoulli((1.f - m_value), 1.f / (1.f - m_value));
-			fx.tvec() = xs[0]->tvec() * m_aux_mem.tvec();
+			CarpRobotTensor mask(fx.GetDim(), m_aux);
+			mask.RandomizeBernoulli((1.f - m_value), 1.f / (1.f - m_value));
+			fx.tvec() = xs[0]->tvec() * mask.tvec();
 		}
 		else
 		{
@@ -1954,7 +2239,10 @@ protected:
 		CarpRobotTensor& dEdxi) override
 	{
 		if (*m_ptraining)
-			dEdxi.tvec() += dEdf.tvec() * m_aux_mem.tvec();
+		{
+			CarpRobotTensor mask(fx.GetDim(), m_aux);
+			dEdxi.tvec() += dEdf.tvec() * mask.tvec();
+		}
 		else
 			dEdxi.tvec() += dEdf.tvec();
 	}
@@ -1963,7 +2251,6 @@ private:
 	int m_training = 0;
 	const int* m_ptraining = nullptr;
 	cr_real m_value;
-	CarpRobotTensor m_aux_mem;
 };
 
 // conv2d 
@@ -1979,6 +2266,12 @@ public:
 	CarpRobotConv2DNode(const std::vector<int>& a, int stride_width, int stride_height = 1, bool padding_type = true) : CarpRobotNode(a), m_stride({stride_width, stride_height}), m_padding_type(padding_type) {}
 	~CarpRobotConv2DNode() {}
 
+public:
+	// iάȵĲ
+	int GetStride(int i) const { return m_stride[i]; }
+	// trueʾVALIDfalseʾSAME
+	bool GetPaddingType() const { return m_padding_type; }
+
 protected:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
@@ -2001,33 +2294,39 @@ protected:
 				output_shape[i] = static_cast<int>(std::ceil(input_dim / s));
 		}
 		
-		m_dim_out = CarpRobotDim(output_shape);
+		// ξǾNά
+		m_dim_out = CarpRobotDim(output_shape, xs[0]->GetBatch());
+
+		// ʱڴη CHWN_y(CHWN_dy)Ȼ;˵ת
+		m_scratch_size = m_dim_out.GetTotalSize() + xs[0]->GetTotalSize() + xs[1]->GetTotalSize();
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
 		Eigen::PaddingType padding_type = m_padding_type ? Eigen::PADDING_VALID : Eigen::PADDING_SAME;
 		
-		CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }));
+		CarpRobotTensor CHWN_y(CarpRobotDim({ fx.GetDim()[2], fx.GetDim()[0], fx.GetDim()[1] }, fx.GetDim().GetBatch()), m_scratch);
+		cr_real* scratch = m_scratch + fx.GetDim().GetTotalSize();
+
+		CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }, xs[0]->GetDim().GetBatch()), scratch);
 		Eigen::array<ptrdiff_t, 4> shuffles;
 		shuffles[0] = 2; shuffles[1] = 0; shuffles[2] = 1; shuffles[3] = 3;
-		CHWN_x.tb<3>() = xs[0]->tb<3>().shuffle(shuffles);
+		Assign(CHWN_x.tb<3>(), xs[0]->tb<3>().shuffle(shuffles));
 		
-		CarpRobotTensor NCHW_f(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }));
+		CarpRobotTensor NCHW_f(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }), scratch + xs[0]->GetDim().GetTotalSize());
 		shuffles[0] = 3; shuffles[1] = 2; shuffles[2] = 0; shuffles[3] = 1;
-		NCHW_f.t<4>() = xs[1]->t<4>().shuffle(shuffles);
+		Assign(NCHW_f.t<4>(), xs[1]->t<4>().shuffle(shuffles));
 
-		CarpRobotTensor CHWN_y(CarpRobotDim({ fx.GetDim()[2], fx.GetDim()[0], fx.GetDim()[1] }));
-		CHWN_y.tb<3>() = Eigen::SpatialConvolution(CHWN_x.tb<3>(), NCHW_f.t<4>(), m_stride[0], m_stride[1], padding_type);
+		Assign(CHWN_y.tb<3>(), Eigen::SpatialConvolution(CHWN_x.tb<3>(), NCHW_f.t<4>(), m_stride[0], m_stride[1], padding_type));
 		shuffles[0] = 1; shuffles[1] = 2; shuffles[2] = 0; shuffles[3] = 3;
-		fx.tb<3>() = CHWN_y.tb<3>().shuffle(shuffles);
+		Assign(fx.tb<3>(), CHWN_y.tb<3>().shuffle(shuffles));
 		if (xs.size() == 3)
 		{
-			CarpRobotTensor bias(CarpRobotDim({ fx.GetDim()[0], fx.GetDim()[1], 1 }), CHWN_x.GetValue());
+			CarpRobotTensor bias(CarpRobotDim({ fx.GetDim()[0], fx.GetDim()[1] }, fx.GetDim().GetBatch()), CHWN_x.GetValue());
 			for (int i = 0; i < fx.GetDim()[2]; ++i)
 			{
 				bias.Constant(xs[2]->vec()(i));
-				fx.tb<3>().chip<2>(i) += bias.t<3>();
+				fx.tb<3>().chip<2>(i) += bias.tb<2>();
 			}
 		}
 	}
@@ -2037,38 +2336,37 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		CarpRobotTensor CHWN_dy(CarpRobotDim({ dEdf.GetDim()[2], dEdf.GetDim()[0], dEdf.GetDim()[1] }));
+		CarpRobotTensor CHWN_dy(CarpRobotDim({ dEdf.GetDim()[2], dEdf.GetDim()[0], dEdf.GetDim()[1] }, dEdf.GetDim().GetBatch()), m_scratch);
+		cr_real* scratch = m_scratch + dEdf.GetDim().GetTotalSize();
 		Eigen::array<ptrdiff_t, 4> shuffles;
 		shuffles[0] = 2; shuffles[1] = 0; shuffles[2] = 1; shuffles[3] = 3;
-		CHWN_dy.tb<3>() = dEdf.tb<3>().shuffle(shuffles);
+		Assign(CHWN_dy.tb<3>(), dEdf.tb<3>().shuffle(shuffles));
 		
 		if (xs_i == 0) // backward w.r.t the input
 		{
-			CarpRobotTensor NCHW_f(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }));
+			CarpRobotTensor NCHW_f(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }), scratch);
 			shuffles[0] = 3; shuffles[1] = 2; shuffles[2] = 0; shuffles[3] = 1;
-			NCHW_f.t<4>() = xs[1]->t<4>().shuffle(shuffles);
+			Assign(NCHW_f.t<4>(), xs[1]->t<4>().shuffle(shuffles));
 			
-			CarpRobotTensor CHWN_dEdxi(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }));
-			CHWN_dEdxi.tb<3>() = Eigen::SpatialConvolutionBackwardInput(NCHW_f.t<4>(), CHWN_dy.tb<3>(), xs[0]->GetDim()[0], xs[0]->GetDim()[1], m_stride[0], m_stride[1]);
+			CarpRobotTensor CHWN_dEdxi(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }, xs[0]->GetDim().GetBatch()), scratch + xs[1]->GetDim().GetTotalSize());
+			Assign(CHWN_dEdxi.tb<3>(), Eigen::SpatialConvolutionBackwardInput(NCHW_f.t<4>(), CHWN_dy.tb<3>(), xs[0]->GetDim()[0], xs[0]->GetDim()[1], m_stride[0], m_stride[1]));
 			
-			CarpRobotTensor HWCN_dEdxi(xs[0]->GetDim());
+			// תHWCNֱ֮ۼӣپм
 			shuffles[0] = 1; shuffles[1] = 2; shuffles[2] = 0; shuffles[3] = 3;
-			HWCN_dEdxi.tb<3>() = CHWN_dEdxi.tb<3>().shuffle(shuffles);
-			dEdxi.tb<3>() += HWCN_dEdxi.tb<3>();
+			AssignAdd(dEdxi.tb<3>(), CHWN_dEdxi.tb<3>().shuffle(shuffles));
 		}
 		else if (xs_i == 1) //backward w.r.t the kernel
 		{
-			CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }));
+			CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }, xs[0]->GetDim().GetBatch()), scratch);
 			shuffles[0] = 2; shuffles[1] = 0; shuffles[2] = 1; shuffles[3] = 3;
-			CHWN_x.tb<3>() = xs[0]->tb<3>().shuffle(shuffles);
+			Assign(CHWN_x.tb<3>(), xs[0]->tb<3>().shuffle(shuffles));
 			
-			CarpRobotTensor NCHW_dEdxi(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }));
-			NCHW_dEdxi.t<4>() = Eigen::SpatialConvolutionBackwardKernel(CHWN_x.tb<3>(), CHWN_dy.tb<3>(), xs[1]->GetDim()[0], xs[1]->GetDim()[1], m_stride[0], m_stride[1], m_padding_type);
+			CarpRobotTensor NCHW_dEdxi(CarpRobotDim({ xs[1]->GetDim()[3], xs[1]->GetDim()[2], xs[1]->GetDim()[0], xs[1]->GetDim()[1] }), scratch + xs[0]->GetDim().GetTotalSize());
+			Assign(NCHW_dEdxi.t<4>(), Eigen::SpatialConvolutionBackwardKernel(CHWN_x.tb<3>(), CHWN_dy.tb<3>(), xs[1]->GetDim()[0], xs[1]->GetDim()[1], m_stride[0], m_stride[1], m_padding_type));
 			
-			CarpRobotTensor HWCN_dEdxi(xs[1]->GetDim());
+			// תHWCNֱ֮ۼӣپм
 			shuffles[0] = 2; shuffles[1] = 3; shuffles[2] = 1; shuffles[3] = 0;
-			HWCN_dEdxi.t<4>() = NCHW_dEdxi.t<4>().shuffle(shuffles);
-			dEdxi.t<4>() += HWCN_dEdxi.t<4>();
+			AssignAdd(dEdxi.t<4>(), NCHW_dEdxi.t<4>().shuffle(shuffles));
 		}
 		else //backward w.r.t the bias
 		{ 
@@ -2118,7 +2416,10 @@ protected:
 			else
 				output_shape[i] = static_cast<int>(std::ceil(input_dim / s));
 		}
-		m_dim_out = CarpRobotDim(output_shape);
+		m_dim_out = CarpRobotDim(output_shape, xs[0]->GetBatch());
+
+		// ʱڴη CHWN_y  CHWN_x
+		m_scratch_size = m_dim_out.GetTotalSize() + xs[0]->GetTotalSize();
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
@@ -2126,17 +2427,17 @@ protected:
 		Eigen::PaddingType padding_type = m_padding_type ? Eigen::PADDING_VALID : Eigen::PADDING_SAME;
 
 		// convert x from HWCN to CHWN
-		CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }));
+		CarpRobotTensor CHWN_x(CarpRobotDim({ xs[0]->GetDim()[2], xs[0]->GetDim()[0], xs[0]->GetDim()[1] }, xs[0]->GetDim().GetBatch()), m_scratch + fx.GetDim().GetTotalSize());
 		Eigen::array<ptrdiff_t, 4> shuffles;
 		shuffles[0] = 2; shuffles[1] = 0; shuffles[2] = 1; shuffles[3] = 3;
-		CHWN_x.tb<3>() = xs[0]->tb<3>().shuffle(shuffles);
+		Assign(CHWN_x.tb<3>(), xs[0]->tb<3>().shuffle(shuffles));
 
 		// allocate temp memory and compute
-		CarpRobotTensor CHWN_y(CarpRobotDim({ fx.GetDim()[2], fx.GetDim()[0], fx.GetDim()[1] }));
-		CHWN_y.tb<3>() = Eigen::SpatialMaxPooling(CHWN_x.tb<3>(), m_ksize[0], m_ksize[1], m_stride[0], m_stride[1], padding_type);
+		CarpRobotTensor CHWN_y(CarpRobotDim({ fx.GetDim()[2], fx.GetDim()[0], fx.GetDim()[1] }, fx.GetDim().GetBatch()), m_scratch);
+		Assign(CHWN_y.tb<3>(), Eigen::SpatialMaxPooling(CHWN_x.tb<3>(), m_ksize[0], m_ksize[1], m_stride[0], m_stride[1], padding_type));
 		// convert y from CHWN to HWCN
 		shuffles[0] = 1; shuffles[1] = 2; shuffles[2] = 0; shuffles[3] = 3;
-		fx.tb<3>() = CHWN_y.tb<3>().shuffle(shuffles);
+		Assign(fx.tb<3>(), CHWN_y.tb<3>().shuffle(shuffles));
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -2150,40 +2451,48 @@ protected:
 		int pad_top = m_padding_type ? 0 : pad_along_height / 2;
 		int pad_left = m_padding_type ? 0 : pad_along_width / 2;
 
-		for (int i = 0; i < fx.GetDim()[0]; ++i)
+		// ÿεÿֵͨλãдݶȻصԲ
+		const int channels = fx.GetDim()[2];
+		const double cost = 2.0 * fx.GetDim()[0] * fx.GetDim()[1] * m_ksize[0] * m_ksize[1];
+		ParallelFor(fx.GetDim().GetBatch() * channels, cost, [&](int first, int last)
 		{
-			for (int j = 0; j < fx.GetDim()[1]; ++j)
+			for (int k = first; k < last; ++k)
 			{
-				for (int ch = 0; ch < fx.GetDim()[2]; ++ch)
+				const int b = k / channels;
+				const int ch = k % channels;
+				for (int i = 0; i < fx.GetDim()[0]; ++i)
 				{
-					int max_r = 0, max_c = 0;
-					float max_val;
-					bool is_feasible = false;
-					for (int r = 0; r < m_ksize[0]; ++r)
+					for (int j = 0; j < fx.GetDim()[1]; ++j)
 					{
-						for (int c = 0; c < m_ksize[1]; ++c)
+						int max_r = 0, max_c = 0;
+						float max_val;
+						bool is_feasible = false;
+						for (int r = 0; r < m_ksize[0]; ++r)
 						{
-							int row = m_stride[0] * i + r - pad_top;
-							int col = m_stride[1] * j + c - pad_left;
-							if (((col < xs[0]->GetDim()[1]) && (row < xs[0]->GetDim()[0])))
+							for (int c = 0; c < m_ksize[1]; ++c)
 							{
-								if (!is_feasible)
+								int row = m_stride[0] * i + r - pad_top;
+								int col = m_stride[1] * j + c - pad_left;
+								if (((col < xs[0]->GetDim()[1]) && (row < xs[0]->GetDim()[0])))
 								{
-									max_val = xs[0]->tb<3>()(row, col, ch, 0);
-									max_r = row; max_c = col; is_feasible = true;
-								}
-								else if (xs[0]->tb<3>()(row, col, ch, 0) > max_val)
-								{
-									max_val = xs[0]->tb<3>()(row, col, ch, 0);
-									max_r = row; max_c = col;
+									if (!is_feasible)
+									{
+										max_val = xs[0]->tb<3>()(row, col, ch, b);
+										max_r = row; max_c = col; is_feasible = true;
+									}
+									else if (xs[0]->tb<3>()(row, col, ch, b) > max_val)
+									{
+										max_val = xs[0]->tb<3>()(row, col, ch, b);
+										max_r = row; max_c = col;
+									}
 								}
 							}
 						}
+						(dEdxi.tb<3>())(max_r, max_c, ch, b) += (dEdf.tb<3>())(i, j, ch, b);
 					}
-					(dEdxi.tb<3>())(max_r, max_c, ch, 0) += (dEdf.tb<3>())(i, j, ch, 0);
 				}
 			}
-		}
+		});
 	}
 
 private:
@@ -2303,32 +2612,36 @@ class CarpRobotPickNegLogSoftmaxNode : public CarpRobotNode
 public:
 	CarpRobotPickNegLogSoftmaxNode(const std::vector<int>& a, int label) : CarpRobotNode(a), m_label(label), m_plabel(&m_label) {}
 	CarpRobotPickNegLogSoftmaxNode(const std::vector<int>& a, const int* plabel) : CarpRobotNode(a), m_label(0), m_plabel(plabel) {}
+	// ʱÿһǩ
+	CarpRobotPickNegLogSoftmaxNode(const std::vector<int>& a, const std::vector<int>* plabels) : CarpRobotNode(a), m_label(0), m_plabel(&m_label), m_plabels(plabels) {}
 	~CarpRobotPickNegLogSoftmaxNode() {}
 
 protected:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotPickNegLogSoftmaxNode һ");
-		CARP_ROBOT_ASSERT(xs[0]->GetTotalSize() == xs[0]->Rows(), u8"άϢ");
+		CARP_ROBOT_ASSERT(xs[0]->GetBatchSize() == xs[0]->Rows(), u8"άϢ");
 
-		m_dim_out = CarpRobotDim({ 1 });
+		m_dim_out = CarpRobotDim({ 1 }, xs[0]->GetBatch());
+		// ÿαlogsumexpĽֵ򴫲ʱҪ
+		m_aux_size = 2 * xs[0]->GetBatch();
 	}
 
+	// ȡbεıǩûöǩʱιһ
+	int GetLabel(int b) const { return m_plabels ? (*m_plabels)[b] : *m_plabel; }
+
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		m_z.SetDim(CarpRobotDim({ 1 }), true);
-		m_m.SetDim(CarpRobotDim({ 1 }), true);
+		const int bd = xs[0]->GetDim().GetBatch();
+		CARP_ROBOT_ASSERT(m_plabels == nullptr || (int)m_plabels->size() >= bd, u8"ǩС:" << bd);
 
-		if (xs[0]->GetDim().Cols() == 1)
-		{
-			xs[0]->Logsumexp(m_m, m_z);
-			fx.GetValue()[0] = xs[0]->GetValue()[*m_plabel];
-			fx.tvec() = m_z.tvec() - fx.tvec();
-		}
-		else
-		{
-			CARP_ROBOT_ASSERT(0, "PickNegLogSoftmax::forward not yet implemented for multiple columns");
-		}
+		CarpRobotTensor z(CarpRobotDim({ 1 }, bd), m_aux);
+		CarpRobotTensor m(CarpRobotDim({ 1 }, bd), m_aux + bd);
+		xs[0]->Logsumexp(m, z);
+
+		const int size = xs[0]->GetDim().Rows();
+		for (int b = 0; b < bd; ++b)
+			fx.GetValue()[b] = z.GetValue()[b] - xs[0]->GetValue()[b * size + GetLabel(b)];
 	}
 
 	void Backward(const std::vector<const CarpRobotTensor*>& xs,
@@ -2337,23 +2650,18 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		if (xs[0]->GetDim().Cols() == 1)
+		const int bd = xs[0]->GetDim().GetBatch();
+		const int size = xs[0]->GetDim().Rows();
+		for (int b = 0; b < bd; ++b)
 		{
-			dEdxi.tb<1>().chip<1>(0) += (xs[0]->tb<1>().chip<1>(0) - m_z.GetValue()[0]).exp() * dEdf.GetValue()[0];
-			dEdxi.GetValue()[*m_plabel] -= dEdf.GetValue()[0];
-		}
-		else
-		{
-			CARP_ROBOT_ASSERT(0, "PickNegLogSoftmax::backward not yet implemented for multiple columns");
+			dEdxi.tb<1>().chip<1>(b) += (xs[0]->tb<1>().chip<1>(b) - m_aux[b]).exp() * dEdf.GetValue()[b];
+			dEdxi.GetValue()[b * size + GetLabel(b)] -= dEdf.GetValue()[b];
 		}
 	}
 public:
 	int m_label = 0;
 	const int* m_plabel = nullptr;
-	
-private:
-	CarpRobotTensor m_z;
-	CarpRobotTensor m_m;
+	const std::vector<int>* m_plabels = nullptr;
 };
 
 // x_1 is a vector
@@ -2406,11 +2714,14 @@ protected:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotReshapeNode һ");
-		CARP_ROBOT_ASSERT(xs[0]->GetTotalSize() == m_dim.GetTotalSize(), u8"CarpRobotReshapeNode ܴСһ");
 
 		// just point to the input memory and change dimensions
 		// dimensions are handled by forward_dim
 		m_dim_out = m_dim;
+		// ĿάûָʱΣֻıÿε״
+		if (xs[0]->GetTotalSize() != m_dim.GetTotalSize() && m_dim.GetBatch() == 1)
+			m_dim_out.SetBatch(xs[0]->GetBatch());
+		CARP_ROBOT_ASSERT(xs[0]->GetTotalSize() == m_dim_out.GetTotalSize(), u8"CarpRobotReshapeNode ܴСһ");
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
@@ -2451,7 +2762,7 @@ protected:
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
-		float n = (float)fx.GetDim().GetTotalSize();
+		float n = (float)fx.GetDim().GetBatchSize();
 		Eigen::array<ptrdiff_t, 1> reduction_axis = { m_dim };
 		fx.tb<2>() = xs[0]->tb<3>().sum(reduction_axis) / n;
 	}
@@ -2464,9 +2775,9 @@ protected:
 	{
 		CarpRobotDim dim = xs[0]->GetDim();
 
-		float n = (float)dim.GetTotalSize();
+		float n = (float)dim.GetBatchSize();
 		Eigen::array<ptrdiff_t, 4> bcast = { 1,1,1,1 }; bcast[m_dim] = dim[m_dim];
-		Eigen::array<ptrdiff_t, 4> morph = { dim[0], dim[1], dim[2], 1 }; morph[m_dim] = 1;
+		Eigen::array<ptrdiff_t, 4> morph = { dim[0], dim[1], dim[2], dim.GetBatch() }; morph[m_dim] = 1;
 		dEdxi.tb<3>() += dEdf.tb<2>().reshape(morph).broadcast(bcast) / n;
 	}
 
@@ -2494,15 +2805,16 @@ protected:
 	{
 		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotStdElementsNode һ");
 
-		m_dim_out = CarpRobotDim({ 1 });
+		// ÿε
+		m_dim_out = CarpRobotDim({ 1 }, xs[0]->GetBatch());
 	}
 
 	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
 	{
 		Eigen::array<ptrdiff_t, 1> red_axis = { 0 };
-		Eigen::array<ptrdiff_t, 2> bcast = { (ptrdiff_t)xs[0]->GetDim().GetTotalSize(), 1 };
-		Eigen::array<ptrdiff_t, 2> newaxis = { 1, 1 };
-		cr_real n = (cr_real)xs[0]->GetDim().GetTotalSize();
+		Eigen::array<ptrdiff_t, 2> bcast = { (ptrdiff_t)xs[0]->GetDim().GetBatchSize(), 1 };
+		Eigen::array<ptrdiff_t, 2> newaxis = { 1, (ptrdiff_t)xs[0]->GetDim().GetBatch() };
+		cr_real n = (cr_real)xs[0]->GetDim().GetBatchSize();
 		fx.tb<0>() = ((xs[0]->tbvec() - (xs[0]->tbvec().sum(red_axis).reshape(newaxis) / n).broadcast(bcast)).square().sum(red_axis) / n).sqrt();
 	}
 
@@ -2512,10 +2824,10 @@ protected:
 		int xs_i,
 		CarpRobotTensor& dEdxi) override
 	{
-		Eigen::array<ptrdiff_t, 2> bcast = { (ptrdiff_t)xs[0]->GetDim().GetTotalSize(), 1 };
-		Eigen::array<ptrdiff_t, 2> newaxis = { 1, 1 };
+		Eigen::array<ptrdiff_t, 2> bcast = { (ptrdiff_t)xs[0]->GetDim().GetBatchSize(), 1 };
+		Eigen::array<ptrdiff_t, 2> newaxis = { 1, (ptrdiff_t)xs[0]->GetDim().GetBatch() };
 		Eigen::array<ptrdiff_t, 1> red_axis = { 0 };
-		cr_real n = (cr_real)xs[0]->GetDim().GetTotalSize();
+		cr_real n = (cr_real)xs[0]->GetDim().GetBatchSize();
 		dEdxi.tbvec() += (2 / n) * (xs[0]->tbvec() - (xs[0]->tbvec().sum(red_axis).reshape(newaxis) / n).broadcast(bcast)) * (fx.tbvec().binaryExpr(dEdf.tbvec(), FSqrtBackward())).broadcast(bcast);
 
 	}
@@ -2528,6 +2840,12 @@ public:
 	CarpRobotPickRangeNode(const std::vector<int>& a, int start, int end, int dim=0) : CarpRobotNode(a), m_start(start), m_end(end), m_dim(dim) {}
 	~CarpRobotPickRangeNode() {}
 
+public:
+	// ʰȡķΧ[start, end)Լĸάʰȡ
+	int GetStart() const { return m_start; }
+	int GetEnd() const { return m_end; }
+	int GetAxis() const { return m_dim; }
+
 protected:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
@@ -2546,7 +2864,7 @@ protected:
 			static_cast<ptrdiff_t>(fx.GetDim()[1]),
 			static_cast<ptrdiff_t>(fx.GetDim()[2]),
 			static_cast<ptrdiff_t>(fx.GetDim()[3]),
-			static_cast<ptrdiff_t>(1));
+			static_cast<ptrdiff_t>(fx.GetDim().GetBatch()));
 		sizes[m_dim] = m_end - m_start;
 		fx.tb<4>() = xs[0]->tb<4>().slice(indices, sizes);
 	}
@@ -2563,7 +2881,7 @@ protected:
 			static_cast<ptrdiff_t>(fx.GetDim()[1]),
 			static_cast<ptrdiff_t>(fx.GetDim()[2]),
 			static_cast<ptrdiff_t>(fx.GetDim()[3]),
-			static_cast<ptrdiff_t>(1));
+			static_cast<ptrdiff_t>(fx.GetDim().GetBatch()));
 		sizes[m_dim] = m_end - m_start;
 		dEdxi.tb<4>().slice(indices, sizes) += dEdf.tb<4>();
 	}
@@ -2598,6 +2916,15 @@ protected:
 				"Bad dimensions for AffineTransform: ");
 		}
 
+		// ȡǸҪôҪô1
+		int bd = 1;
+		for (size_t i = 0; i < xs.size(); ++i) bd = std::max(bd, xs[i]->GetBatch());
+		for (size_t i = 0; i < xs.size(); ++i)
+			CARP_ROBOT_ASSERT(xs[i]->GetBatch() == 1 || xs[i]->GetBatch() == bd, u8"CarpRobotAffineTransformNode Ȼ1");
+		// ƫжεʱ򣬲ɢ
+		CARP_ROBOT_ASSERT(xs[0]->GetBatch() == 1 || xs[0]->Cols() == d.Cols(), u8"CarpRobotAffineTransformNode εƫãһ");
+		d.SetBatch(bd);
+
 		m_dim_out = d;
 	}
 
@@ -2617,6 +2944,7 @@ protected:
 		}
 		else
 		{
+			// ƫɢек
 			cr_real* curr_ptr = fx.GetValue(), * end_ptr = curr_ptr + fx.GetDim().GetTotalSize(), * in_ptr = xs[0]->GetValue();
 			do
 			{
@@ -2628,7 +2956,16 @@ protected:
 		// Multiply
 		for (size_t i = 1; i < xs.size(); i += 2)
 		{
-			fx.m().noalias() += xs[i]->m() * xs[i + 1]->m();
+			// ֻһΣ븲ʱΰƴһξ˷
+			if (xs[i]->GetDim().GetBatch() == 1 && xs[i + 1]->GetDim().GetBatch() == fx.GetDim().GetBatch())
+			{
+				Gemm(fx.mb(), xs[i]->m(), xs[i + 1]->mb(), true);
+			}
+			else
+			{
+				for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+					Gemm(fx.m(b), xs[i]->m(b), xs[i + 1]->m(b), true);
+			}
 		}
 	}
 
@@ -2650,28 +2987,43 @@ protected:
 			}
 			else
 			{
-				if (dEdxi.GetDim()[1] == dEdf.GetDim()[1])
+				// ƫǰʱɢ˶л߶Σÿһݵݶȶۼӻ
+				CarpRobotTensor mychip;
+				mychip.RefrenceMemory(dEdxi.GetDim(), dEdf.GetValue());
+				int len = df_size / dx_size;
+				for (int b = 0; b < len; ++b)
 				{
-					dEdxi.m().noalias() += dEdf.m();
-				}
-				else
-				{
-					CarpRobotTensor mychip;
-					mychip.RefrenceMemory(dEdxi.GetDim(), dEdf.GetValue());
-					int len = dEdf.GetDim()[1];
-					for (int b = 0; b < len; ++b)
-					{
-						dEdxi.m().noalias() += mychip.m();
-						mychip.RefrenceMemory(dEdxi.GetDim(), mychip.GetValue() + dx_size);
-					}
+					dEdxi.vec().noalias() += mychip.vec();
+					mychip.RefrenceMemory(dEdxi.GetDim(), mychip.GetValue() + dx_size);
 				}
 			}
 		}
 		// Left argument of matrix multiply
 		else if (xs_i % 2 == 1)
-			dEdxi.m().noalias() += dEdf.m() * xs[xs_i + 1]->m().transpose();
+		{
+			// ֻһΣεݶھ˷ֱۼ
+			if (xs[xs_i]->GetDim().GetBatch() == 1 && xs[xs_i + 1]->GetDim().GetBatch() == fx.GetDim().GetBatch())
+			{
+				Gemm(dEdxi.m(), dEdf.mb(), xs[xs_i + 1]->mb().transpose(), true);
+			}
+			else
+			{
+				for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+					Gemm(dEdxi.m(b), dEdf.m(b), xs[xs_i + 1]->m(b).transpose(), true);
+			}
+		}
 		else
-			dEdxi.m().noalias() += xs[xs_i - 1]->m().transpose() * dEdf.m();
+		{
+			if (xs[xs_i - 1]->GetDim().GetBatch() == 1 && xs[xs_i]->GetDim().GetBatch() == fx.GetDim().GetBatch())
+			{
+				Gemm(dEdxi.mb(), xs[xs_i - 1]->m().transpose(), dEdf.mb(), true);
+			}
+			else
+			{
+				for (int b = 0; b < fx.GetDim().GetBatch(); ++b)
+					Gemm(dEdxi.m(b), xs[xs_i - 1]->m(b).transpose(), dEdf.m(b), true);
+			}
+		}
 	}
 };
 
@@ -2682,6 +3034,9 @@ public:
 	CarpRobotRandomBernoulliNode(const std::vector<int>& a, const CarpRobotDim& dim, cr_real p, cr_real scale=1.0f) : CarpRobotNode(a), m_dim(dim), m_p(p), m_scale(scale) {}
 	~CarpRobotRandomBernoulliNode() {}
 
+	// ȡֵʱ
+	cr_real GetExpectation() const { return m_p * m_scale; }
+
 public:
 	void Dim(const std::vector<const CarpRobotDim*>& xs) override
 	{
@@ -2723,6 +3078,7 @@ public:
 		CarpRobotDim dr = *xs[0];
 		for (size_t i = 0; i < xs.size(); ++i)
 		{
+			CARP_ROBOT_ASSERT(xs[i]->GetBatch() == xs[0]->GetBatch(), u8"CarpRobotConcatenateNode һ");
 			CarpRobotDim c = *xs[i];
 			if (dr.Count() < c.Count()) dr.Resize(c.Count());
 			if (c.Count() < dr.Count()) c.Resize(dr.Count());
@@ -2745,7 +3101,7 @@ public:
 			, static_cast<ptrdiff_t>(fx.GetDim()[1])
 			, static_cast<ptrdiff_t>(fx.GetDim()[2])
 			, static_cast<ptrdiff_t>(fx.GetDim()[3])
-			, static_cast<ptrdiff_t>(1));
+			, static_cast<ptrdiff_t>(fx.GetDim().GetBatch()));
 		for (size_t i = 0; i < xs.size(); ++i)
 		{
 			indices[m_dim] = m_src_indices[i] = curr_row;
@@ -2767,7 +3123,7 @@ public:
 			static_cast<ptrdiff_t>(dEdxi.GetDim()[1]),
 			static_cast<ptrdiff_t>(dEdxi.GetDim()[2]),
 			static_cast<ptrdiff_t>(dEdxi.GetDim()[3]),
-			static_cast<ptrdiff_t>(1));
+			static_cast<ptrdiff_t>(dEdxi.GetDim().GetBatch()));
 
 		dEdxi.tb<4>() += dEdf.tb<4>().slice(indices, sizes);
 	}
@@ -2777,6 +3133,133 @@ private:
 	int m_dim = 0;
 };
 
+// μһڰÿʧϳһ
+// y = \sum_b (x_1)_b
+class CarpRobotSumBatchesNode : public CarpRobotNode
+{
+public:
+	CarpRobotSumBatchesNode(const std::vector<int>& a) : CarpRobotNode(a) {}
+	~CarpRobotSumBatchesNode() {}
+
+protected:
+	void Dim(const std::vector<const CarpRobotDim*>& xs) override
+	{
+		CARP_ROBOT_ASSERT(xs.size() == 1, u8"CarpRobotSumBatchesNode һ");
+		m_dim_out = *xs[0];
+		m_dim_out.SetBatch(1);
+	}
+
+	void Forward(const std::vector<const CarpRobotTensor*>& xs, CarpRobotTensor& fx) override
+	{
+		// xs[0]->tbvec() άΪ (εĴС, bd)
+		Eigen::array<ptrdiff_t, 1> red_axis = { 1 };
+		fx.tvec() = xs[0]->tbvec().sum(red_axis);
+	}
+
+	void Backward(const std::vector<const CarpRobotTensor*>& xs,
+		const CarpRobotTensor& fx,
+		const CarpRobotTensor& dEdf,
+		int xs_i,
+		CarpRobotTensor& dEdxi) override
+	{
+		// ÿεݶȶһ
+		Eigen::array<ptrdiff_t, 2> bcast = { 1, (ptrdiff_t)xs[0]->GetDim().GetBatch() };
+		dEdxi.tbvec() += dEdf.tbvec().broadcast(bcast);
+	}
+};
+
+#ifdef CARP_ROBOT_THREADS
+// ͼʹõ̳߳
+// ڵ֮Ĳ: Run߳(߳)һִͬһԼӾȡڵ
+// ڵڲĲ: ˷ЩڵͨGetDeviceһEigen߳зּ
+// ̷ֿ߳ڵ̵߳ȴEigen̵߳ʱ򣬲߳ȫµ
+class CarpRobotThreadPool
+{
+public:
+	// deviceΪfalseʱEigeṇִֻ߳Run
+	explicit CarpRobotThreadPool(int count, bool device = true)
+	{
+		if (device)
+		{
+			m_eigen_pool.reset(new Eigen::ThreadPool(count));
+			m_device.reset(new Eigen::ThreadPoolDevice(m_eigen_pool.get(), count));
+		}
+
+		for (int i = 1; i < count; ++i)
+			m_threads.emplace_back(&CarpRobotThreadPool::Loop, this, i);
+	}
+	~CarpRobotThreadPool()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_stop = true;
+			m_cv.notify_all();
+		}
+		for (auto& thread : m_threads) thread.join();
+	}
+
+public:
+	// ߳Run߳
+	int GetThreadCount() const { return static_cast<int>(m_threads.size()) + 1; }
+	// ڵڲм豸
+	const CarpRobotDevice* GetDevice() const { return m_device.get(); }
+
+	// ߳һִjob(worker)worker0ʼ0ǵ̣߳ȫִ֮󷵻
+	void Run(const std::function<void(int)>& job)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_job = &job;
+			m_running = static_cast<int>(m_threads.size());
+			++m_generation;
+			m_cv.notify_all();
+		}
+
+		job(0);
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_done_cv.wait(lock, [this] { return m_running == 0; });
+		m_job = nullptr;
+	}
+
+private:
+	void Loop(int worker)
+	{
+		size_t generation = 0;
+		while (true)
+		{
+			const std::function<void(int)>* job = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_cv.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+				if (m_stop) return;
+				generation = m_generation;
+				job = m_job;
+			}
+
+			(*job)(worker);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if (--m_running == 0) m_done_cv.notify_one();
+		}
+	}
+
+private:
+	std::unique_ptr<Eigen::ThreadPool> m_eigen_pool;		// ڵڲе߳
+	std::unique_ptr<Eigen::ThreadPoolDevice> m_device;	// װm_eigen_pool豸
+	std::vector<std::thread> m_threads;	// ڵ֮䲢е̣߳߳
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_cv;			// ֪ͨ߳̿ʼִ
+	std::condition_variable m_done_cv;		// ִ֪ͨ߳
+	const std::function<void(int)>* m_job = nullptr;
+	size_t m_generation = 0;				// ÿRunһ߳ԴжǷ
+	int m_running = 0;						// ûִϵ߳
+	bool m_stop = false;
+};
+#endif
+
 class ICarpRobotComputationGraph
 {
 public:
@@ -2819,6 +3302,7 @@ public:
 	CarpRobotExpression Square() const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotSquareNode(args))); }
 	CarpRobotExpression PickNegLogSoftmax(const int* plabel) const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotPickNegLogSoftmaxNode(args, plabel))); }
 	CarpRobotExpression PickNegLogSoftmax(int label) const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotPickNegLogSoftmaxNode(args, label))); }
+	CarpRobotExpression PickNegLogSoftmax(const std::vector<int>* plabels) const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotPickNegLogSoftmaxNode(args, plabels))); }
 	CarpRobotExpression BinaryLogLoss() const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotBinaryLogLossNode(args))); }
 
 	// 
@@ -2839,6 +3323,7 @@ public:
 	CarpRobotExpression MeanElements(int dim) const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotMeanElementsNode(args, dim))); }
 	CarpRobotExpression StdElements() const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotStdElementsNode(args))); }
 	CarpRobotExpression PickRange(int start, int end, int dim=0) const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotPickRangeNode(args, start, end, dim))); }
+	CarpRobotExpression SumBatches() const { std::vector<int> args; args.push_back(m_index); return CarpRobotExpression(m_graph, m_graph->AddNode(new CarpRobotSumBatchesNode(args))); }
 	CarpRobotExpression LayerNorm(const CarpRobotExpression& g, const CarpRobotExpression& b) const
 	{
 		// Expression mu = mean_elems(x);
@@ -2874,10 +3359,18 @@ class CarpRobotLabel
 public:
 	void Update(int label) { m_label = label; }
 
+	// ֮ÿһǩ
+	void SetBatch(int count) { m_labels.resize(count > 0 ? count : 0, 0); }
+	// õindexεıǩ
+	void UpdateBatch(int index, int label) { if (index >= 0 && index < (int)m_labels.size()) m_labels[index] = label; }
+
 	const int* GetLabel() const { return &m_label; }
+	const std::vector<int>* GetLabels() const { return &m_labels; }
+	int GetBatch() const { return (int)m_labels.size(); }
 
 private:
 	int m_label = 0;
+	std::vector<int> m_labels;
 };
 
 // 1. ͼнڵ˽ṹ
@@ -2887,7 +3380,13 @@ class CarpRobotComputationGraph : public ICarpRobotComputationGraph
 public:
 	// 캯ʼ
 	CarpRobotComputationGraph() { }
-	~CarpRobotComputationGraph() { Clear(); }
+	~CarpRobotComputationGraph()
+	{
+		Clear();
+#ifdef CARP_ROBOT_THREADS
+		delete m_thread_pool;
+#endif
+	}
 
 private:
 	CarpRobotComputationGraph(const CarpRobotComputationGraph&) {}
@@ -2926,7 +3425,7 @@ public:
 
 	// ʧ
 	int Square(int index) { return CarpRobotExpression(this, index).Square().GetIndex(); }
-	int PickNegLogSoftmax(int index, CarpRobotLabel* v) { return CarpRobotExpression(this, index).PickNegLogSoftmax(v->GetLabel()).GetIndex(); }
+	int PickNegLogSoftmax(int index, CarpRobotLabel* v) { return v->GetBatch() > 0 ? CarpRobotExpression(this, index).PickNegLogSoftmax(v->GetLabels()).GetIndex() : CarpRobotExpression(this, index).PickNegLogSoftmax(v->GetLabel()).GetIndex(); }
 	int BinaryLogLoss(int index) { return CarpRobotExpression(this, index).BinaryLogLoss().GetIndex(); }
 
 	// 
@@ -2955,6 +3454,7 @@ public:
 	}
 	int PickElement(int index, CarpRobotLabel* v, int dim = 0) { return CarpRobotExpression(this, index).PickElement(v->GetLabel(), dim).GetIndex(); }
 	int MeanElements(int index, int dim) { return CarpRobotExpression(this, index).MeanElements(dim).GetIndex(); }
+	int SumBatches(int index) { return CarpRobotExpression(this, index).SumBatches().GetIndex(); }
 	int Concatenate(int index, int expr_0, int expr_1, int expr_2)
 	{
 		std::vector<CarpRobotExpression> expr_list;
@@ -2985,7 +3485,14 @@ public:
 		for (size_t i = 0; i < node->GetArgs().size(); ++i)
 			xs[i] = &(m_nodes[node->GetArgs()[i]]->GetDim());
 		node->Dim(xs);
-		m_fx_list.back().SetDim(node->GetDim());
+
+		// ǰڴŲ͸ڴ棬ֻ¼ƫƣڴǰ֮ǰ
+		m_fx_list.back().RefrenceMemory(node->GetDim(), nullptr);
+		m_fx_offset_list.push_back(m_fx_size);
+		if (!node->IsRefrenceMemory()) m_fx_size += CarpRobotArena::Align(node->GetDim().GetTotalSize());
+		m_fx_size += CarpRobotArena::Align(node->GetAuxSize());
+		// ʱڴнڵ㹲һ飬ȡֵ
+		if (node->GetScratchSize() > m_scratch_size) m_scratch_size = node->GetScratchSize();
 
 		// Ҫ㣬ôǰ
 		if (m_immediate_compute) Forward((int)m_nodes.size());
@@ -3011,9 +3518,10 @@ public:
 		CARP_ROBOT_ASSERT(i < (int)m_fx_list.size(), u8"Խ");
 		return m_fx_list[i];
 	}
+	// ݶڴǸõģ򴫲ֻ֮вڵһڵݶ
 	const CarpRobotTensor& GetGradient(int i) const  override
 	{
-		CARP_ROBOT_ASSERT(i < (int)m_dEdf_list.size(), u8"Խ");
+		CARP_ROBOT_ASSERT(i < (int)m_dEdf_list.size(), u8"Խ磬߼½ڵ֮ݶѾʧЧҪ·򴫲");
 		return m_dEdf_list[i];
 	}
 
@@ -3037,6 +3545,20 @@ public:
 		return GetValue(i).AsVectorAndGetValue(index);
 	}
 
+	int AsBatchVectorAndArgmax(int i, int b)
+	{
+		return GetValue(i).AsBatchVectorAndArgmax(b);
+	}
+
+	// ȡڵ
+	int GetNodeCount() const { return (int)m_nodes.size(); }
+	// ȡڵ
+	CarpRobotNode* GetNode(int i) const
+	{
+		CARP_ROBOT_ASSERT(i >= 0 && i < (int)m_nodes.size(), u8"Խ");
+		return m_nodes[i];
+	}
+
 	const CarpRobotDim* GetDim(int i) const
 	{
 		CARP_ROBOT_ASSERT(i < (int)m_fx_list.size(), u8"Խ");
@@ -3054,6 +3576,13 @@ public:
 		m_fx_list.resize(0);
 		m_dEdf_list.resize(0);
 		m_evaluated_index = 0;
+
+		// ڴصڴ汣һιͼֱӸ
+		m_fx_offset_list.resize(0);
+		m_fx_size = 0;
+		m_fx_bind_count = 0;
+		m_scratch_size = 0;
+		m_backward_plan_count = 0;
 	}
 
 	// ˽ṹ䣬ͷʼ
@@ -3062,31 +3591,61 @@ public:
 	// ǷֱӼڵ
 	void SetImmediateCompute(bool immediate) { m_immediate_compute = immediate; }
 
+	// ֮ݶۼӵbuffer[±]ǲԼݲѵʱÿͼһԼݶ
+	void SetGradientBuffer(std::vector<CarpRobotTensor>* buffer) { m_gradient_buffer = buffer; }
+
+	// ü߳1ʱûϵĽڵ㲢м㣬˷ػڵڲҲᲢ
+	void SetThreadCount(int count)
+	{
+#ifdef CARP_ROBOT_THREADS
+		if (count < 1) count = 1;
+		if (count == GetThreadCount()) return;
+		delete m_thread_pool;
+		m_thread_pool = count > 1 ? new CarpRobotThreadPool(count) : nullptr;
+#endif
+	}
+	int GetThreadCount() const
+	{
+#ifdef CARP_ROBOT_THREADS
+		if (m_thread_pool) return m_thread_pool->GetThreadCount();
+#endif
+		return 1;
+	}
+
+public:
+	// ȡǰڴʹõĴС(ֽ)ڵ͸ڴ
+	int GetForwardMemory() const { return (int)(m_fx_size * sizeof(cr_real)); }
+	// ȡڴع滮ķֵ(ֽ)ʱڴݶ
+	int GetBackwardMemory() const { return (int)((GetScratchTotal() + m_dEdf_arena.GetPlanSize()) * sizeof(cr_real)); }
+	// ȡڴϵͳڴܴ
+	int GetArenaAllocCount() const { return m_fx_arena.GetAllocCount() + m_dEdf_arena.GetAllocCount(); }
+
 public:
 	// ǰ
 	const CarpRobotTensor& Forward(int index)
 	{
 		CARP_ROBOT_ASSERT(m_nodes.size() > 0, u8"ǰûнڵ㣬޷ǰ");
 
-		// 棬Ƶ
-		std::vector<const CarpRobotTensor*> xs;
+		// ¼Ľڵڴ
+		BindForwardMemory();
+
+#ifdef CARP_ROBOT_THREADS
+		// ߳ʱһҪڵͰϵм
+		const int end = std::min(index + 1, (int)m_nodes.size());
+		if (m_thread_pool && end - m_evaluated_index > 1)
+		{
+			ForwardParallel(end);
+			return m_fx_list[m_evaluated_index - 1];
+		}
+#endif
 
 		// ӵǰڵǰ㣬ֱ
 		while (m_evaluated_index < (int)m_nodes.size())
 		{
 			if (m_evaluated_index > index) break;
 
-			// ȡǰڵ
-			auto* node = m_nodes[m_evaluated_index];
-
-			// 飬һȡ
-			const auto& args = node->GetArgs();
-			xs.resize(args.size());
-			for (size_t i = 0; i < args.size(); ++i)
-				xs[i] = &m_fx_list[args[i]];
-
 			// ִнڵǰ
-			node->Forward(xs, m_fx_list[m_evaluated_index]);
+			ForwardNode(m_evaluated_index, m_xs, 0);
 
 			// ǰһ
 			++m_evaluated_index;
@@ -3104,24 +3663,319 @@ public:
 		// ȡǰڵ
 		int num_nodes = (int)m_nodes.size();
 
-		// С
-		m_dEdf_list.resize(num_nodes);
+		// ˽ṹûб仯ֱʹһεĹ滮
+		bool parallel = GetThreadCount() > 1;
+		if (m_backward_plan_count != num_nodes || m_backward_plan_parallel != parallel) PlanBackward(parallel);
+		BindBackwardMemory();
+
+#ifdef CARP_ROBOT_THREADS
+		if (parallel)
+		{
+			// ʱȷĸڵдݶȣһʼȫ
+			memset(m_dEdf_arena.GetMemory() + GetScratchTotal(), 0, m_dEdf_arena.GetPlanSize() * sizeof(cr_real));
+			m_dEdf_list[num_nodes - 1].Constant(1);
+			BackwardParallel();
+		}
+		else
+#endif
+		{
+			// һڵݶΪ1
+			m_dEdf_list[num_nodes - 1].Constant(1);
+
+			for (int i = num_nodes - 1; i >= 0; --i)
+			{
+				// ڵ㲻㣬ֱ
+				if (!m_in_computation[i]) continue;
+				BackwardNode(i, m_xs, 0, false);
+			}
+		}
+
+		// ĽõڵȥûвĲڵûݶ
+		for (auto& pair : m_parameter_map)
+		{
+			if (m_dEdf_list[pair.first].GetValue() == nullptr) continue;
+
+			auto* parameter = pair.second->GetParameter();
+			if (m_gradient_buffer && parameter)
+			{
+				CARP_ROBOT_ASSERT(parameter->GetIndex() >= 0 && parameter->GetIndex() < (int)m_gradient_buffer->size(), u8"ݶȻû: " << parameter->GetIndex());
+				(*m_gradient_buffer)[parameter->GetIndex()].tvec() += m_dEdf_list[pair.first].tvec();
+			}
+			else
+				pair.second->AccumulateGrad(m_dEdf_list[pair.first]);
+		}
+	}
+
+private:
+	// ִнڵǰ㣬workerִе̱߳ţʱڴ
+	void ForwardNode(int i, std::vector<const CarpRobotTensor*>& xs, int worker)
+	{
+		auto* node = m_nodes[i];
+
+		// 飬һȡ
+		const auto& args = node->GetArgs();
+		xs.resize(args.size());
+		for (size_t j = 0; j < args.size(); ++j)
+			xs[j] = &m_fx_list[args[j]];
+
+		node->SetMemory(GetAuxMemory(i), GetScratchMemory(worker));
+		node->SetDevice(GetDevice());
+		node->Forward(xs, m_fx_list[i]);
+	}
+
+	// ִнڵķ򴫲ݶۼӵҪ󵼵ڵ
+	void BackwardNode(int i, std::vector<const CarpRobotTensor*>& xs, int worker, bool parallel)
+	{
+		auto* node = m_nodes[i];
+
+		// ȡýڵ
+		const auto& args = node->GetArgs();
+		xs.resize(args.size());
+		for (size_t j = 0; j < args.size(); ++j)
+		{
+			const int arg = args[j];
+
+			// ڵ
+			xs[j] = &m_fx_list[arg];
+
+			// һдݶȣ㣬еʱѾǰ
+			if (!parallel && m_dEdf_first_list[arg] == i)
+				m_dEdf_list[arg].Zero();
+		}
+
+		// ڵ㣬Ҫ󵼵붼Ҫз򴫲
+		node->SetMemory(GetAuxMemory(i), GetScratchMemory(worker));
+		node->SetDevice(GetDevice());
+		for (size_t j = 0; j < args.size(); ++j)
+		{
+			const int arg = args[j];
+			if (!m_needs_derivative[arg]) continue;
+
+#ifdef CARP_ROBOT_THREADS
+			// ڵͬʱͬһݶۼ
+			if (parallel)
+			{
+				std::lock_guard<std::mutex> lock(m_dEdf_locks[arg]);
+				node->Backward(xs, m_fx_list[i], m_dEdf_list[i], (unsigned int)j, m_dEdf_list[arg]);
+				continue;
+			}
+#endif
+			node->Backward(xs, m_fx_list[i], m_dEdf_list[i], (unsigned int)j, m_dEdf_list[arg]);
+		}
+	}
+
+	// ÿ߳һݶʱڴ棬ηڷڴصǰ
+	size_t GetScratchTotal() const { return CarpRobotArena::Align(m_scratch_size) * GetThreadCount(); }
+	cr_real* GetScratchMemory(int worker) const { return m_dEdf_arena.GetMemory() + CarpRobotArena::Align(m_scratch_size) * worker; }
+
+	const CarpRobotDevice* GetDevice() const
+	{
+#ifdef CARP_ROBOT_THREADS
+		if (m_thread_pool) return m_thread_pool->GetDevice();
+#endif
+		return nullptr;
+	}
+
+#ifdef CARP_ROBOT_THREADS
+	// м[m_evaluated_index, end)Ľڵ㣬ڵ֮ͿԿʼ
+	void ForwardParallel(int end)
+	{
+		const int begin = m_evaluated_index;
+		m_schedule_edges.clear();
+		for (int i = begin; i < end; ++i)
+		{
+			const auto& args = m_nodes[i]->GetArgs();
+			for (size_t j = 0; j < args.size(); ++j)
+			{
+				if (args[j] >= begin) m_schedule_edges.emplace_back(args[j], i);
+			}
+		}
+		BuildSchedule(begin, end - begin);
+
+		for (int i = end - 1; i >= begin; --i)
+		{
+			if (m_pending[i - begin] == 0) m_ready.push_back(i);
+		}
 
-		// ʼάϢڴ棬Ȼ
-		for (size_t i = 0; i < m_dEdf_list.size(); ++i)
-			m_dEdf_list[i].SetDim(m_fx_list[i].GetDim(), true);
-		m_dEdf_list[num_nodes - 1].Constant(1);
+		// ʱѾĽڵ㲻һ´δͷʼ
+		m_evaluated_index = begin;
+		RunSchedule(begin, end - begin, [this](int i, int worker) { ForwardNode(i, m_worker_xs[worker], worker); });
+		m_evaluated_index = end;
+	}
+
+	// з򴫲ڵڵ㶼򴫲֮ڵݶȲſԿʼ򴫲
+	void BackwardParallel()
+	{
+		const int num_nodes = (int)m_nodes.size();
+		if (m_dEdf_lock_count < (size_t)num_nodes)
+		{
+			m_dEdf_lock_count = std::max((size_t)num_nodes, m_dEdf_lock_count * 2);
+			m_dEdf_locks.reset(new std::mutex[m_dEdf_lock_count]);
+		}
+
+		// 㲢Ҫ󵼵Ľڵз򴫲
+		int total = 0;
+		m_schedule_edges.clear();
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (!m_in_computation[i] || !m_needs_derivative[i]) continue;
+			++total;
+			const auto& args = m_nodes[i]->GetArgs();
+			for (size_t j = 0; j < args.size(); ++j)
+			{
+				if (m_needs_derivative[args[j]]) m_schedule_edges.emplace_back(i, args[j]);
+			}
+		}
+		if (total == 0) return;
+		BuildSchedule(0, num_nodes);
+
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (m_in_computation[i] && m_needs_derivative[i] && m_pending[i] == 0) m_ready.push_back(i);
+		}
+
+		RunSchedule(0, total, [this](int i, int worker) { BackwardNode(i, m_worker_xs[worker], worker, true); });
+	}
+
+	// m_schedule_edgesϵ(a, b)ʾaִ֮bִ
+	// m_pendingÿڵ㻹ҪȴĽڵm_next_listÿڵִ֮Ҫ֪ͨĽڵ
+	void BuildSchedule(int base, int count)
+	{
+		m_pending.assign(count, 0);
+		m_next_offset.assign(count + 1, 0);
+		for (const auto& edge : m_schedule_edges)
+		{
+			++m_pending[edge.second - base];
+			++m_next_offset[edge.first - base + 1];
+		}
+		for (int k = 0; k < count; ++k) m_next_offset[k + 1] += m_next_offset[k];
+
+		m_next_list.resize(m_schedule_edges.size());
+		m_next_fill.assign(m_next_offset.begin(), m_next_offset.end() - 1);
+		for (const auto& edge : m_schedule_edges)
+			m_next_list[m_next_fill[edge.first - base]++] = edge.second;
+
+		m_worker_xs.resize(m_thread_pool->GetThreadCount());
+		m_ready.clear();
+	}
+
+	// ̴߳ӾȡڵִУִ֮ѵȴ0ĽڵУtotalڵȫִ֮󷵻
+	template <typename F>
+	void RunSchedule(int base, int total, const F& execute)
+	{
+		m_schedule_finished = 0;
+		m_schedule_exception = nullptr;
+
+		std::function<void(int)> job = [&](int worker)
+		{
+			int node = -1;
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(m_schedule_mutex);
+					if (node >= 0)
+					{
+						++m_schedule_finished;
+						int ready = 0;
+						for (int k = m_next_offset[node - base]; k < m_next_offset[node - base + 1]; ++k)
+						{
+							const int next = m_next_list[k];
+							if (--m_pending[next - base] != 0) continue;
+							m_ready.push_back(next);
+							++ready;
+						}
+
+						// ԼִһĻ߳
+						if (m_schedule_finished == total) m_schedule_cv.notify_all();
+						for (int k = 1; k < ready; ++k) m_schedule_cv.notify_one();
+					}
+
+					m_schedule_cv.wait(lock, [&] { return !m_ready.empty() || m_schedule_finished == total || m_schedule_exception; });
+					if (m_schedule_exception || m_ready.empty()) return;
+					node = m_ready.back();
+					m_ready.pop_back();
+				}
+
+				try
+				{
+					execute(node, worker);
+				}
+				catch (...)
+				{
+					std::unique_lock<std::mutex> lock(m_schedule_mutex);
+					if (!m_schedule_exception) m_schedule_exception = std::current_exception();
+					m_schedule_cv.notify_all();
+					return;
+				}
+			}
+		};
+		m_thread_pool->Run(job);
+
+		m_ready.clear();
+		if (m_schedule_exception) std::rethrow_exception(m_schedule_exception);
+	}
+#endif
+
+	// ȡڵĸڴ
+	cr_real* GetAuxMemory(int i) const
+	{
+		if (m_nodes[i]->GetAuxSize() <= 0) return nullptr;
+		size_t offset = m_fx_offset_list[i];
+		if (!m_nodes[i]->IsRefrenceMemory()) offset += CarpRobotArena::Align(m_nodes[i]->GetDim().GetTotalSize());
+		return m_fx_arena.GetMemory() + offset;
+	}
+
+	// ǰڴֻ׷ӲãΪǰĽڷ򴫲ʱҪõⲿҲʱȡ
+	void BindForwardMemory()
+	{
+		// ʱڴڷڴصǰ
+		// ڴַ仯ʱڴ󸲸ݶȣһη򴫲ݶȾʧЧˣͨGetGradient
+		const size_t scratch_size = GetScratchTotal();
+		if (m_dEdf_arena.Reserve(scratch_size, false) || scratch_size > m_dEdf_bind_scratch) m_dEdf_list.clear();
+
+		int num_nodes = (int)m_nodes.size();
+		if (m_fx_bind_count == num_nodes) return;
+
+		// ڴַ仯ôѾ󶨵ĽڵҪ°󶨣reallocᱣѾõֵ
+		if (m_fx_arena.Reserve(m_fx_size, true))
+		{
+			for (int i = 0; i < m_fx_bind_count; ++i)
+			{
+				// ڵͲڵֱⲿڴ棬°
+				if (m_nodes[i]->IsRefrenceMemory()) continue;
+				m_fx_list[i].RefrenceMemory(m_nodes[i]->GetDim(), m_fx_arena.GetMemory() + m_fx_offset_list[i]);
+			}
+		}
+
+		for (int i = m_fx_bind_count; i < num_nodes; ++i)
+		{
+			if (m_nodes[i]->IsRefrenceMemory()) continue;
+			m_fx_list[i].RefrenceMemory(m_nodes[i]->GetDim(), m_fx_arena.GetMemory() + m_fx_offset_list[i]);
+		}
+		m_fx_bind_count = num_nodes;
+	}
+
+	// ݶȵڣȻ滮ݶڷڴеλ
+	// ڵiݶȴһʹĽڵ㿪ʼд룬ڵiԼ򴫲֮Ͳʹ
+	// з򴫲˳򲻹̶ݶȵڴ治ܸ
+	void PlanBackward(bool parallel)
+	{
+		int num_nodes = (int)m_nodes.size();
 
 		// ڵҪ򴫲
-		std::vector<bool> needs_derivative(num_nodes, false);
+		m_needs_derivative.assign(num_nodes, false);
+		m_is_parameter.assign(num_nodes, false);
 		for (auto& pair : m_parameter_map)
-			needs_derivative[pair.first] = true;
+		{
+			m_needs_derivative[pair.first] = true;
+			m_is_parameter[pair.first] = true;
+		}
 
 		// ӵвڵĽڵ㣬ΪҪ򴫲
 		for (int i = 0; i < num_nodes; ++i)
 		{
 			// ڵѾλҪ󵼣ôֱ
-			bool need = needs_derivative[i];
+			bool need = m_needs_derivative[i];
 			if (need) continue;
 
 			// ڵĳڵҪ󵼣ôڵҲҪ
@@ -3129,7 +3983,7 @@ public:
 			const auto& args = node->GetArgs();
 			for (size_t j = 0; j < args.size(); ++j)
 			{
-				if (needs_derivative[args[j]])
+				if (m_needs_derivative[args[j]])
 				{
 					need = true;
 					break;
@@ -3137,49 +3991,80 @@ public:
 			}
 
 			// ΪǷҪ
-			needs_derivative[i] = need;
+			m_needs_derivative[i] = need;
 		}
 
 		// ֻǲĽڵ㣬Ĭϲ
-		std::vector<bool> in_computation(num_nodes, false);
-		in_computation[num_nodes - 1] = true;	// һڵҪ
+		m_in_computation.assign(num_nodes, false);
+		m_in_computation[num_nodes - 1] = true;	// һڵҪ
 
-		// ڵ
-		std::vector<const CarpRobotTensor*> xs;
+		// ¼ÿڵݶȵһαдʱڷ򴫲Ľڵ±꣬-1ʾҪݶڴ
+		m_dEdf_first_list.assign(num_nodes, -1);
+		m_dEdf_first_list[num_nodes - 1] = num_nodes - 1;
 		for (int i = num_nodes - 1; i >= 0; --i)
 		{
-			// ڵ㲻㣬ֱ
-			if (!in_computation[i]) continue;
-
-			// ȡڵ
-			auto* node = m_nodes[i];
+			if (!m_in_computation[i]) continue;
 
-			// ȡýڵ
-			const auto& args = node->GetArgs();
-			xs.resize(args.size());
+			const auto& args = m_nodes[i]->GetArgs();
 			for (size_t j = 0; j < args.size(); ++j)
 			{
 				const int arg = args[j];
-
-				// ڵΪĽڵ
-				in_computation[arg] = true;
-
-				// ڵ
-				xs[j] = &m_fx_list[arg];
+				m_in_computation[arg] = true;
+				// һľһʹĽڵ
+				if (m_needs_derivative[arg] && m_dEdf_first_list[arg] < 0)
+					m_dEdf_first_list[arg] = i;
 			}
+		}
 
-			// ڵ㣬Ҫ󵼵붼Ҫз򴫲
+		// 򴫲˳ģͷ
+		m_dEdf_arena.ResetPlan();
+		m_dEdf_offset_list.assign(num_nodes, 0);
+		m_dEdf_offset_list[num_nodes - 1] = m_dEdf_arena.PlanAlloc(m_nodes[num_nodes - 1]->GetDim().GetTotalSize());
+		for (int i = num_nodes - 1; i >= 0; --i)
+		{
+			if (!m_in_computation[i]) continue;
+
+			// ڵ㿪ʼдݶ
+			const auto& args = m_nodes[i]->GetArgs();
 			for (size_t j = 0; j < args.size(); ++j)
 			{
 				const int arg = args[j];
-				if (needs_derivative[arg])
-					node->Backward(xs, m_fx_list[i], m_dEdf_list[i], (unsigned int)j, m_dEdf_list[arg]);
+				if (m_dEdf_first_list[arg] != i) continue;
+
+				// ͬһֶܳΣֻһ
+				bool repeat = false;
+				for (size_t k = 0; k < j; ++k) repeat = repeat || args[k] == arg;
+				if (repeat) continue;
+
+				m_dEdf_offset_list[arg] = m_dEdf_arena.PlanAlloc(m_nodes[arg]->GetDim().GetTotalSize());
 			}
+
+			// ڵ㷴򴫲֮ԼݶȾͲʹˣڵݶҪ
+			if (!parallel && !m_is_parameter[i] && m_dEdf_first_list[i] >= 0)
+				m_dEdf_arena.PlanFree(m_dEdf_offset_list[i], m_nodes[i]->GetDim().GetTotalSize());
 		}
 
-		// Ľõڵȥ
-		for (auto& pair : m_parameter_map)
-			pair.second->AccumulateGrad(m_dEdf_list[pair.first]);
+		m_backward_plan_count = num_nodes;
+		m_backward_plan_parallel = parallel;
+	}
+
+	// 滮ĽݶȰ󶨵ڴ
+	void BindBackwardMemory()
+	{
+		int num_nodes = (int)m_nodes.size();
+		size_t scratch_size = GetScratchTotal();
+		m_dEdf_arena.Reserve(scratch_size + m_dEdf_arena.GetPlanSize(), false);
+		m_dEdf_bind_scratch = scratch_size;
+
+		m_dEdf_list.resize(num_nodes);
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			// ҪݶȵĽڵ㲻ڴ
+			if (m_dEdf_first_list[i] < 0)
+				m_dEdf_list[i].RefrenceMemory(m_nodes[i]->GetDim(), nullptr);
+			else
+				m_dEdf_list[i].RefrenceMemory(m_nodes[i]->GetDim(), m_dEdf_arena.GetMemory() + scratch_size + m_dEdf_offset_list[i]);
+		}
 	}
 
 private:
@@ -3191,6 +4076,46 @@ private:
 	std::vector<CarpRobotTensor> m_dEdf_list;		// 淴Ľ
 	int m_evaluated_index = 0;				// ¼ǰ㵽Ǹڵ
 	bool m_immediate_compute = false;			// Ƿ
+	std::vector<CarpRobotTensor>* m_gradient_buffer = nullptr;	// ݶȵȥΪʱֱۼӵ
+	std::vector<const CarpRobotTensor*> m_xs;		// ʱбƵ
+
+private:
+	CarpRobotArena m_fx_arena;				// ǰڴأŽڵ͸ڴ
+	std::vector<size_t> m_fx_offset_list;		// ÿڵǰڴصƫ
+	size_t m_fx_size = 0;					// ǰڴʹõĴС
+	int m_fx_bind_count = 0;				// ѾڴĽڵ
+	int m_scratch_size = 0;					// нڵ㹲õʱڴС
+
+private:
+	CarpRobotArena m_dEdf_arena;			// ڴأǰʱڴ棬ݶ
+	std::vector<size_t> m_dEdf_offset_list;	// ÿڵݶڷڴصƫ(ʱڴ)
+	std::vector<int> m_dEdf_first_list;		// ÿڵݶȵһαдʱڷ򴫲Ľڵ㣬-1ʾûݶ
+	size_t m_dEdf_bind_scratch = 0;			// ݶʱʱڴĴСݶĺ
+	std::vector<bool> m_needs_derivative;		// ǷҪ
+	std::vector<bool> m_is_parameter;		// Ƿǲڵ
+	std::vector<bool> m_in_computation;		// Ƿ뷴򴫲
+	int m_backward_plan_count = 0;			// 滮ʱĽڵ͵ǰһ¾Ҫ¹滮
+	bool m_backward_plan_parallel = false;	// 滮Ƿ񰴲й滮
+
+#ifdef CARP_ROBOT_THREADS
+private:
+	CarpRobotThreadPool* m_thread_pool = nullptr;	// ̳߳أΪձʾ̼߳
+	std::unique_ptr<std::mutex[]> m_dEdf_locks;		// з򴫲ʱÿڵݶһ
+	size_t m_dEdf_lock_count = 0;					// m_dEdf_locks
+	std::vector<std::vector<const CarpRobotTensor*>> m_worker_xs;	// ÿ̵߳б
+
+private:
+	std::vector<std::pair<int, int>> m_schedule_edges;	// ڵ֮ϵ
+	std::vector<int> m_pending;						// ÿڵ㻹ҪȴĽڵ
+	std::vector<int> m_next_offset;					// ÿڵm_next_listеʼλ
+	std::vector<int> m_next_list;					// ÿڵִ֮Ҫ֪ͨĽڵ
+	std::vector<int> m_next_fill;					// m_next_listʱдλ
+	std::vector<int> m_ready;						// ִеĽڵ
+	int m_schedule_finished = 0;					// ѾִϵĽڵ
+	std::exception_ptr m_schedule_exception;		// ִнڵʱ׳ĵһ쳣
+	std::mutex m_schedule_mutex;
+	std::condition_variable m_schedule_cv;
+#endif
 
 private:
 	std::string m_string;
@@ -3214,6 +4139,7 @@ public:
 		// parametersб
 		for (size_t i = 0; i < parameters.size(); ++i)
 		{
+			CARP_ROBOT_ASSERT(!parameters[i]->IsReadOnly(), u8"õֻڴ棬ѵ:" << parameters[i]->GetFullName());
 			// gscale
 			UpdateParameter((int)i, parameters[i]);
 			// ݶֵ
@@ -3303,4 +4229,213 @@ private:
 	std::vector<CarpRobotTensor> m_v; // History of deltas
 };
 
+#ifdef CARP_ROBOT_THREADS
+// ݲѵ
+// ÿ߳ԼļͼһݶȻ̹߳ģ򴫲ʱֻ
+// ̷߳򴫲֮󣬰ݶȻΪݶȣȻѵһβ
+class CarpRobotDataParallel
+{
+public:
+	CarpRobotDataParallel(CarpRobotParameterCollection* model, CarpRobotTrainer* trainer, int thread_count)
+		: m_model(model), m_trainer(trainer), m_pool(thread_count < 1 ? 1 : thread_count, false)
+	{
+		const int count = m_pool.GetThreadCount();
+		m_graphs.resize(count);
+		m_buffers.resize(count);
+		m_losses.resize(count, 0);
+		for (int i = 0; i < count; ++i)
+		{
+			m_graphs[i] = new CarpRobotComputationGraph();
+			m_graphs[i]->SetGradientBuffer(&m_buffers[i]);
+		}
+	}
+	~CarpRobotDataParallel()
+	{
+		for (auto* graph : m_graphs) delete graph;
+	}
+
+public:
+	int GetThreadCount() const { return m_pool.GetThreadCount(); }
+	CarpRobotComputationGraph* GetGraph(int worker) const { return m_graphs[worker]; }
+
+	// ִһѵ
+	// ÿ̵߳build(worker, graph)յļͼϹԼһݣʧһڵ
+	// ģͲ(CarpRobotLinear)BuildʱסǰͼıʽbuildִУͷ򴫲ǲе
+	// ̵߳ʧ֮
+	cr_real Step(const std::function<void(int, CarpRobotComputationGraph*)>& build)
+	{
+		PrepareBuffers();
+		m_exception = nullptr;
+
+		// ÿ߳ǰͷ򴫲ݶдԼĻ
+		m_pool.Run([this, &build](int worker)
+		{
+			try
+			{
+				auto* graph = m_graphs[worker];
+				graph->Clear();
+				{
+					std::lock_guard<std::mutex> lock(m_build_mutex);
+					build(worker, graph);
+				}
+				m_losses[worker] = graph->AsScalar(graph->GetNodeCount() - 1);
+				graph->Backward();
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_exception) m_exception = std::current_exception();
+			}
+		});
+		if (m_exception) std::rethrow_exception(m_exception);
+
+		// вβһ飬ÿ̸߳һΣлӦĲּӵݶϣ˳㻺
+		m_pool.Run([this](int worker) { Reduce(worker); });
+
+		m_trainer->Update();
+
+		cr_real loss = 0;
+		for (auto value : m_losses) loss += value;
+		return loss;
+	}
+
+private:
+	// б仯ʱ·ݶȻ
+	void PrepareBuffers()
+	{
+		const auto& parameters = m_model->GetParameters();
+		if (m_offsets.size() == parameters.size() + 1) return;
+
+		m_offsets.resize(parameters.size() + 1);
+		m_offsets[0] = 0;
+		for (size_t i = 0; i < parameters.size(); ++i)
+			m_offsets[i + 1] = m_offsets[i] + parameters[i]->GetGradient().GetDim().GetTotalSize();
+
+		for (auto& buffer : m_buffers)
+		{
+			buffer.resize(parameters.size());
+			for (size_t i = 0; i < parameters.size(); ++i)
+				buffer[i].SetDim(parameters[i]->GetGradient().GetDim(), true);
+		}
+	}
+
+	void Reduce(int worker)
+	{
+		const auto& parameters = m_model->GetParameters();
+		const int count = GetThreadCount();
+		const size_t total = m_offsets.back();
+		const size_t begin = total * worker / count;
+		const size_t end = total * (worker + 1) / count;
+
+		// ҵһ[begin, end)нĲ
+		size_t p = std::upper_bound(m_offsets.begin(), m_offsets.end(), begin) - m_offsets.begin() - 1;
+		for (; p < parameters.size() && m_offsets[p] < end; ++p)
+		{
+			const size_t first = std::max(begin, m_offsets[p]) - m_offsets[p];
+			const size_t last = std::min(end, m_offsets[p + 1]) - m_offsets[p];
+			if (first >= last) continue;
+
+			auto grad = parameters[p]->GetGradient().vec().segment(first, last - first);
+			for (auto& buffer : m_buffers)
+			{
+				auto part = buffer[p].vec().segment(first, last - first);
+				grad += part;
+				part.setZero();
+			}
+		}
+	}
+
+private:
+	CarpRobotParameterCollection* m_model = nullptr;
+	CarpRobotTrainer* m_trainer = nullptr;
+	CarpRobotThreadPool m_pool;							// ֻÿͼڲ̼߳
+
+private:
+	std::vector<CarpRobotComputationGraph*> m_graphs;		// ÿ̵߳ļͼ
+	std::vector<std::vector<CarpRobotTensor>> m_buffers;	// ÿ̵߳ݶȻ±
+	std::vector<size_t> m_offsets;							// ÿвеʼλãһܴС
+	std::vector<cr_real> m_losses;							// ÿ̵߳ʧ
+
+private:
+	std::mutex m_build_mutex;							// ͼʱ
+	std::mutex m_mutex;
+	std::exception_ptr m_exception;						// ִ߳ʱ׳ĵһ쳣
+};
+#endif
+
+/* eg. 鿴ͼڴصʹClear֮ڴر¹ͬļͼڴ
+	CarpRobotParameterCollection model;
+	CarpRobotLstm lstm(&model, 2, 32, 64, false);
+	CarpRobotLinear linear(&model, 64, 10);
+	CarpRobotAdamTrainer trainer(&model);
+	CarpRobotComputationGraph graph;
+	std::vector<cr_real> input(32);
+	for (int step = 0; step < 100; ++step)
+	{
+		graph.Clear();
+		lstm.Build(&graph, nullptr, nullptr, true);
+		linear.Build(&graph);
+		CarpRobotExpression h;
+		for (int i = 0; i < 20; ++i) h = lstm.AddInput(graph.AddInput(CarpRobotDim({ 32 }), &input));
+		auto loss = linear.Forward(h).PickNegLogSoftmax(3);
+		graph.AsScalar(loss.GetIndex());
+		graph.Backward();
+		trainer.Update();
+	}
+	printf("forward:%d backward:%d alloc:%d\n", graph.GetForwardMemory(), graph.GetBackwardMemory(), graph.GetArenaAllocCount());
+*/
+
+/* eg. ѵһżͼͬʱbd밴УSumBatchesÿʧ
+	const int bd = 128;
+	CarpRobotParameterCollection model;
+	CarpRobotLinear l1(&model, 784, 256);
+	CarpRobotLinear l2(&model, 256, 10);
+	CarpRobotAdamTrainer trainer(&model);
+	std::vector<cr_real> images(784 * bd);
+	std::vector<int> labels(bd);
+	CarpRobotComputationGraph graph;
+	graph.Clear();
+	l1.Build(&graph);
+	l2.Build(&graph);
+	auto x = graph.AddInput(CarpRobotDim({ 784 }, bd), &images);
+	auto loss = l2.Forward(l1.Forward(x).Rectify()).PickNegLogSoftmax(&labels).SumBatches();
+	graph.AsScalar(loss.GetIndex());
+	graph.Backward();
+	trainer.Update();
+*/
+
+/* eg. ̼߳㣬̳߳ڼͼ棬Clear֮һóCPU
+	CarpRobotComputationGraph graph;
+	graph.SetThreadCount(std::thread::hardware_concurrency());
+	// ֮󹹽ͼForwardBackward÷䣬ûϵĽڵ(˫LSTM)ͬʱ
+	// ˷ػڵڲлͨзֵ߳
+*/
+
+/* eg. ݲѵÿһ256ƽָ̣߳ϲݶ֮һβ
+	CarpRobotParameterCollection model;
+	CarpRobotLinear l1(&model, 784, 256);
+	CarpRobotLinear l2(&model, 256, 10);
+	CarpRobotAdamTrainer trainer(&model);
+	CarpRobotDataParallel parallel(&model, &trainer, std::thread::hardware_concurrency());
+	const int count = parallel.GetThreadCount();
+	std::vector<std::vector<cr_real>> images(count);	// ÿ߳Լһ
+	std::vector<std::vector<int>> labels(count);
+	auto start = std::chrono::steady_clock::now();
+	for (int step = 0; step < 100; ++step)
+	{
+		cr_real loss = parallel.Step([&](int worker, CarpRobotComputationGraph* graph)
+		{
+			const int bd = 256 * (worker + 1) / count - 256 * worker / count;
+			images[worker].resize(784 * bd);	// 
+			labels[worker].resize(bd);
+			l1.Build(graph);
+			l2.Build(graph);
+			auto x = graph->AddInput(CarpRobotDim({ 784 }, bd), &images[worker]);
+			l2.Forward(l1.Forward(x).Rectify()).PickNegLogSoftmax(&labels[worker]).SumBatches();
+		});
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("threads:%d samples/s:%f\n", count, 256 * 100 / seconds);
+*/
+
 #endif
\ No newline at end of file
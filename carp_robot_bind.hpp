@@ -3,6 +3,8 @@
 
 #include "carp_robot.hpp"
 #include "carp_robot_model.hpp"
+#include "carp_robot_inference.hpp"
+#include "carp_robot_model_file.hpp"
 #include "carp_lua.hpp"
 #include "carp_surface.hpp"
 #include "carp_mfcc.hpp"
@@ -29,6 +31,22 @@ public:
 	}
 
 public:
+	// СݰУÿռGetTotalSize()/bdԪ
+	void SetBatch(int bd)
+	{
+		if (bd < 1) bd = 1;
+		m_dim.SetBatch(bd);
+		m_value.resize(m_dim.GetTotalSize(), 0);
+		m_batch_index = 0;
+	}
+
+	// ֮Copyдλ
+	void SetBatchIndex(int index)
+	{
+		if (index < 0 || index >= m_dim.GetBatch()) return;
+		m_batch_index = index;
+	}
+
 	void Build(CarpRobotComputationGraph* graph)
 	{
 		m_expression = graph->AddInput(m_dim, &m_value);
@@ -67,17 +85,26 @@ public:
 
 	void Copy(const std::vector<cr_real>& data)
 	{
-		m_value = data;
+		if (m_dim.GetBatch() == 1)
+		{
+			m_value = data;
+			return;
+		}
+
+		const size_t size = m_dim.GetBatchSize();
+		const size_t count = data.size() < size ? data.size() : size;
+		std::copy(data.begin(), data.begin() + count, m_value.begin() + m_batch_index * size);
 	}
 
 	void Copy(cr_real value)
 	{
-		m_value[0] = value;
+		m_value[m_batch_index * m_dim.GetBatchSize()] = value;
 	}
 
 private:
 	std::vector<cr_real> m_value;
 	CarpRobotDim m_dim;
+	int m_batch_index = 0;
 	CarpRobotExpression m_expression;
 };
 
@@ -131,17 +158,19 @@ public:
 		if (!wav_file.is_open()) return false;
 
 		CarpMFCC mfcc;
-		std::vector<std::vector<double>> mfcc_list;
+		std::vector<double> features;
 		std::string error;
-		if (!mfcc.process(wav_file, mfcc_list, error)) return false;
+		if (!mfcc.process(wav_file, features, error)) return false;
 
-		m_value.resize(mfcc_list.size());
-		for (size_t i = 0; i < mfcc_list.size(); ++i)
+		// ÿһ֡ŵģĽضϣĲ0
+		const size_t feature_size = mfcc.getFeatureSize();
+		const size_t copy_count = std::min(feature_size, (size_t)param_count);
+		m_value.resize(features.size() / feature_size);
+		for (size_t i = 0; i < m_value.size(); ++i)
 		{
-			mfcc_list[i].resize(param_count);
-			m_value[i].resize(param_count);
-			for (size_t j = 0; j < mfcc_list[i].size(); ++j)
-				m_value[i][j] = static_cast<cr_real>(mfcc_list[i][j]);
+			m_value[i].assign(param_count, 0);
+			for (size_t j = 0; j < copy_count; ++j)
+				m_value[i][j] = static_cast<cr_real>(features[i * feature_size + j]);
 		}
 
 		return true;
@@ -604,6 +633,7 @@ public:
 			.addConstructor<void(*)()>()
 			.addFunction("Count", &CarpRobotDim::Count)
 			.addFunction("Get", &CarpRobotDim::Get)
+			.addFunction("GetBatch", &CarpRobotDim::GetBatch)
 			.endClass()
 
 			.beginClass<CarpRobotComputationGraph>("CarpRobotComputationGraph")
@@ -611,11 +641,17 @@ public:
 			.addFunction("Clear", &CarpRobotComputationGraph::Clear)
 			.addFunction("Invalidate", &CarpRobotComputationGraph::Invalidate)
 			.addFunction("Backward", &CarpRobotComputationGraph::Backward)
+			.addFunction("SetThreadCount", &CarpRobotComputationGraph::SetThreadCount)
+			.addFunction("GetThreadCount", &CarpRobotComputationGraph::GetThreadCount)
 			.addFunction("AsScalar", &CarpRobotComputationGraph::AsScalar)
 			.addFunction("AsVectorAndArgmax", &CarpRobotComputationGraph::AsVectorAndArgmax)
+			.addFunction("AsBatchVectorAndArgmax", &CarpRobotComputationGraph::AsBatchVectorAndArgmax)
 			.addFunction("AsVectorAndMaxValue", &CarpRobotComputationGraph::AsVectorAndMaxValue)
 			.addFunction("AsVectorAndGetValue", &CarpRobotComputationGraph::AsVectorAndGetValue)
 			.addFunction("GetDim", &CarpRobotComputationGraph::GetDim)
+			.addFunction("GetForwardMemory", &CarpRobotComputationGraph::GetForwardMemory)
+			.addFunction("GetBackwardMemory", &CarpRobotComputationGraph::GetBackwardMemory)
+			.addFunction("GetArenaAllocCount", &CarpRobotComputationGraph::GetArenaAllocCount)
 
 			.addFunction("Negate", &CarpRobotComputationGraph::Negate)
 			.addFunction("Addition", &CarpRobotComputationGraph::Addition)
@@ -642,12 +678,40 @@ public:
 			.addFunction("Reshape", &CarpRobotComputationGraph::Reshape)
 			.addFunction("PickElement", &CarpRobotComputationGraph::PickElement)
 			.addFunction("MeanElements", &CarpRobotComputationGraph::MeanElements)
+			.addFunction("SumBatches", &CarpRobotComputationGraph::SumBatches)
+			.endClass()
+			.beginClass<CarpRobotInference>("CarpRobotInference")
+			.addConstructor<void(*)()>()
+			.addFunction("Compile", &CarpRobotInference::CompileForLua)
+			.addFunction("Clear", &CarpRobotInference::Clear)
+			.addFunction("Forward", &CarpRobotInference::Forward)
+			.addFunction("AsScalar", &CarpRobotInference::AsScalar)
+			.addFunction("AsVectorAndArgmax", &CarpRobotInference::AsVectorAndArgmax)
+			.addFunction("AsBatchVectorAndArgmax", &CarpRobotInference::AsBatchVectorAndArgmax)
+			.addFunction("AsVectorAndMaxValue", &CarpRobotInference::AsVectorAndMaxValue)
+			.addFunction("AsVectorAndGetValue", &CarpRobotInference::AsVectorAndGetValue)
+			.addFunction("GetOpCount", &CarpRobotInference::GetOpCount)
+			.addFunction("GetFusedCount", &CarpRobotInference::GetFusedCount)
+			.addFunction("GetMemory", &CarpRobotInference::GetMemory)
+			.addFunction("Calibrate", &CarpRobotInference::Calibrate)
+			.addFunction("Quantize", &CarpRobotInference::Quantize)
+			.addFunction("IsQuantized", &CarpRobotInference::IsQuantized)
+			.addFunction("GetQuantizedMemory", &CarpRobotInference::GetQuantizedMemory)
 			.endClass()
 			.beginClass<CarpRobotParameterCollection>("CarpRobotParameterCollection")
 			.addConstructor<void(*)()>()
 			.addFunction("Load", &CarpRobotParameterCollection::Load)
 			.addFunction("Save", &CarpRobotParameterCollection::Save)
 			.endClass()
+			.beginClass<CarpRobotModelFile>("CarpRobotModelFile")
+			.addStaticFunction("Load", &CarpRobotModelFile::Load)
+			.addStaticFunction("Save", &CarpRobotModelFile::Save)
+			.addStaticFunction("Convert", &CarpRobotModelFile::Convert)
+			.endClass()
+			.beginClass<CarpRobotSimd>("CarpRobotSimd")
+			.addStaticFunction("SetApproximate", &CarpRobotSimd::SetApproximate)
+			.addStaticFunction("IsApproximate", &CarpRobotSimd::IsApproximate)
+			.endClass()
 			.beginClass<CarpRobotAdamTrainer>("CarpRobotAdamTrainer")
 			.addConstructor<void(*)(CarpRobotParameterCollection*, float, float, float, float)>()
 			.addFunction("Update", &CarpRobotAdamTrainer::Update)
@@ -656,6 +720,8 @@ public:
 			.addConstructor<void(*)(int, int, int)>()
 			.addFunction("Build", &CarpRobotInput::Build)
 			.addFunction("Calc", &CarpRobotInput::Calc)
+			.addFunction("SetBatch", &CarpRobotInput::SetBatch)
+			.addFunction("SetBatchIndex", &CarpRobotInput::SetBatchIndex)
 			.addCFunction("Update", &CarpRobotInput::Update)
 			.endClass()
 			.beginClass<CarpRobotLinear>("CarpRobotLinear")
@@ -676,12 +742,15 @@ public:
 			.addFunction("Build", &CarpRobotLstm::BuildForLua)
 			.addFunction("SetDropoutRate", &CarpRobotLstm::SetDropoutRate)
 			.addFunction("SetDropoutRateH", &CarpRobotLstm::SetDropoutRateH)
+			.addFunction("SetBatchSize", &CarpRobotLstm::SetBatchSize)
 			.addFunction("AddInput", &CarpRobotLstm::AddInputForLua)
 			.endClass()
 
 			.beginClass<CarpRobotLabel>("CarpRobotLabel")
 			.addConstructor<void(*)()>()
 			.addFunction("Update", &CarpRobotLabel::Update)
+			.addFunction("SetBatch", &CarpRobotLabel::SetBatch)
+			.addFunction("UpdateBatch", &CarpRobotLabel::UpdateBatch)
 			.endClass()
 		
 			.beginClass<CarpRobotMnist>("CarpRobotMnist")
@@ -5,6 +5,9 @@
 #include "carp_robot_model.hpp"
 #include "carp_log.hpp"
 
+#include <chrono>
+#include <functional>
+
 class CarpRobotDemo
 {
 public:
@@ -172,6 +175,57 @@ public:
 			cg.Invalidate();
 		}
 	}
+
+	// ԪؽڵܣֱþȷͽƵļһ飬ÿԪصĺʱ
+	void Demo4()
+	{
+		CarpRobotParameterCollection model;
+		auto* pa = model.AddParameters(CarpRobotDim({ 256, 256 }));
+		auto* pb = model.AddParameters(CarpRobotDim({ 256, 256 }));
+		auto* pc = model.AddParameters(CarpRobotDim({ 256, 1 }));
+		auto* pd = model.AddParameters(CarpRobotDim({ 1000, 64 }));
+
+		typedef std::function<CarpRobotExpression(CarpRobotComputationGraph&)> Build;
+		std::vector<std::pair<std::string, Build>> list = {
+			{ "CwiseSum", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa) + cg.AddParameters(pb); } },
+			{ "CwiseSum broadcast", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa) + cg.AddParameters(pc); } },
+			{ "CwiseMultiply", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa).CwiseMultiply(cg.AddParameters(pb)); } },
+			{ "CwiseMultiply broadcast", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa).CwiseMultiply(cg.AddParameters(pc)); } },
+			{ "CwiseQuotient broadcast", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa) / (cg.AddParameters(pc) + 2); } },
+			{ "Sigmoid", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa).Sigmoid(); } },
+			{ "Tanh", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pa).Tanh(); } },
+			{ "Softmax", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pd).Softmax(); } },
+			{ "LogSoftmax", [&](CarpRobotComputationGraph& cg) { return cg.AddParameters(pd).LogSoftmax(); } },
+		};
+
+		for (int approximate = 0; approximate < 2; ++approximate)
+		{
+			CarpRobotSimd::SetApproximate(approximate != 0);
+			for (auto& pair : list)
+			{
+				CarpRobotComputationGraph cg;
+				auto out = pair.second(cg);
+				const int count = out.GetValue().GetDim().GetTotalSize();
+				const int times = 100;
+
+				auto start = std::chrono::steady_clock::now();
+				for (int i = 0; i < times; ++i)
+				{
+					cg.Invalidate();
+					out.GetValue();
+				}
+				auto middle = std::chrono::steady_clock::now();
+				for (int i = 0; i < times; ++i)
+					cg.Backward();
+				auto end = std::chrono::steady_clock::now();
+
+				const double forward = std::chrono::duration<double, std::nano>(middle - start).count() / times / count;
+				const double backward = std::chrono::duration<double, std::nano>(end - middle).count() / times / count;
+				CARP_INFO(pair.first << (approximate ? " approximate" : "") << " forward:" << forward << "ns backward:" << backward << "ns");
+			}
+		}
+		CarpRobotSimd::SetApproximate(false);
+	}
 };
 
 #endif
\ No newline at end of file
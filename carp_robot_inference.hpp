@@ -0,0 +1,1062 @@
+#ifndef CARP_ROBOT_INFERENCE_INCLUDED
+#define CARP_ROBOT_INFERENCE_INCLUDED
+
+#include "carp_robot.hpp"
+#include "carp_robot_quantize.hpp"
+
+#include <map>
+
+// ִֻѵõļͼһƽб
+// 1. dropoutֱʹ룬뻻ֵֵ1˷ֱȥ
+// 2. ˷+ƫ+AffineTransform+LSTMźϸ״̬Ժϲһ
+// 3. ӵִ˳滮ڴ棬м֮ϸãִеʱκڴ
+// 4. AffineTransformsoftmaxֱӼ㣬ڵForwardsoftmaxҲϲǰľ˷
+//    ʡµÿӵĵÿСԱ죬Ҫھ˷ϵͼͼٶȲ
+// 5. ѡint8ΪȨصľ˷;int8㣬CalibrateһЩͳķΧȻQuantize
+// ڵͲڵֱⲿڴ棬޸ݻѵ²֮󣬵ForwardͿԵõµĽ֮²ҪQuantize
+// ֮ͼClearҲӽڵ㣬ͼ˽ṹ仯Ҫ±
+class CarpRobotInference
+{
+public:
+	CarpRobotInference() {}
+	~CarpRobotInference() {}
+
+private:
+	CarpRobotInference(const CarpRobotInference&) {}
+	void operator = (const CarpRobotInference&) {}
+
+public:
+	enum OpType
+	{
+		OP_NODE = 0,		// ֱִнڵForward
+		OP_ALIAS = 1,		// ֱһڵڴ
+		OP_MATMUL_BIAS = 2,	// W * x + bȻִм
+		OP_AFFINE = 3,		// AffineTransformȻִм
+		OP_LSTM = 4,		// LSTMĸźϸ״̬Լѡ״̬
+		OP_ACTIVATE = 5,	// ûкϲļ
+	};
+
+	enum ActType
+	{
+		ACT_NONE = 0,
+		ACT_RECTIFY = 1,
+		ACT_TANH = 2,
+		ACT_SIGMOID = 3,
+		ACT_SOFTMAX = 4,
+	};
+
+public:
+	// ͼoutputsҪȡĽڵ±ֻ꣬ЩڵֵForward֮Ч
+	void Compile(CarpRobotComputationGraph* graph, const std::vector<int>& outputs)
+	{
+		CARP_ROBOT_ASSERT(graph && graph->GetNodeCount() > 0, u8"ͼûнڵ㣬޷");
+		CARP_ROBOT_ASSERT(outputs.size() > 0, u8"Ҫһڵ");
+
+		Clear();
+		m_graph = graph;
+		const int num_nodes = graph->GetNodeCount();
+		for (auto output : outputs)
+			CARP_ROBOT_ASSERT(output >= 0 && output < num_nodes, u8"ڵԽ:" << output);
+
+		m_values.resize(num_nodes);
+		m_root.resize(num_nodes);
+		m_live.assign(num_nodes, false);
+		m_pinned.assign(num_nodes, false);
+		m_claimed.assign(num_nodes, false);
+		m_use_count.assign(num_nodes, 0);
+		m_consumers.assign(num_nodes, std::vector<int>());
+		m_is_output.assign(num_nodes, false);
+		for (auto output : outputs) m_is_output[output] = true;
+
+		FindAlias();
+		MarkLive();
+		FusePatterns();
+		BuildOps();
+		PlanMemory();
+	}
+
+	// ֻһڵ
+	void CompileForLua(CarpRobotComputationGraph* graph, int output) { Compile(graph, std::vector<int>(1, output)); }
+
+	// 
+	void Clear()
+	{
+		m_graph = nullptr;
+		m_ops.clear();
+		m_pending.clear();
+		m_anchor.clear();
+		m_values.clear();
+		m_root.clear();
+		m_live.clear();
+		m_pinned.clear();
+		m_claimed.clear();
+		m_fused_output.clear();
+		m_mask.clear();
+		m_use_count.clear();
+		m_consumers.clear();
+		m_is_output.clear();
+		m_static_alias.clear();
+		m_fused_count = 0;
+		m_memory_size = 0;
+		m_quantized = false;
+		m_quant_weights.clear();
+		m_quant_buffer.clear();
+	}
+
+public:
+	// ִ
+	void Forward()
+	{
+		CARP_ROBOT_ASSERT(m_graph, u8"ûбͼ");
+		for (auto& op : m_ops) Execute(op);
+	}
+
+	// һУ׼ִһθ㣬¼ÿľֵֵһüٸдԵ
+	void Calibrate()
+	{
+		CARP_ROBOT_ASSERT(m_graph, u8"ûбͼ");
+		bool quantized = m_quantized;
+		m_quantized = false;
+		for (auto& op : m_ops)
+		{
+			for (auto& pair : op.pairs)
+			{
+				const CarpRobotTensor& x = *op.xs[pair.x];
+				pair.range = std::max(pair.range, CarpRobotAbsMax(x.GetValue(), x.GetDim().GetTotalSize()));
+			}
+			Execute(op);
+		}
+		m_quantized = quantized;
+	}
+
+	// Ȩذͨint8֮Forwardʹint8
+	// 밴У׼ķΧΧֵضϣûУ׼ÿμʱͳƷΧ
+	void Quantize()
+	{
+		CARP_ROBOT_ASSERT(m_graph, u8"ûбͼ");
+		m_quant_weights.clear();
+		std::map<int, int> weights;
+		size_t buffer_size = 0;
+		for (auto& op : m_ops)
+		{
+			auto* conv = op.type == OP_NODE ? As<CarpRobotConv2DNode>(op.index) : nullptr;
+			for (auto& pair : op.pairs)
+			{
+				// ͬһڶʹãLSTMÿһֻһ
+				int w = GetInputNode(op, pair.w);
+				auto it = weights.find(w);
+				if (it == weights.end())
+				{
+					const CarpRobotTensor& value = m_values[w];
+					const CarpRobotDim& dim = value.GetDim();
+					m_quant_weights.emplace_back(CarpRobotQuantizedMatrix());
+					if (conv) m_quant_weights.back().QuantizeRowMajor(value.GetValue(), dim[3], dim[0] * dim[1] * dim[2]);
+					else m_quant_weights.back().QuantizeColMajor(value.GetValue(), dim.Rows(), dim.Cols());
+					it = weights.insert(std::make_pair(w, (int)m_quant_weights.size() - 1)).first;
+				}
+				pair.weight = it->second;
+
+				// Ҫ֮һ飬˷Ҫ֮ÿһ
+				const auto& weight = m_quant_weights[pair.weight];
+				const CarpRobotDim& x_dim = op.xs[pair.x]->GetDim();
+				size_t size = 0;
+				if (conv) size = CarpRobotInt8Align(x_dim.GetTotalSize()) + weight.GetStride();
+				else size = (size_t)weight.GetStride() * x_dim.Cols() * x_dim.GetBatch();
+				buffer_size = std::max(buffer_size, size);
+			}
+		}
+		m_quant_buffer.resize(buffer_size);
+		m_quantized = true;
+	}
+
+	// ǷѾ
+	bool IsQuantized() const { return m_quantized; }
+
+	// ȡڵֵҪȵForward
+	const CarpRobotTensor& GetValue(int i) const
+	{
+		CARP_ROBOT_ASSERT(i >= 0 && i < (int)m_is_output.size() && m_is_output[i], u8"Ǳʱָڵ:" << i);
+		return m_values[i];
+	}
+
+	cr_real AsScalar(int i) const { return GetValue(i).AsScalar(); }
+	int AsVectorAndArgmax(int i) const { return GetValue(i).AsVectorAndArgmax(); }
+	cr_real AsVectorAndMaxValue(int i) const { return GetValue(i).AsVectorAndMaxValue(); }
+	cr_real AsVectorAndGetValue(int i, int index) const { return GetValue(i).AsVectorAndGetValue(index); }
+	int AsBatchVectorAndArgmax(int i, int b) const { return GetValue(i).AsBatchVectorAndArgmax(b); }
+
+public:
+	// ȡ
+	int GetOpCount() const { return (int)m_ops.size(); }
+	// ȡϲ֮
+	int GetFusedCount() const { return m_fused_count; }
+	// ȡڴصĴС(ֽ)мڴ桢ʱڴ
+	int GetMemory() const { return (int)(m_memory_size * sizeof(cr_real)); }
+	// ȡ֮ȨشС(ֽ)
+	int GetQuantizedMemory() const
+	{
+		int memory = (int)m_quant_buffer.size();
+		for (const auto& weight : m_quant_weights) memory += weight.GetMemory();
+		return memory;
+	}
+
+private:
+	// ľ˷Ȩǲڵ
+	struct CarpRobotInferencePair
+	{
+		int w = -1;					// Ȩxsе±
+		int x = -1;					// xsе±
+		cr_real range = 0;			// У׼õֵֵ0ʾÿμʱͳ
+		int weight = -1;			// ֮Ȩأ-1ʾû
+	};
+
+	struct CarpRobotInferenceOp
+	{
+		int type = OP_NODE;
+		int act = ACT_NONE;
+		int index = -1;						// ڵ㣬LSTMϸ״̬
+		int index_h = -1;					// LSTM״̬ûкϲʱ-1
+		std::vector<int> inputs;			// ڵ
+		std::vector<const CarpRobotTensor*> xs;	// ڵֵ
+		cr_real bias = 0;					// LSTMŵƫ
+		std::vector<CarpRobotInferencePair> pairs;	// ľ˷
+	};
+
+	struct ScalarSigmoidOp
+	{
+		inline cr_real operator() (cr_real x) const { return 1.0f / (1.0f + std::exp(-x)); }
+	};
+
+	// ִм㷽ʽͶӦĽڵ㱣һ£xfxͬһڴ
+	static void Activate(int act, const CarpRobotTensor& x, CarpRobotTensor& fx)
+	{
+		if (act == ACT_SOFTMAX) Softmax(x, fx);
+		else if (act == ACT_RECTIFY) fx.tvec() = x.tvec().cwiseMax(0.f);
+		else if (CarpRobotSimd::IsApproximate() && act == ACT_TANH) CarpRobotSimd::Tanh(x.GetValue(), fx.GetValue(), fx.GetDim().GetTotalSize());
+		else if (CarpRobotSimd::IsApproximate() && act == ACT_SIGMOID) CarpRobotSimd::Sigmoid(x.GetValue(), fx.GetValue(), fx.GetDim().GetTotalSize());
+		else if (act == ACT_TANH) fx.tvec() = x.tvec().tanh();
+		else if (act == ACT_SIGMOID) fx.tvec() = x.tvec().unaryExpr(ScalarSigmoidOp());
+	}
+
+	// ÿεÿһе㣬Ҫʱڴ
+	static void Softmax(const CarpRobotTensor& x, CarpRobotTensor& fx)
+	{
+		const int size = x.GetDim()[0];
+		const int num_cols = x.GetDim()[1] * x.GetDim().GetBatch();
+		if (CarpRobotSimd::IsApproximate())
+		{
+			for (int col = 0; col < num_cols; ++col)
+				CarpRobotSimd::Softmax(x.GetValue() + (size_t)col * size, fx.GetValue() + (size_t)col * size, size);
+			return;
+		}
+
+		Eigen::Map<const Eigen::ArrayXXf> in(x.GetValue(), size, num_cols);
+		Eigen::Map<Eigen::ArrayXXf> out(fx.GetValue(), size, num_cols);
+		for (int col = 0; col < num_cols; ++col)
+		{
+			// ȥֵֹ
+			out.col(col) = (in.col(col) - in.col(col).maxCoeff()).exp();
+			out.col(col) /= out.col(col).sum();
+		}
+	}
+
+	// ƫõ1ʱ򣬼ӵÿ
+	static void AddBias(const CarpRobotTensor& b, CarpRobotTensor& fx)
+	{
+		if (b.GetDim().GetTotalSize() == fx.GetDim().GetTotalSize())
+			fx.vec() += b.vec();
+		else
+			Eigen::Map<Eigen::MatrixXf>(fx.GetValue(), fx.GetDim().GetBatchSize(), fx.GetDim().GetBatch()).colwise() += b.vec();
+	}
+
+	void Execute(CarpRobotInferenceOp& op)
+	{
+		CarpRobotTensor& fx = m_values[op.index];
+		if (m_quantized && !op.pairs.empty())
+		{
+			ExecuteInt8(op, fx);
+		}
+		else if (op.type == OP_NODE)
+		{
+			auto* node = m_graph->GetNode(op.index);
+			node->SetMemory(m_aux, m_scratch);
+			node->SetDevice(nullptr);
+			node->Forward(op.xs, fx);
+		}
+		else if (op.type == OP_ALIAS)
+		{
+			fx.RefrenceMemory(fx.GetDim(), op.xs[0]->GetValue());
+		}
+		else if (op.type == OP_MATMUL_BIAS)
+		{
+			const CarpRobotTensor& w = *op.xs[0];
+			const CarpRobotTensor& x = *op.xs[1];
+			const CarpRobotTensor& b = *op.xs[2];
+			Eigen::Map<Eigen::MatrixXf> out(fx.GetValue(), w.GetDim().Rows(), x.GetDim().Cols() * x.GetDim().GetBatch());
+			out.noalias() = w.m() * x.mb();
+			AddBias(b, fx);
+			Activate(op.act, fx, fx);
+		}
+		else if (op.type == OP_AFFINE)
+		{
+			Affine(op, fx);
+		}
+		else if (op.type == OP_ACTIVATE)
+		{
+			Activate(op.act, *op.xs[0], fx);
+		}
+		else if (op.type == OP_LSTM)
+		{
+			// [i, f, o, g]ĶΣÿһ
+			const int hidden = fx.GetDim().GetBatchSize();
+			const int bd = fx.GetDim().GetBatch();
+			Eigen::Map<const Eigen::ArrayXXf> a(op.xs[0]->GetValue(), hidden * 4, bd);
+			Eigen::Map<Eigen::ArrayXXf> c(fx.GetValue(), hidden, bd);
+			if (op.xs.size() > 1)
+			{
+				Eigen::Map<const Eigen::ArrayXXf> c_prev(op.xs[1]->GetValue(), hidden, bd);
+				c = (a.middleRows(hidden, hidden) + op.bias).unaryExpr(ScalarSigmoidOp()) * c_prev
+					+ a.topRows(hidden).unaryExpr(ScalarSigmoidOp()) * a.bottomRows(hidden).tanh();
+			}
+			else
+			{
+				c = a.topRows(hidden).unaryExpr(ScalarSigmoidOp()) * a.bottomRows(hidden).tanh();
+			}
+
+			if (op.index_h >= 0)
+			{
+				Eigen::Map<Eigen::ArrayXXf> h(m_values[op.index_h].GetValue(), hidden, bd);
+				h = a.middleRows(hidden * 2, hidden).unaryExpr(ScalarSigmoidOp()) * c.tanh();
+			}
+		}
+	}
+
+	// 룬Ȼ out = W * x  out += W * x
+	void MultiplyInt8(const CarpRobotInferencePair& pair, const CarpRobotTensor& x, cr_real* out, bool add)
+	{
+		const auto& weight = m_quant_weights[pair.weight];
+		const int rows = x.GetDim().Rows();
+		const int cols = x.GetDim().Cols() * x.GetDim().GetBatch();
+		const cr_real scale = GetInputScale(pair, x);
+		int8_t* buffer = m_quant_buffer.data();
+		// 벹Ĳֲ0ȨضӦλ0
+		for (int c = 0; c < cols; ++c)
+			CarpRobotQuantizeInt8(x.GetValue() + (size_t)c * rows, rows, scale, buffer + (size_t)c * weight.GetStride());
+		weight.Gemm(buffer, cols, scale, out, add);
+	}
+
+	cr_real GetInputScale(const CarpRobotInferencePair& pair, const CarpRobotTensor& x) const
+	{
+		cr_real range = pair.range > 0 ? pair.range : CarpRobotAbsMax(x.GetValue(), x.GetDim().GetTotalSize());
+		return range / CARP_ROBOT_INT8_MAX;
+	}
+
+	void ExecuteInt8(CarpRobotInferenceOp& op, CarpRobotTensor& fx)
+	{
+		if (op.type == OP_MATMUL_BIAS)
+		{
+			MultiplyInt8(op.pairs[0], *op.xs[1], fx.GetValue(), false);
+			AddBias(*op.xs[2], fx);
+			Activate(op.act, fx, fx);
+			return;
+		}
+
+		if (op.type == OP_AFFINE)
+		{
+			Affine(op, fx);
+			return;
+		}
+
+		auto* node = m_graph->GetNode(op.type == OP_AFFINE ? op.inputs[0] : op.index);
+		auto* conv = dynamic_cast<CarpRobotConv2DNode*>(node);
+		if (conv)
+		{
+			// ά x:{H, W, C} :{KH, KW, C, Co} :{OH, OW, Co}N
+			const auto& pair = op.pairs[0];
+			const CarpRobotTensor& x = *op.xs[0];
+			const CarpRobotDim& x_dim = x.GetDim();
+			const CarpRobotDim& k_dim = op.xs[1]->GetDim();
+			const CarpRobotDim& y_dim = fx.GetDim();
+			int pad_top = 0, pad_left = 0;
+			if (!conv->GetPaddingType())
+			{
+				// EigenSAMEһ
+				pad_top = std::max(0, ((y_dim[0] - 1) * conv->GetStride(0) + k_dim[0] - x_dim[0]) / 2);
+				pad_left = std::max(0, ((y_dim[1] - 1) * conv->GetStride(1) + k_dim[1] - x_dim[1]) / 2);
+			}
+			const cr_real scale = GetInputScale(pair, x);
+			int8_t* buffer = m_quant_buffer.data();
+			CarpRobotQuantizeInt8(x.GetValue(), x_dim.GetTotalSize(), scale, buffer);
+			m_quant_weights[pair.weight].Conv2D(buffer, scale, x_dim[0], x_dim[1], x_dim[2], x_dim.GetBatch()
+				, k_dim[0], k_dim[1], conv->GetStride(0), conv->GetStride(1), pad_top, pad_left
+				, y_dim[0], y_dim[1], buffer + CarpRobotInt8Align(x_dim.GetTotalSize()), fx.GetValue());
+			if (op.xs.size() == 3)
+			{
+				const int area = y_dim[0] * y_dim[1];
+				for (int n = 0; n < y_dim.GetBatch(); ++n)
+					for (int co = 0; co < y_dim[2]; ++co)
+						Eigen::Map<Eigen::ArrayXf>(fx.GetValue() + ((size_t)n * y_dim[2] + co) * area, area) += op.xs[2]->GetValue()[co];
+			}
+			return;
+		}
+
+		// ʣµֻвΪȨصľ˷
+		MultiplyInt8(op.pairs[0], *op.xs[1], fx.GetValue(), false);
+	}
+
+	// AffineTransformȰƫɢекΣȻۼÿһԾ˷ľ˷int8
+	void Affine(CarpRobotInferenceOp& op, CarpRobotTensor& fx)
+	{
+		const CarpRobotTensor& b = *op.xs[0];
+		const size_t b_size = b.GetDim().GetTotalSize(), fx_size = fx.GetDim().GetTotalSize();
+		for (size_t offset = 0; offset < fx_size; offset += b_size)
+			memcpy(fx.GetValue() + offset, b.GetValue(), sizeof(cr_real) * b_size);
+		size_t next = 0;
+		for (int k = 1; k < (int)op.xs.size(); k += 2)
+		{
+			if (m_quantized && next < op.pairs.size() && op.pairs[next].w == k)
+			{
+				MultiplyInt8(op.pairs[next++], *op.xs[k + 1], fx.GetValue(), true);
+				continue;
+			}
+
+			const CarpRobotTensor& w = *op.xs[k];
+			const CarpRobotTensor& x = *op.xs[k + 1];
+			if (w.GetDim().GetBatch() == 1 && x.GetDim().GetBatch() == fx.GetDim().GetBatch())
+			{
+				fx.mb().noalias() += w.m() * x.mb();
+			}
+			else
+			{
+				for (int n = 0; n < fx.GetDim().GetBatch(); ++n)
+					fx.m(n).noalias() += w.m(n) * x.m(n);
+			}
+		}
+		Activate(op.act, fx, fx);
+	}
+
+	// xsеkӦĽڵ
+	int GetInputNode(const CarpRobotInferenceOp& op, int k) const { return m_root[op.inputs[op.type == OP_AFFINE ? k + 1 : k]]; }
+
+	// ҳȨǲľ˷;
+	void FindPairs(CarpRobotInferenceOp& op) const
+	{
+		auto IsWeight = [&](int k)
+		{
+			auto* node = m_graph->GetNode(GetInputNode(op, k));
+			return IsParameter(node) && node->GetDim().GetBatch() == 1;
+		};
+
+		CarpRobotInferencePair pair;
+		if (op.type == OP_MATMUL_BIAS)
+		{
+			pair.w = 0; pair.x = 1;
+			if (IsWeight(0)) op.pairs.push_back(pair);
+			return;
+		}
+
+		if (op.type != OP_NODE && op.type != OP_AFFINE) return;
+		auto* node = m_graph->GetNode(op.type == OP_AFFINE ? op.inputs[0] : op.index);
+		if (dynamic_cast<CarpRobotConv2DNode*>(node))
+		{
+			pair.w = 1; pair.x = 0;
+			if (IsWeight(1)) op.pairs.push_back(pair);
+		}
+		else if (dynamic_cast<CarpRobotMatrixMultiplyNode*>(node))
+		{
+			pair.w = 0; pair.x = 1;
+			if (IsWeight(0)) op.pairs.push_back(pair);
+		}
+		else if (dynamic_cast<CarpRobotAffineTransformNode*>(node) && op.xs.size() > 1)
+		{
+			// κһʱο԰ƴһ
+			for (int k = 1; k + 1 < (int)op.xs.size(); k += 2)
+			{
+				pair.w = k; pair.x = k + 1;
+				if (IsWeight(k) && node->GetDim().GetBatch() == m_graph->GetNode(GetInputNode(op, k + 1))->GetDim().GetBatch())
+					op.pairs.push_back(pair);
+			}
+		}
+	}
+
+private:
+	template <typename T>
+	T* As(int i) const { return dynamic_cast<T*>(m_graph->GetNode(i)); }
+
+	// k뾭֮Ľڵ
+	int Arg(int i, int k) const { return m_root[m_graph->GetNode(i)->GetArgs()[k]]; }
+
+	static bool IsParameter(CarpRobotNode* node)
+	{
+		return dynamic_cast<ICarpRobotParameterNode*>(node) || dynamic_cast<CarpRobotConstParameterNode*>(node);
+	}
+
+	static bool SameSize(const CarpRobotDim& a, const CarpRobotDim& b)
+	{
+		return a.GetBatchSize() == b.GetBatchSize() && a.GetBatch() == b.GetBatch();
+	}
+
+	// ѲҪĽڵӳ䵽һڵ
+	void FindAlias()
+	{
+		const int num_nodes = (int)m_root.size();
+		m_mask.assign(num_nodes, false);
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			m_root[i] = i;
+			auto* node = m_graph->GetNode(i);
+			if (dynamic_cast<CarpRobotDropoutNode*>(node))
+			{
+				// ʱdropout
+				m_root[i] = Arg(i, 0);
+			}
+			else if (dynamic_cast<CarpRobotRandomBernoulliNode*>(node))
+			{
+				m_mask[i] = true;
+			}
+			else if (dynamic_cast<CarpRobotCwiseMultiplyNode*>(node))
+			{
+				// ֵ1
+				for (int k = 0; k < 2; ++k)
+				{
+					int mask = Arg(i, k), other = Arg(i, 1 - k);
+					if (!m_mask[mask] || std::abs(As<CarpRobotRandomBernoulliNode>(mask)->GetExpectation() - 1.0f) > 1e-6f) continue;
+					if (!SameSize(node->GetDim(), m_graph->GetNode(other)->GetDim())) continue;
+					m_root[i] = other;
+					break;
+				}
+			}
+		}
+	}
+
+	// ڵرҪĽڵ㣬ͳÿڵ㱻ʹõĴ
+	void MarkLive()
+	{
+		const int num_nodes = (int)m_root.size();
+		for (int i = 0; i < num_nodes; ++i)
+			if (m_is_output[i]) m_live[i] = true;
+
+		for (int i = num_nodes - 1; i >= 0; --i)
+		{
+			if (!m_live[i]) continue;
+			if (m_root[i] != i)
+			{
+				m_live[m_root[i]] = true;
+				continue;
+			}
+			for (auto arg : m_graph->GetNode(i)->GetArgs())
+				m_live[arg] = true;
+		}
+
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (m_is_output[i]) m_pinned[m_root[i]] = true;
+			if (!m_live[i] || m_root[i] != i) continue;
+			const auto& args = m_graph->GetNode(i)->GetArgs();
+			for (size_t k = 0; k < args.size(); ++k)
+			{
+				int arg = m_root[args[k]];
+				++m_use_count[arg];
+				m_consumers[arg].push_back(i);
+			}
+		}
+	}
+
+	// ǷԺϲ棬ֻʹһΣⲿҪֵ
+	bool IsInternal(int i) const
+	{
+		return m_live[i] && m_root[i] == i && m_use_count[i] == 1 && !m_pinned[i] && !m_claimed[i];
+	}
+
+	int GetAct(int i) const
+	{
+		auto* node = m_graph->GetNode(i);
+		if (dynamic_cast<CarpRobotRectifyNode*>(node)) return ACT_RECTIFY;
+		if (dynamic_cast<CarpRobotTanhNode*>(node)) return ACT_TANH;
+		if (dynamic_cast<CarpRobotLogisticSigmoidNode*>(node)) return ACT_SIGMOID;
+		if (dynamic_cast<CarpRobotSoftmaxNode*>(node)) return ACT_SOFTMAX;
+		return ACT_NONE;
+	}
+
+	struct CarpRobotInferenceGate
+	{
+		int input = -1;		// ĸƴһĽڵ
+		int start = 0;		// еʼλ
+		int end = 0;
+		cr_real bias = 0;	// ֮ǰϵĳ
+	};
+
+	// ƥ act(PickRange(x))  act(PickRange(x) + c)
+	bool MatchGate(int i, int act, bool allow_bias, CarpRobotInferenceGate& gate, std::vector<int>& nodes) const
+	{
+		if (!IsInternal(i) || GetAct(i) != act) return false;
+		std::vector<int> matched(1, i);
+
+		int x = Arg(i, 0);
+		gate.bias = 0;
+		auto* plus = As<CarpRobotConstantPlusXNode>(x);
+		if (plus)
+		{
+			if (!allow_bias || !IsInternal(x)) return false;
+			gate.bias = plus->GetConstant();
+			matched.push_back(x);
+			x = Arg(x, 0);
+		}
+
+		auto* range = As<CarpRobotPickRangeNode>(x);
+		if (range == nullptr || !IsInternal(x) || range->GetAxis() != 0) return false;
+		matched.push_back(x);
+
+		gate.input = Arg(x, 0);
+		gate.start = range->GetStart();
+		gate.end = range->GetEnd();
+		nodes.insert(nodes.end(), matched.begin(), matched.end());
+		return true;
+	}
+
+	// ƥ CwiseMultiply(sigmoid, tanh)
+	bool MatchInputGate(int i, CarpRobotInferenceGate& it, CarpRobotInferenceGate& gt, std::vector<int>& nodes) const
+	{
+		if (As<CarpRobotCwiseMultiplyNode>(i) == nullptr) return false;
+		for (int k = 0; k < 2; ++k)
+		{
+			std::vector<int> matched;
+			if (MatchGate(Arg(i, k), ACT_SIGMOID, false, it, matched) && MatchGate(Arg(i, 1 - k), ACT_TANH, false, gt, matched))
+			{
+				nodes.insert(nodes.end(), matched.begin(), matched.end());
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// ƥ CwiseMultiply(sigmoid, һϸ״̬)
+	bool MatchForgetGate(int i, CarpRobotInferenceGate& ft, int& c_prev, std::vector<int>& nodes) const
+	{
+		if (As<CarpRobotCwiseMultiplyNode>(i) == nullptr || !IsInternal(i)) return false;
+		for (int k = 0; k < 2; ++k)
+		{
+			std::vector<int> matched;
+			if (MatchGate(Arg(i, k), ACT_SIGMOID, true, ft, matched))
+			{
+				c_prev = Arg(i, 1 - k);
+				matched.push_back(i);
+				nodes.insert(nodes.end(), matched.begin(), matched.end());
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// ƥLSTMϸ״̬ c = ft * c_prev + it * gt  c = it * gtԼ״̬ h = ot * tanh(c)
+	bool MatchLstm(int c, CarpRobotInferenceOp& op, std::vector<int>& nodes) const
+	{
+		if (!m_live[c] || m_root[c] != c || m_claimed[c]) return false;
+
+		CarpRobotInferenceGate it, ft, gt, ot;
+		int c_prev = -1;
+		std::vector<int> matched;
+		if (As<CarpRobotCwiseSumNode>(c))
+		{
+			bool success = false;
+			for (int k = 0; k < 2 && !success; ++k)
+			{
+				matched.clear();
+				int a = Arg(c, k), b = Arg(c, 1 - k);
+				success = MatchForgetGate(a, ft, c_prev, matched) && IsInternal(b) && MatchInputGate(b, it, gt, matched);
+				if (success) matched.push_back(b);
+			}
+			if (!success) return false;
+		}
+		else if (!MatchInputGate(c, it, gt, matched))
+		{
+			return false;
+		}
+
+		// ĸͬһڵ㣬Ұ[i, f, o, g]
+		const CarpRobotDim& dim = m_graph->GetNode(c)->GetDim();
+		const int hidden = dim.GetBatchSize();
+		const CarpRobotDim& input_dim = m_graph->GetNode(it.input)->GetDim();
+		if (input_dim.Cols() != 1 || input_dim.Rows() != hidden * 4 || input_dim.GetBatch() != dim.GetBatch()) return false;
+		if (it.start != 0 || it.end != hidden || gt.input != it.input || gt.start != hidden * 3 || gt.end != hidden * 4) return false;
+		if (c_prev >= 0)
+		{
+			if (ft.input != it.input || ft.start != hidden || ft.end != hidden * 2) return false;
+			if (!SameSize(m_graph->GetNode(c_prev)->GetDim(), dim)) return false;
+		}
+
+		op.type = OP_LSTM;
+		op.index = c;
+		op.index_h = -1;
+		op.inputs.assign(1, it.input);
+		if (c_prev >= 0) op.inputs.push_back(c_prev);
+		op.bias = ft.bias;
+		matched.push_back(c);
+
+		// ϸ״ֻ̬ h = ot * tanh(c) ֮ʹãô״̬Ҳϲ
+		for (auto tanh : m_consumers[c])
+		{
+			if (!IsInternal(tanh) || GetAct(tanh) != ACT_TANH || m_consumers[tanh].size() != 1) continue;
+			int h = m_consumers[tanh][0];
+			if (!m_live[h] || m_claimed[h] || As<CarpRobotCwiseMultiplyNode>(h) == nullptr) continue;
+
+			std::vector<int> h_matched;
+			bool success = false;
+			for (int k = 0; k < 2 && !success; ++k)
+				success = Arg(h, 1 - k) == tanh && MatchGate(Arg(h, k), ACT_SIGMOID, false, ot, h_matched);
+			if (!success || ot.input != it.input || ot.start != hidden * 2 || ot.end != hidden * 3) break;
+
+			bool before = false;
+			for (auto consumer : m_consumers[c])
+				if (consumer != tanh && consumer < h) before = true;
+			if (before) break;
+
+			op.index_h = h;
+			matched.push_back(tanh);
+			matched.insert(matched.end(), h_matched.begin(), h_matched.end());
+			matched.push_back(h);
+			break;
+		}
+
+		nodes.insert(nodes.end(), matched.begin(), matched.end());
+		return true;
+	}
+
+	// ƥ W * x + bƫҪôһҪôֻһ
+	bool MatchMatmulBias(int s, CarpRobotInferenceOp& op, std::vector<int>& nodes) const
+	{
+		if (As<CarpRobotCwiseSumNode>(s) == nullptr) return false;
+		const CarpRobotDim& dim = m_graph->GetNode(s)->GetDim();
+		for (int k = 0; k < 2; ++k)
+		{
+			int m = Arg(s, k), b = Arg(s, 1 - k);
+			if (As<CarpRobotMatrixMultiplyNode>(m) == nullptr || !IsInternal(m)) continue;
+			if (!SameSize(m_graph->GetNode(m)->GetDim(), dim)) continue;
+			int w = Arg(m, 0), x = Arg(m, 1);
+			if (m_graph->GetNode(w)->GetDim().GetBatch() != 1) continue;
+			const CarpRobotDim& b_dim = m_graph->GetNode(b)->GetDim();
+			if (!SameSize(b_dim, dim) && (b_dim.GetBatch() != 1 || b_dim.GetBatchSize() != dim.GetBatchSize())) continue;
+
+			op.type = OP_MATMUL_BIAS;
+			op.inputs = { w, x, b };
+			nodes.push_back(m);
+			return true;
+		}
+		return false;
+	}
+
+	// ƥԺϲĽڵ㣬ϲĽڵΪclaimed
+	void FusePatterns()
+	{
+		const int num_nodes = (int)m_root.size();
+		m_anchor.assign(num_nodes, -1);
+		m_fused_output.assign(num_nodes, false);
+
+		// LSTMźϸ״̬Ӻǰƥ䣬 it * gt ȱƥ
+		for (int i = num_nodes - 1; i >= 0; --i)
+		{
+			CarpRobotInferenceOp op;
+			std::vector<int> nodes;
+			if (!MatchLstm(i, op, nodes)) continue;
+			AddPending(op.index_h >= 0 ? op.index_h : op.index, op, nodes);
+		}
+
+		// ϲǰһ
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (!m_live[i] || m_root[i] != i || m_claimed[i]) continue;
+			int act = GetAct(i);
+			if (act == ACT_NONE) continue;
+			int s = Arg(i, 0);
+			if (!IsInternal(s)) continue;
+
+			CarpRobotInferenceOp op;
+			std::vector<int> nodes;
+			auto* affine = As<CarpRobotAffineTransformNode>(s);
+			if (affine && affine->GetArgs().size() > 1)
+			{
+				op.type = OP_AFFINE;
+				op.inputs.assign(1, s);
+				for (auto arg : affine->GetArgs()) op.inputs.push_back(m_root[arg]);
+			}
+			else if (!MatchMatmulBias(s, op, nodes))
+			{
+				continue;
+			}
+			op.act = act;
+			op.index = i;
+			nodes.push_back(s);
+			nodes.push_back(i);
+			AddPending(i, op, nodes);
+		}
+
+		// ûм W * x + b
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (!m_live[i] || m_root[i] != i || m_claimed[i]) continue;
+			CarpRobotInferenceOp op;
+			std::vector<int> nodes;
+			if (!MatchMatmulBias(i, op, nodes)) continue;
+			op.index = i;
+			nodes.push_back(i);
+			AddPending(i, op, nodes);
+		}
+	}
+
+	void AddPending(int anchor, const CarpRobotInferenceOp& op, const std::vector<int>& nodes)
+	{
+		for (auto node : nodes) m_claimed[node] = true;
+		m_fused_output[op.index] = true;
+		if (op.index_h >= 0) m_fused_output[op.index_h] = true;
+		m_anchor[anchor] = (int)m_pending.size();
+		m_pending.push_back(op);
+		++m_fused_count;
+	}
+
+	// ڵ˳бڵֱӼһ
+	void BuildOps()
+	{
+		const int num_nodes = (int)m_root.size();
+		std::vector<const CarpRobotTensor*> empty;
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			m_values[i].RefrenceMemory(m_graph->GetNode(i)->GetDim(), nullptr);
+			if (!m_live[i]) continue;
+
+			if (m_anchor[i] >= 0)
+			{
+				m_ops.push_back(m_pending[m_anchor[i]]);
+				auto& op = m_ops.back();
+				// AffineTransformһǽڵԼֻҵڵ
+				for (size_t k = (op.type == OP_AFFINE ? 1 : 0); k < op.inputs.size(); ++k)
+					op.xs.push_back(&m_values[op.inputs[k]]);
+				FindPairs(op);
+				continue;
+			}
+			if (m_claimed[i]) continue;
+
+			auto* node = m_graph->GetNode(i);
+			if (m_root[i] != i)
+			{
+				// ϲмڵûֵڵͨʹ
+				int root = m_root[i];
+				if (m_claimed[root] && !m_fused_output[root]) continue;
+				// ֻڵÿζⲿڴ棬ڵڴڹ滮֮͹̶
+				auto* root_node = m_graph->GetNode(root);
+				if (!root_node->IsRefrenceMemory() || IsParameter(root_node))
+				{
+					m_static_alias.push_back(i);
+					continue;
+				}
+				CarpRobotInferenceOp op;
+				op.type = OP_ALIAS;
+				op.index = i;
+				op.inputs.assign(1, m_root[i]);
+				op.xs.push_back(&m_values[m_root[i]]);
+				m_ops.push_back(op);
+			}
+			else if (m_mask[i])
+			{
+				// ֵڹ滮ڴ֮
+				m_pinned[i] = true;
+			}
+			else if (IsParameter(node))
+			{
+				node->Forward(empty, m_values[i]);
+			}
+			else
+			{
+				// õĽڵֱӼ㣬ڵִForward
+				CarpRobotInferenceOp op;
+				op.type = OP_NODE;
+				op.index = i;
+				op.inputs = node->GetArgs();
+				if (GetAct(i) != ACT_NONE)
+				{
+					op.type = OP_ACTIVATE;
+					op.act = GetAct(i);
+				}
+				else if (dynamic_cast<CarpRobotAffineTransformNode*>(node) && op.inputs.size() > 1)
+				{
+					op.type = OP_AFFINE;
+					op.inputs.insert(op.inputs.begin(), i);
+				}
+				for (size_t k = (op.type == OP_AFFINE ? 1 : 0); k < op.inputs.size(); ++k)
+					op.xs.push_back(&m_values[op.inputs[k]]);
+				FindPairs(op);
+				m_ops.push_back(op);
+			}
+		}
+	}
+
+	// ÿڵʹõӣȻ˳ڴй滮
+	void PlanMemory()
+	{
+		const int num_nodes = (int)m_root.size();
+		const int num_ops = (int)m_ops.size();
+
+		std::vector<int> last(num_nodes, -1);
+		for (int k = 0; k < num_ops; ++k)
+		{
+			const auto& op = m_ops[k];
+			last[op.index] = k;
+			if (op.index_h >= 0) last[op.index_h] = k;
+			for (size_t j = (op.type == OP_AFFINE ? 1 : 0); j < op.inputs.size(); ++j)
+				last[m_root[op.inputs[j]]] = k;
+		}
+
+		size_t aux_size = 0, scratch_size = 0;
+		std::vector<size_t> offset(num_nodes, 0);
+		std::vector<bool> has_slot(num_nodes, false);
+		m_arena.ResetPlan();
+
+		// һֱ
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (!m_mask[i] || !m_pinned[i] || !m_live[i]) continue;
+			offset[i] = m_arena.PlanAlloc(m_graph->GetNode(i)->GetDim().GetTotalSize());
+			has_slot[i] = true;
+		}
+
+		for (int k = 0; k < num_ops; ++k)
+		{
+			const auto& op = m_ops[k];
+			int outputs[2] = { op.index, op.index_h };
+			for (auto output : outputs)
+			{
+				if (output < 0 || op.type == OP_ALIAS) continue;
+				auto* node = m_graph->GetNode(output);
+				if (node->IsRefrenceMemory()) continue;
+				offset[output] = m_arena.PlanAlloc(node->GetDim().GetTotalSize());
+				has_slot[output] = true;
+			}
+
+			if (op.type == OP_NODE)
+			{
+				auto* node = m_graph->GetNode(op.index);
+				aux_size = std::max(aux_size, (size_t)node->GetAuxSize());
+				scratch_size = std::max(scratch_size, (size_t)node->GetScratchSize());
+			}
+
+			// һʹ֮黹
+			for (int i : { op.index, op.index_h })
+				if (i >= 0 && last[i] == k && has_slot[i] && !m_pinned[i]) { m_arena.PlanFree(offset[i], m_graph->GetNode(i)->GetDim().GetTotalSize()); has_slot[i] = false; }
+			for (size_t j = 0; j < op.inputs.size(); ++j)
+			{
+				int i = m_root[op.inputs[j]];
+				if (last[i] == k && has_slot[i] && !m_pinned[i])
+				{
+					m_arena.PlanFree(offset[i], m_graph->GetNode(i)->GetDim().GetTotalSize());
+					has_slot[i] = false;
+				}
+			}
+		}
+
+		// ڴʱڴǰ棬ӹ
+		size_t base = CarpRobotArena::Align(aux_size) + CarpRobotArena::Align(scratch_size);
+		m_memory_size = base + m_arena.GetPlanSize();
+		m_arena.Reserve(m_memory_size, false);
+		cr_real* memory = m_arena.GetMemory();
+		m_aux = aux_size > 0 ? memory : nullptr;
+		m_scratch = scratch_size > 0 ? memory + CarpRobotArena::Align(aux_size) : nullptr;
+
+		for (int i = 0; i < num_nodes; ++i)
+		{
+			if (!m_live[i] || m_root[i] != i) continue;
+			auto* node = m_graph->GetNode(i);
+			if (node->IsRefrenceMemory()) continue;
+			m_values[i].RefrenceMemory(node->GetDim(), memory + base + offset[i]);
+			if (m_mask[i]) m_values[i].Constant(As<CarpRobotRandomBernoulliNode>(i)->GetExpectation());
+		}
+		for (auto i : m_static_alias)
+			m_values[i].RefrenceMemory(m_values[i].GetDim(), m_values[m_root[i]].GetValue());
+	}
+
+private:
+	CarpRobotComputationGraph* m_graph = nullptr;
+
+	std::vector<CarpRobotInferenceOp> m_ops;		// ִеб
+	std::vector<CarpRobotInferenceOp> m_pending;	// ϲӣбʱŵêڵλ
+	std::vector<int> m_anchor;						// ڵӦĺϲӣ-1ʾû
+
+	std::vector<CarpRobotTensor> m_values;			// ÿڵֵϲĽڵûֵ
+	std::vector<int> m_root;						// ڵֵʵĸڵ
+	std::vector<bool> m_live;						// ҪõĽڵ
+	std::vector<bool> m_pinned;						// ڴһֱĽڵ
+	std::vector<bool> m_claimed;					// ѾϲĽڵ
+	std::vector<bool> m_fused_output;				// ϲӵڵ
+	std::vector<bool> m_mask;						// ڵ
+	std::vector<int> m_use_count;					// ڵ㱻ʹõĴ
+	std::vector<std::vector<int>> m_consumers;		// ʹýڵڵ
+	std::vector<bool> m_is_output;					// ʱָڵ
+	std::vector<int> m_static_alias;				// ʱͿȷڴıڵ
+
+	int m_fused_count = 0;
+	size_t m_memory_size = 0;
+
+	CarpRobotArena m_arena;							// мڴ
+	cr_real* m_aux = nullptr;						// ӹõĸڴ
+	cr_real* m_scratch = nullptr;					// ӹõʱڴ
+
+	bool m_quantized = false;						// Ƿʹint8
+	std::vector<CarpRobotQuantizedMatrix> m_quant_weights;	// ֮Ȩ
+	std::vector<int8_t> m_quant_buffer;				// ֮
+};
+
+/* eg. ѵõĲ磬֮ÿֻҪٵForward
+	CarpRobotParameterCollection model;
+	CarpRobotLinear l1(&model, 32, 128);
+	CarpRobotLinear l2(&model, 128, 128);
+	CarpRobotLinear l3(&model, 128, 8);
+	model.Load("policy.model");
+	std::vector<cr_real> state(32);
+	CarpRobotComputationGraph graph;
+	l1.Build(&graph);
+	l2.Build(&graph);
+	l3.Build(&graph);
+	auto x = graph.AddInput(CarpRobotDim({ 32 }), &state);
+	auto y = l3.Forward(l2.Forward(l1.Forward(x).Rectify()).Rectify()).Softmax();
+	CarpRobotInference inference;
+	inference.Compile(&graph, { y.GetIndex() });
+	while (true)
+	{
+		// state
+		inference.Forward();
+		int action = inference.AsVectorAndArgmax(y.GetIndex());
+	}
+*/
+
+/* eg. int8͸ԱȾȺٶȣcalibrationдԵsamplesԵ
+	CarpRobotInference fp32, int8;
+	fp32.Compile(&graph, { y.GetIndex() });
+	int8.Compile(&graph, { y.GetIndex() });
+	for (auto& sample : calibration)
+	{
+		state = sample;
+		int8.Calibrate();
+	}
+	int8.Quantize();
+	printf("int8 weights:%d\n", int8.GetQuantizedMemory());
+
+	int same = 0;
+	cr_real max_error = 0;
+	double fp32_time = 0, int8_time = 0;
+	for (auto& sample : samples)
+	{
+		state = sample;
+		auto t0 = std::chrono::steady_clock::now();
+		fp32.Forward();
+		auto t1 = std::chrono::steady_clock::now();
+		int8.Forward();
+		auto t2 = std::chrono::steady_clock::now();
+		fp32_time += std::chrono::duration<double>(t1 - t0).count();
+		int8_time += std::chrono::duration<double>(t2 - t1).count();
+		if (fp32.AsVectorAndArgmax(y.GetIndex()) == int8.AsVectorAndArgmax(y.GetIndex())) ++same;
+		const auto& a = fp32.GetValue(y.GetIndex()), & b = int8.GetValue(y.GetIndex());
+		max_error = std::max(max_error, (a.vec() - b.vec()).cwiseAbs().maxCoeff());
+	}
+	printf("argmax agreement:%f max error:%f fp32:%fus int8:%fus\n", (double)same / samples.size(), max_error
+		, fp32_time * 1e6 / samples.size(), int8_time * 1e6 / samples.size());
+*/
+
+#endif
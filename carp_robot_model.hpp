@@ -228,11 +228,11 @@ public:
 				float scale = 1 / retention_rate;
 				float scale_h = 1 / retention_rate_h;
 
-				// input
-				CarpRobotDim dim_input({ idim });
+				// inputÿθһ
+				CarpRobotDim dim_input({ idim }, m_batch_size);
 				masks_i.push_back(graph->RandomBernoulli(dim_input, retention_rate, scale));
 				// h
-				CarpRobotDim dim_h({ m_hidden_dim });
+				CarpRobotDim dim_h({ m_hidden_dim }, m_batch_size);
 				masks_i.push_back(graph->RandomBernoulli(dim_h, retention_rate_h, scale_h));
 				m_masks.push_back(masks_i);
 			}
@@ -242,6 +242,8 @@ public:
 public:
 	void SetDropoutRate(float rate) { m_dropout_rate = rate; }
 	void SetDropoutRateH(float rate) { m_dropout_rate_h = rate; }
+	// Build֮ǰãdropout밴
+	void SetBatchSize(int batch_size) { m_batch_size = batch_size > 0 ? batch_size : 1; }
 
 public:
 	int AddInputForLua(CarpRobotComputationGraph* graph, int input_index) { return AddInput(CarpRobotExpression(graph, input_index)).GetIndex(); }
@@ -375,6 +377,7 @@ private:
 	std::vector<std::vector<CarpRobotExpression>> m_masks;
 	float m_dropout_rate = 0.0f;
 	float m_dropout_rate_h = 0.0f;
+	int m_batch_size = 1;
 
 	CarpRobotParameterCollection* m_model = nullptr;
 	int m_num_lstm = 0;
@@ -397,6 +400,7 @@ public:
 public:
 	void SetDropoutRate(float rate) { m_l2r_lstm.SetDropoutRate(rate); m_r2l_lstm.SetDropoutRate(rate); }
 	void SetDropoutRateH(float rate) { m_l2r_lstm.SetDropoutRateH(rate); m_r2l_lstm.SetDropoutRateH(rate); }
+	void SetBatchSize(int batch_size) { m_l2r_lstm.SetBatchSize(batch_size); m_r2l_lstm.SetBatchSize(batch_size); }
 
 public:
 	void Build(CarpRobotComputationGraph* graph, bool update)
@@ -0,0 +1,280 @@
+#ifndef CARP_ROBOT_MODEL_FILE_INCLUDED
+#define CARP_ROBOT_MODEL_FILE_INCLUDED
+
+#include "carp_robot.hpp"
+#include "carp_file.hpp"
+
+#include <cstdio>
+
+// ֱڴӳģļṹ: ļͷ +  + 
+// ÿݰCARP_ROBOT_MODEL_FILE_ALIGN룬صʱֱӳڴ棬Ҫȡڴ
+// ̼ͬһģļʱҳ棬ֻһڴ
+// ļֽ͸ͱ棬һµʱʧ
+#define CARP_ROBOT_MODEL_FILE_VERSION 1
+#define CARP_ROBOT_MODEL_FILE_ALIGN 64
+
+// ļͷ
+struct CarpRobotModelFileHead
+{
+	char magic[4] = { 'C', 'R', 'M', 'F' };
+	unsigned int version = CARP_ROBOT_MODEL_FILE_VERSION;
+	unsigned int count = 0;								// 
+	unsigned int real_size = sizeof(cr_real);			// С
+	unsigned int byte_order = 0x01020304;				// ֽ
+	unsigned int reserved = 0;
+	unsigned long long index_checksum = 0;				// У
+	unsigned long long data_checksum = 0;				// У
+	unsigned long long data_offset = 0;					// ļеƫ
+	unsigned long long data_size = 0;					// С
+};
+
+// 
+struct CarpRobotModelFileIndex
+{
+	int nd = 0;											// ά
+	int d[CARP_ROBOT_MAX_DIM] = {};						// ÿάȵĴС
+	unsigned long long offset = 0;						// еƫ
+	unsigned long long count = 0;						// 
+};
+
+// Уͣ4ֽۼ(Fletcher)ÿUpdateĴС4ı
+class CarpRobotModelChecksum
+{
+public:
+	void Update(const void* data, size_t size)
+	{
+		const unsigned int* words = (const unsigned int*)data;
+		const size_t count = size / sizeof(unsigned int);
+		for (size_t i = 0; i < count; ++i)
+		{
+			m_a += words[i];
+			m_b += m_a;
+		}
+	}
+	unsigned long long Get() const { return m_a ^ ((m_b << 32) | (m_b >> 32)); }
+
+private:
+	unsigned long long m_a = 0;
+	unsigned long long m_b = 0;
+};
+
+class CarpRobotModelFile
+{
+public:
+	/**
+	 * ӳģļ˳ֱļڴ棬ֻѵ
+	 * ӳڴmodelУLoadmodelʱͷ
+	 * @param model: ռάȱļһ£һ»׳쳣
+	 * @param file_path: ģļ·
+	 * @param check_data: ǷУУҪļһ
+	 * @return ļڣʽԻУʧܷfalse
+	 */
+	static bool Load(CarpRobotParameterCollection* model, const char* file_path, bool check_data)
+	{
+		auto mapping = std::make_shared<CarpFileMapping>();
+		if (!mapping->Open(file_path)) return false;
+
+		const char* data = mapping->GetData();
+		const size_t size = mapping->GetSize();
+
+		// ļͷ
+		CarpRobotModelFileHead head;
+		if (size < sizeof(head)) return false;
+		memcpy(&head, data, sizeof(head));
+		const CarpRobotModelFileHead expect;
+		if (memcmp(head.magic, expect.magic, sizeof(head.magic)) != 0 || head.version != expect.version
+			|| head.real_size != expect.real_size || head.byte_order != expect.byte_order)
+			return false;
+
+		// ķΧ
+		const size_t index_size = (size_t)head.count * sizeof(CarpRobotModelFileIndex);
+		if (sizeof(head) + index_size > size || head.data_offset % CARP_ROBOT_MODEL_FILE_ALIGN != 0
+			|| head.data_offset < sizeof(head) + index_size || head.data_offset > size || head.data_size > size - head.data_offset)
+			return false;
+
+		// У
+		CarpRobotModelChecksum index_checksum;
+		index_checksum.Update(data + sizeof(head), index_size);
+		if (index_checksum.Get() != head.index_checksum) return false;
+		if (check_data)
+		{
+			CarpRobotModelChecksum data_checksum;
+			data_checksum.Update(data + head.data_offset, (size_t)head.data_size);
+			if (data_checksum.Get() != head.data_checksum) return false;
+		}
+
+		const auto& parameters = model->GetParameters();
+		CARP_ROBOT_ASSERT(head.count == parameters.size(), u8"һ, ǰ:" << head.count << "Ӧ:" << parameters.size());
+
+		std::vector<const cr_real*> values(parameters.size());
+		const CarpRobotModelFileIndex* index = (const CarpRobotModelFileIndex*)(data + sizeof(head));
+		for (size_t i = 0; i < parameters.size(); ++i)
+		{
+			const auto& info = index[i];
+			if (info.nd < 0 || info.nd > CARP_ROBOT_MAX_DIM || info.offset % CARP_ROBOT_MODEL_FILE_ALIGN != 0
+				|| info.offset > head.data_size || info.count > (head.data_size - info.offset) / sizeof(cr_real))
+				return false;
+
+			CarpRobotDim dim;
+			dim.Resize(info.nd);
+			for (int k = 0; k < info.nd; ++k) dim.Set(k, info.d[k]);
+			if ((unsigned long long)dim.GetTotalSize() != info.count) return false;
+			CARP_ROBOT_ASSERT(dim.Equal(parameters[i]->GetValue().GetDim()), u8"άȲһ, ǰ:" << dim.ToString() << "Ӧ:" << parameters[i]->GetValue().GetDim().ToString());
+
+			values[i] = (const cr_real*)(data + head.data_offset + info.offset);
+		}
+
+		model->RefrenceMemory(values, mapping);
+		return true;
+	}
+
+	// ѲΪģļ
+	static bool Save(CarpRobotParameterCollection* model, const char* file_path)
+	{
+		std::vector<CarpRobotDim> dims;
+		std::vector<const cr_real*> values;
+		for (auto* parameter : model->GetParameters())
+		{
+			dims.push_back(parameter->GetValue().GetDim());
+			values.push_back(parameter->GetValue().GetValue());
+		}
+		return Write(file_path, dims, values);
+	}
+
+	// CarpRobotParameterCollection::SaveľɸʽתΪģļҪ֪ģͽṹ
+	// ļ߸ʽʱ򷵻false
+	static bool Convert(const char* old_path, const char* new_path)
+	{
+		CarpRobotModelDeserializer file;
+		if (!file.Open(old_path)) return false;
+
+		std::vector<CarpRobotTensor> tensors;
+		try
+		{
+			while (!file.IsEnd())
+			{
+				file.ReadString();
+				tensors.emplace_back();
+				tensors.back().Deserialize(file);
+			}
+		}
+		catch (...)
+		{
+			return false;
+		}
+		file.Close();
+
+		std::vector<CarpRobotDim> dims;
+		std::vector<const cr_real*> values;
+		for (auto& tensor : tensors)
+		{
+			dims.push_back(tensor.GetDim());
+			values.push_back(tensor.GetValue());
+		}
+		return Write(new_path, dims, values);
+	}
+
+private:
+	static unsigned long long Align(unsigned long long size) { return (size + CARP_ROBOT_MODEL_FILE_ALIGN - 1) / CARP_ROBOT_MODEL_FILE_ALIGN * CARP_ROBOT_MODEL_FILE_ALIGN; }
+
+	// дʱļٸӳļĽ̲дһ
+	// Windowsӳļʱ滻falseҪЩͷ֮ٱ
+	static bool Write(const std::string& file_path, const std::vector<CarpRobotDim>& dims, const std::vector<const cr_real*>& values)
+	{
+		CarpRobotModelFileHead head;
+		head.count = (unsigned int)dims.size();
+
+		// ÿλ
+		std::vector<CarpRobotModelFileIndex> index(dims.size());
+		unsigned long long offset = 0;
+		for (size_t i = 0; i < dims.size(); ++i)
+		{
+			auto& info = index[i];
+			info.nd = dims[i].Count();
+			for (int k = 0; k < info.nd; ++k) info.d[k] = dims[i].Get(k);
+			info.offset = offset;
+			info.count = dims[i].GetTotalSize();
+			offset = Align(offset + info.count * sizeof(cr_real));
+		}
+		const size_t index_size = index.size() * sizeof(CarpRobotModelFileIndex);
+		head.data_offset = Align(sizeof(head) + index_size);
+		head.data_size = offset;
+
+		// У
+		const std::vector<char> padding(CARP_ROBOT_MODEL_FILE_ALIGN, 0);
+		CarpRobotModelChecksum index_checksum;
+		index_checksum.Update(index.data(), index_size);
+		head.index_checksum = index_checksum.Get();
+		CarpRobotModelChecksum data_checksum;
+		for (size_t i = 0; i < index.size(); ++i)
+		{
+			const size_t bytes = (size_t)index[i].count * sizeof(cr_real);
+			data_checksum.Update(values[i], bytes);
+			const size_t end = i + 1 < index.size() ? (size_t)index[i + 1].offset : (size_t)head.data_size;
+			data_checksum.Update(padding.data(), end - index[i].offset - bytes);
+		}
+		head.data_checksum = data_checksum.Get();
+
+		// ·UTF8WindowsʱļĴ͸ʹÿַĽӿ
+		const std::string temp_path = file_path + ".tmp";
+#ifdef _WIN32
+		FILE* file = nullptr;
+		_wfopen_s(&file, CarpFile::UTF82Unicode(temp_path).c_str(), L"wb");
+#else
+		FILE* file = fopen(temp_path.c_str(), "wb");
+#endif
+		if (file == nullptr) return false;
+
+		bool good = WriteData(file, &head, sizeof(head)) && WriteData(file, index.data(), index_size)
+			&& WriteData(file, padding.data(), head.data_offset - sizeof(head) - index_size);
+		for (size_t i = 0; good && i < index.size(); ++i)
+		{
+			const size_t bytes = (size_t)index[i].count * sizeof(cr_real);
+			const size_t end = i + 1 < index.size() ? (size_t)index[i + 1].offset : (size_t)head.data_size;
+			good = WriteData(file, values[i], bytes) && WriteData(file, padding.data(), end - index[i].offset - bytes);
+		}
+		good = fclose(file) == 0 && good;
+		if (!good)
+		{
+			RemoveFile(temp_path);
+			return false;
+		}
+
+#ifdef _WIN32
+		// renameܸѾڵļֱ滻־ļѾɾļûи
+		const bool result = MoveFileExW(CarpFile::UTF82Unicode(temp_path).c_str(), CarpFile::UTF82Unicode(file_path).c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+		const bool result = std::rename(temp_path.c_str(), file_path.c_str()) == 0;
+#endif
+		if (!result) RemoveFile(temp_path);
+		return result;
+	}
+
+	static bool WriteData(FILE* file, const void* data, size_t size)
+	{
+		return size == 0 || fwrite(data, 1, size, file) == size;
+	}
+
+	static void RemoveFile(const std::string& file_path)
+	{
+#ifdef _WIN32
+		_wremove(CarpFile::UTF82Unicode(file_path).c_str());
+#else
+		std::remove(file_path.c_str());
+#endif
+	}
+};
+
+/* eg. ѵ֮󱣴Ϊģļ߰Ѿɵģļת
+	CarpRobotModelFile::Save(&model, "policy.crm");
+	CarpRobotModelFile::Convert("policy.model", "policy.crm");
+
+	// ֱӳģļ̹ͬһڴ
+	CarpRobotParameterCollection model;
+	CarpRobotLinear l1(&model, 32, 128);
+	CarpRobotLinear l2(&model, 128, 8);
+	if (!CarpRobotModelFile::Load(&model, "policy.crm", true))
+		model.Load("policy.model");
+*/
+
+#endif
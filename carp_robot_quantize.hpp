@@ -0,0 +1,228 @@
+#ifndef CARP_ROBOT_QUANTIZE_INCLUDED
+#define CARP_ROBOT_QUANTIZE_INCLUDED
+
+#include "carp_robot.hpp"
+
+#include <cstdint>
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
+
+// int8Գ[-127, 127]Ӧ[-max, max]ʹ-128
+#define CARP_ROBOT_INT8_MAX 127
+// ÿһа64int8룬油0Ҫβ
+#define CARP_ROBOT_INT8_ALIGN 64
+
+// ֧AVX-512 VNNIʱ128޷зŵȨһָ4˼
+// 128 * sum(w)
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+#define CARP_ROBOT_INT8_VNNI
+#endif
+
+// noutscale(max / 127)ΧĽض
+inline void CarpRobotQuantizeInt8(const cr_real* x, int n, cr_real scale, int8_t* out)
+{
+	const cr_real inv = scale > 0 ? 1.0f / scale : 0.0f;
+	for (int i = 0; i < n; ++i)
+	{
+		cr_real v = x[i] * inv;
+		v = std::min(std::max(v, (cr_real)-CARP_ROBOT_INT8_MAX), (cr_real)CARP_ROBOT_INT8_MAX);
+		out[i] = (int8_t)(v >= 0 ? (int)(v + 0.5f) : (int)(v - 0.5f));
+	}
+}
+
+// ֵֵ
+inline cr_real CarpRobotAbsMax(const cr_real* x, int n)
+{
+	return n > 0 ? Eigen::Map<const Eigen::ArrayXf>(x, n).abs().maxCoeff() : 0.0f;
+}
+
+// ֮ĳ
+inline int CarpRobotInt8Align(int n) { return (n + CARP_ROBOT_INT8_ALIGN - 1) / CARP_ROBOT_INT8_ALIGN * CARP_ROBOT_INT8_ALIGN; }
+
+// 4Ȩطֱxwÿһмw_stridenCARP_ROBOT_INT8_ALIGNı
+// xֻһθ4йãʱAVX-512(VNNI)AVX2ʹöӦָͨѭ
+inline void CarpRobotDotInt8x4(const int8_t* w, size_t w_stride, const int8_t* x, int n, int32_t* out)
+{
+	const int8_t* w0 = w, * w1 = w + w_stride, * w2 = w + 2 * w_stride, * w3 = w + 3 * w_stride;
+#if defined(CARP_ROBOT_INT8_VNNI)
+	__m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512(), acc2 = _mm512_setzero_si512(), acc3 = _mm512_setzero_si512();
+	const __m512i flip = _mm512_set1_epi8((char)0x80);
+	for (int i = 0; i < n; i += 64)
+	{
+		__m512i vx = _mm512_xor_si512(_mm512_loadu_si512((const void*)(x + i)), flip);
+		acc0 = _mm512_dpbusd_epi32(acc0, vx, _mm512_loadu_si512((const void*)(w0 + i)));
+		acc1 = _mm512_dpbusd_epi32(acc1, vx, _mm512_loadu_si512((const void*)(w1 + i)));
+		acc2 = _mm512_dpbusd_epi32(acc2, vx, _mm512_loadu_si512((const void*)(w2 + i)));
+		acc3 = _mm512_dpbusd_epi32(acc3, vx, _mm512_loadu_si512((const void*)(w3 + i)));
+	}
+	out[0] = _mm512_reduce_add_epi32(acc0);
+	out[1] = _mm512_reduce_add_epi32(acc1);
+	out[2] = _mm512_reduce_add_epi32(acc2);
+	out[3] = _mm512_reduce_add_epi32(acc3);
+#elif defined(__AVX512BW__)
+	__m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512(), acc2 = _mm512_setzero_si512(), acc3 = _mm512_setzero_si512();
+	for (int i = 0; i < n; i += 32)
+	{
+		__m512i vx = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)(x + i)));
+		acc0 = _mm512_add_epi32(acc0, _mm512_madd_epi16(vx, _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)(w0 + i)))));
+		acc1 = _mm512_add_epi32(acc1, _mm512_madd_epi16(vx, _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)(w1 + i)))));
+		acc2 = _mm512_add_epi32(acc2, _mm512_madd_epi16(vx, _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)(w2 + i)))));
+		acc3 = _mm512_add_epi32(acc3, _mm512_madd_epi16(vx, _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)(w3 + i)))));
+	}
+	out[0] = _mm512_reduce_add_epi32(acc0);
+	out[1] = _mm512_reduce_add_epi32(acc1);
+	out[2] = _mm512_reduce_add_epi32(acc2);
+	out[3] = _mm512_reduce_add_epi32(acc3);
+#elif defined(__AVX2__)
+	__m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256(), acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+	for (int i = 0; i < n; i += 16)
+	{
+		__m256i vx = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(x + i)));
+		acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(vx, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(w0 + i)))));
+		acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(vx, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(w1 + i)))));
+		acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(vx, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(w2 + i)))));
+		acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(vx, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(w3 + i)))));
+	}
+	// 4ۼһ
+	__m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(acc0, acc1), _mm256_hadd_epi32(acc2, acc3));
+	__m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+	_mm_storeu_si128((__m128i*)out, sum4);
+#else
+	int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+	for (int i = 0; i < n; ++i)
+	{
+		const int32_t v = x[i];
+		sum0 += v * w0[i];
+		sum1 += v * w1[i];
+		sum2 += v * w2[i];
+		sum3 += v * w3[i];
+	}
+	out[0] = sum0; out[1] = sum1; out[2] = sum2; out[3] = sum3;
+#endif
+}
+
+// int8ľÿһ(ͨ)һϵÿһ
+// 뵽4ıж0
+class CarpRobotQuantizedMatrix
+{
+public:
+	// ȵľ󣬱CarpRobotLinearWrowsͨ
+	void QuantizeColMajor(const cr_real* data, int rows, int cols) { Quantize(data, rows, cols, 1, rows); }
+	// ȵľ󣬱˵ÿһͨ
+	void QuantizeRowMajor(const cr_real* data, int rows, int cols) { Quantize(data, rows, cols, cols, 1); }
+
+	int GetRows() const { return m_rows; }
+	int GetCols() const { return m_cols; }
+	// ÿһж֮ĳ
+	int GetStride() const { return m_stride; }
+	// ȡռõڴ(ֽ)
+	int GetMemory() const { return (int)(m_data.size() + m_scales.size() * sizeof(cr_real) + m_offsets.size() * sizeof(int32_t)); }
+
+public:
+	// out(r, c) = (add ? out(r, c) : 0) + W(r) . x(c)
+	// xÿһѾҶ룬x_scale
+	void Gemm(const int8_t* x, int x_cols, cr_real x_scale, cr_real* out, bool add) const
+	{
+		for (int c = 0; c < x_cols; ++c)
+		{
+			const int8_t* col = x + (size_t)c * m_stride;
+			cr_real* o = out + (size_t)c * m_rows;
+			for (int r = 0; r < m_rows; r += 4)
+			{
+				cr_real v[4];
+				Dot4(r, col, x_scale, v);
+				const int count = std::min(4, m_rows - r);
+				for (int k = 0; k < count; ++k)
+				{
+					if (add) o[r + k] += v[k];
+					else o[r + k] = v[k];
+				}
+			}
+		}
+	}
+
+	// int8x֮HWCN˰[ͨ][KH * KW * Ci]HWCN
+	// patchʱڴ棬GetStride()
+	void Conv2D(const int8_t* x, cr_real x_scale, int in_h, int in_w, int in_c, int batch
+		, int kernel_h, int kernel_w, int stride_h, int stride_w, int pad_top, int pad_left
+		, int out_h, int out_w, int8_t* patch, cr_real* out) const
+	{
+		const size_t area = (size_t)out_h * out_w;
+		for (int n = 0; n < batch; ++n)
+		{
+			for (int ow = 0; ow < out_w; ++ow)
+			{
+				for (int oh = 0; oh < out_h; ++oh)
+				{
+					// ȡһλöӦ飬˳;˵ڴ˳һ£Խĵط0
+					int8_t* p = patch;
+					for (int ci = 0; ci < in_c; ++ci)
+					{
+						for (int kw = 0; kw < kernel_w; ++kw)
+						{
+							const int w = ow * stride_w + kw - pad_left;
+							for (int kh = 0; kh < kernel_h; ++kh)
+							{
+								const int h = oh * stride_h + kh - pad_top;
+								*p++ = (h >= 0 && h < in_h && w >= 0 && w < in_w) ? x[h + in_h * (w + in_w * (ci + in_c * n))] : 0;
+							}
+						}
+					}
+
+					cr_real* o = out + oh + out_h * (ow + out_w * (size_t)m_rows * n);
+					for (int co = 0; co < m_rows; co += 4)
+					{
+						cr_real v[4];
+						Dot4(co, patch, x_scale, v);
+						const int count = std::min(4, m_rows - co);
+						for (int k = 0; k < count; ++k) o[(co + k) * area] = v[k];
+					}
+				}
+			}
+		}
+	}
+
+private:
+	// rпʼ4кxĵתظ
+	void Dot4(int r, const int8_t* x, cr_real x_scale, cr_real* out) const
+	{
+		int32_t dot[4];
+		CarpRobotDotInt8x4(m_data.data() + (size_t)r * m_stride, m_stride, x, m_stride, dot);
+		for (int k = 0; k < 4; ++k)
+			out[k] = (dot[k] - m_offsets[r + k]) * (m_scales[r + k] * x_scale);
+	}
+
+	void Quantize(const cr_real* data, int rows, int cols, int row_step, int col_step)
+	{
+		const int padded_rows = (rows + 3) / 4 * 4;
+		m_rows = rows;
+		m_cols = cols;
+		m_stride = CarpRobotInt8Align(cols);
+		m_data.assign((size_t)padded_rows * m_stride, 0);
+		m_scales.assign(padded_rows, 0.0f);
+		m_offsets.assign(padded_rows, 0);
+
+		std::vector<cr_real> row(cols);
+		for (int r = 0; r < rows; ++r)
+		{
+			for (int c = 0; c < cols; ++c) row[c] = data[(size_t)r * row_step + (size_t)c * col_step];
+			m_scales[r] = CarpRobotAbsMax(row.data(), cols) / CARP_ROBOT_INT8_MAX;
+			int8_t* q = m_data.data() + (size_t)r * m_stride;
+			CarpRobotQuantizeInt8(row.data(), cols, m_scales[r], q);
+#if defined(CARP_ROBOT_INT8_VNNI)
+			for (int c = 0; c < cols; ++c) m_offsets[r] += 128 * q[c];
+#endif
+		}
+	}
+
+private:
+	std::vector<int8_t> m_data;			// ֮Ȩ
+	std::vector<cr_real> m_scales;		// ÿһеϵ
+	std::vector<int32_t> m_offsets;		// VNNIʱÿһж128 * sum(w)
+	int m_rows = 0;
+	int m_cols = 0;
+	int m_stride = 0;
+};
+
+#endif
@@ -0,0 +1,423 @@
+#ifndef CARP_ROBOT_SIMD_INCLUDED
+#define CARP_ROBOT_SIMD_INCLUDED
+
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+
+// ѡѡָAVX2 > SSE2 > NEON(64λ) > ͨѭ
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CARP_ROBOT_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CARP_ROBOT_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CARP_ROBOT_SIMD_NEON
+#endif
+
+// ɢֵ֧άޣ
+#define CARP_ROBOT_SIMD_MAX_AXIS 8
+
+// һfloat㣬ָͬֻҪʵPackĻ㣬ϲӶЩд
+class CarpRobotSimd
+{
+public:
+#if defined(CARP_ROBOT_SIMD_AVX2)
+	typedef __m256 Pack;
+	static const int WIDTH = 8;
+	static Pack Load(const float* p) { return _mm256_loadu_ps(p); }
+	static void Store(float* p, Pack a) { _mm256_storeu_ps(p, a); }
+	static Pack Set(float v) { return _mm256_set1_ps(v); }
+	static Pack Add(Pack a, Pack b) { return _mm256_add_ps(a, b); }
+	static Pack Sub(Pack a, Pack b) { return _mm256_sub_ps(a, b); }
+	static Pack Mul(Pack a, Pack b) { return _mm256_mul_ps(a, b); }
+	static Pack Div(Pack a, Pack b) { return _mm256_div_ps(a, b); }
+	static Pack Max(Pack a, Pack b) { return _mm256_max_ps(a, b); }
+	static Pack Min(Pack a, Pack b) { return _mm256_min_ps(a, b); }
+#if defined(__FMA__)
+	static Pack MulAdd(Pack a, Pack b, Pack c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+	static Pack MulAdd(Pack a, Pack b, Pack c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+	static Pack Round(Pack a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	static Pack Pow2(Pack n) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23)); }
+	static Pack Abs(Pack a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+	static Pack CopySign(Pack a, Pack b) { return _mm256_or_ps(a, _mm256_and_ps(_mm256_set1_ps(-0.0f), b)); }
+	static float ReduceMax(Pack a)
+	{
+		__m128 m = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+		return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+	}
+	static float ReduceAdd(Pack a)
+	{
+		__m128 s = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+		s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+		return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+	}
+#elif defined(CARP_ROBOT_SIMD_SSE2)
+	typedef __m128 Pack;
+	static const int WIDTH = 4;
+	static Pack Load(const float* p) { return _mm_loadu_ps(p); }
+	static void Store(float* p, Pack a) { _mm_storeu_ps(p, a); }
+	static Pack Set(float v) { return _mm_set1_ps(v); }
+	static Pack Add(Pack a, Pack b) { return _mm_add_ps(a, b); }
+	static Pack Sub(Pack a, Pack b) { return _mm_sub_ps(a, b); }
+	static Pack Mul(Pack a, Pack b) { return _mm_mul_ps(a, b); }
+	static Pack Div(Pack a, Pack b) { return _mm_div_ps(a, b); }
+	static Pack Max(Pack a, Pack b) { return _mm_max_ps(a, b); }
+	static Pack Min(Pack a, Pack b) { return _mm_min_ps(a, b); }
+	static Pack MulAdd(Pack a, Pack b, Pack c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+	// ֻڷΧѾƹϣתת
+	static Pack Round(Pack a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+	static Pack Pow2(Pack n) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)); }
+	static Pack Abs(Pack a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+	static Pack CopySign(Pack a, Pack b) { return _mm_or_ps(a, _mm_and_ps(_mm_set1_ps(-0.0f), b)); }
+	static float ReduceMax(Pack a)
+	{
+		__m128 m = _mm_max_ps(a, _mm_movehl_ps(a, a));
+		return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+	}
+	static float ReduceAdd(Pack a)
+	{
+		__m128 s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+		return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+	}
+#elif defined(CARP_ROBOT_SIMD_NEON)
+	typedef float32x4_t Pack;
+	static const int WIDTH = 4;
+	static Pack Load(const float* p) { return vld1q_f32(p); }
+	static void Store(float* p, Pack a) { vst1q_f32(p, a); }
+	static Pack Set(float v) { return vdupq_n_f32(v); }
+	static Pack Add(Pack a, Pack b) { return vaddq_f32(a, b); }
+	static Pack Sub(Pack a, Pack b) { return vsubq_f32(a, b); }
+	static Pack Mul(Pack a, Pack b) { return vmulq_f32(a, b); }
+	static Pack Div(Pack a, Pack b) { return vdivq_f32(a, b); }
+	static Pack Max(Pack a, Pack b) { return vmaxq_f32(a, b); }
+	static Pack Min(Pack a, Pack b) { return vminq_f32(a, b); }
+	static Pack MulAdd(Pack a, Pack b, Pack c) { return vfmaq_f32(c, a, b); }
+	static Pack Round(Pack a) { return vrndnq_f32(a); }
+	static Pack Pow2(Pack n) { return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(n), vdupq_n_s32(127)), 23)); }
+	static Pack Abs(Pack a) { return vabsq_f32(a); }
+	static Pack CopySign(Pack a, Pack b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vandq_u32(vreinterpretq_u32_f32(b), vdupq_n_u32(0x80000000)))); }
+	static float ReduceMax(Pack a) { return vmaxvq_f32(a); }
+	static float ReduceAdd(Pack a) { return vaddvq_f32(a); }
+#else
+	typedef float Pack;
+	static const int WIDTH = 1;
+	static Pack Load(const float* p) { return *p; }
+	static void Store(float* p, Pack a) { *p = a; }
+	static Pack Set(float v) { return v; }
+	static Pack Add(Pack a, Pack b) { return a + b; }
+	static Pack Sub(Pack a, Pack b) { return a - b; }
+	static Pack Mul(Pack a, Pack b) { return a * b; }
+	static Pack Div(Pack a, Pack b) { return a / b; }
+	static Pack Max(Pack a, Pack b) { return std::max(a, b); }
+	static Pack Min(Pack a, Pack b) { return std::min(a, b); }
+	static Pack MulAdd(Pack a, Pack b, Pack c) { return a * b + c; }
+	static Pack Round(Pack a) { return std::nearbyint(a); }
+	static Pack Pow2(Pack n) { return std::ldexp(1.0f, (int)n); }
+	static Pack Abs(Pack a) { return std::fabs(a); }
+	static Pack CopySign(Pack a, Pack b) { return std::copysign(a, b); }
+	static float ReduceMax(Pack a) { return a; }
+	static float ReduceAdd(Pack a) { return a; }
+#endif
+
+public:
+	// ǷʹĽƼ㣬ĬϹرգʹúԭһEigen㣬ѵ
+	// һڳʱãвҪ޸
+	static void SetApproximate(bool approximate) { Approximate() = approximate; }
+	static bool IsApproximate() { return Approximate(); }
+
+public:
+	// exp(x)CephesĶʽƣ2e-7ڣfloatΧᱻض
+	static Pack Exp(Pack x)
+	{
+		x = Min(Max(x, Set(-87.3f)), Set(88.3f));
+		const Pack n = Round(Mul(x, Set(1.44269504088896341f)));
+		const Pack r = Sub(Sub(x, Mul(n, Set(0.693359375f))), Mul(n, Set(-2.12194440e-4f)));
+		Pack p = Set(1.9875691500e-4f);
+		p = MulAdd(p, r, Set(1.3981999507e-3f));
+		p = MulAdd(p, r, Set(8.3334519073e-3f));
+		p = MulAdd(p, r, Set(4.1665795894e-2f));
+		p = MulAdd(p, r, Set(1.6666665459e-1f));
+		p = MulAdd(p, r, Set(5.0000001201e-1f));
+		p = MulAdd(Mul(p, r), r, Add(r, Set(1.0f)));
+		return Mul(p, Pow2(n));
+	}
+	// 1 / (1 + exp(-x))
+	static Pack Sigmoid(Pack x)
+	{
+		const Pack one = Set(1.0f);
+		return Div(one, Add(one, Exp(Sub(Set(0.0f), x))));
+	}
+	// tanh(x)13/6׵ƣ|x|7.9ʱѾǡ1
+	static Pack Tanh(Pack x)
+	{
+		x = Min(Max(x, Set(-7.90531110763549805f)), Set(7.90531110763549805f));
+		const Pack x2 = Mul(x, x);
+		Pack p = Set(-2.76076847742355e-16f);
+		p = MulAdd(p, x2, Set(2.00018790482477e-13f));
+		p = MulAdd(p, x2, Set(-8.60467152213735e-11f));
+		p = MulAdd(p, x2, Set(5.12229709037114e-08f));
+		p = MulAdd(p, x2, Set(1.48572235717979e-05f));
+		p = MulAdd(p, x2, Set(6.37261928875436e-04f));
+		p = MulAdd(p, x2, Set(4.89352455891786e-03f));
+		p = Mul(p, x);
+		Pack q = Set(1.19825839466702e-06f);
+		q = MulAdd(q, x2, Set(1.18534705686654e-04f));
+		q = MulAdd(q, x2, Set(2.26843463243900e-03f));
+		q = MulAdd(q, x2, Set(4.89352518554385e-03f));
+		return Div(p, q);
+	}
+
+public:
+	// y[i] = f(x[i])βһʱʱ鲹
+	template <typename F>
+	static void Unary(const float* x, float* y, size_t n, const F& f)
+	{
+		size_t i = 0;
+		for (; i + WIDTH <= n; i += WIDTH) Store(y + i, f(Load(x + i)));
+		if (i == n) return;
+		float tx[WIDTH] = {}, ty[WIDTH];
+		memcpy(tx, x + i, (n - i) * sizeof(float));
+		Store(ty, f(Load(tx)));
+		memcpy(y + i, ty, (n - i) * sizeof(float));
+	}
+	// y[i] = f(a[i], b[i], y[i])
+	template <typename F>
+	static void Binary(const float* a, const float* b, float* y, size_t n, const F& f)
+	{
+		size_t i = 0;
+		for (; i + WIDTH <= n; i += WIDTH) Store(y + i, f(Load(a + i), Load(b + i), Load(y + i)));
+		if (i == n) return;
+		float ta[WIDTH] = {}, tb[WIDTH] = {}, ty[WIDTH] = {};
+		memcpy(ta, a + i, (n - i) * sizeof(float));
+		memcpy(tb, b + i, (n - i) * sizeof(float));
+		memcpy(ty, y + i, (n - i) * sizeof(float));
+		Store(ty, f(Load(ta), Load(tb), Load(ty)));
+		memcpy(y + i, ty, (n - i) * sizeof(float));
+	}
+
+	static void Sigmoid(const float* x, float* y, size_t n) { Unary(x, y, n, [](Pack v) { return Sigmoid(v); }); }
+	static void Tanh(const float* x, float* y, size_t n) { Unary(x, y, n, [](Pack v) { return Tanh(v); }); }
+
+	// ֵ
+	static float Max(const float* x, size_t n)
+	{
+		float result = x[0];
+		size_t i = 0;
+		if (n >= (size_t)WIDTH)
+		{
+			Pack m = Load(x);
+			for (i = WIDTH; i + WIDTH <= n; i += WIDTH) m = Max(m, Load(x + i));
+			result = ReduceMax(m);
+		}
+		for (; i < n; ++i) result = std::max(result, x[i]);
+		return result;
+	}
+	// y = exp(x - m)yܺ
+	static float ExpSum(const float* x, float m, float* y, size_t n)
+	{
+		const Pack pm = Set(m);
+		Pack s = Set(0.0f);
+		size_t i = 0;
+		for (; i + WIDTH <= n; i += WIDTH)
+		{
+			const Pack e = Exp(Sub(Load(x + i), pm));
+			Store(y + i, e);
+			s = Add(s, e);
+		}
+		float result = ReduceAdd(s);
+		for (; i < n; ++i)
+		{
+			float tx[WIDTH] = {}, ty[WIDTH];
+			tx[0] = x[i] - m;
+			Store(ty, Exp(Load(tx)));
+			y[i] = ty[0];
+			result += ty[0];
+		}
+		return result;
+	}
+	// һеsoftmaxֵexpܺͣܺ
+	static void Softmax(const float* x, float* y, size_t n)
+	{
+		if (n == 0) return;
+		const float m = Max(x, n);
+		const Pack scale = Set(1.0f / ExpSum(x, m, y, n));
+		Unary(y, y, n, [&scale](Pack v) { return Mul(v, scale); });
+	}
+	// һеlog softmaxy = x - m - log(sum(exp(x - m)))
+	static void LogSoftmax(const float* x, float* y, size_t n)
+	{
+		if (n == 0) return;
+		const float m = Max(x, n);
+		const Pack z = Set(m + std::log(ExpSum(x, m, y, n)));
+		Unary(x, y, n, [&z](Pack v) { return Sub(v, z); });
+	}
+
+public:
+	/**
+	 * ɢԪ out = f(a, b)
+	 * @param nd: ά
+	 * @param dims: ÿάȵĴСһά
+	 * @param a_strides: aÿάϵĲ0ʾάҪɢ
+	 * @param b_strides: bÿάϵĲ0ʾάҪɢ
+	 */
+	template <typename F>
+	static void Broadcast(int nd, const int* dims, const float* a, const size_t* a_strides, const float* b, const size_t* b_strides, float* out, const F& f)
+	{
+		size_t out_strides[CARP_ROBOT_SIMD_MAX_AXIS];
+		size_t stride = 1;
+		for (int i = 0; i < nd; ++i)
+		{
+			out_strides[i] = stride;
+			stride *= dims[i];
+		}
+		Loop(nd, dims, a, a_strides, b, b_strides, out, out_strides, [&f](const float* a, bool a_vector, const float* b, bool b_vector, float* out, bool, size_t n)
+		{
+			Row(a, a_vector, b, b_vector, out, n, f);
+		});
+	}
+
+	/**
+	 * ɢۼ out += f(a, b)outĲ0άȻѽͣ練򴫲ʱɢ֮ǰά
+	 * @param dims: вάȵĴС
+	 */
+	template <typename F>
+	static void BroadcastAdd(int nd, const int* dims, const float* a, const size_t* a_strides, const float* b, const size_t* b_strides, float* out, const size_t* out_strides, const F& f)
+	{
+		Loop(nd, dims, a, a_strides, b, b_strides, out, out_strides, [&f](const float* a, bool a_vector, const float* b, bool b_vector, float* out, bool out_vector, size_t n)
+		{
+			RowAdd(a, a_vector, b, b_vector, out, out_vector, n, f);
+		});
+	}
+
+private:
+	static bool& Approximate() { static bool approximate = false; return approximate; }
+
+	// ȥС1άȣʵάȺϲһڲάȲֻ01
+	// Ȼڲһеrowάνλ
+	template <typename R>
+	static void Loop(int nd, const int* dims, const float* a, const size_t* a_strides, const float* b, const size_t* b_strides, float* out, const size_t* out_strides, const R& row)
+	{
+		int d[CARP_ROBOT_SIMD_MAX_AXIS];
+		size_t as[CARP_ROBOT_SIMD_MAX_AXIS], bs[CARP_ROBOT_SIMD_MAX_AXIS], os[CARP_ROBOT_SIMD_MAX_AXIS];
+		int m = 0;
+		for (int i = 0; i < nd; ++i)
+		{
+			if (dims[i] == 1) continue;
+			if (m > 0 && a_strides[i] == as[m - 1] * d[m - 1] && b_strides[i] == bs[m - 1] * d[m - 1] && out_strides[i] == os[m - 1] * d[m - 1])
+			{
+				d[m - 1] *= dims[i];
+				continue;
+			}
+			d[m] = dims[i];
+			as[m] = a_strides[i];
+			bs[m] = b_strides[i];
+			os[m] = out_strides[i];
+			++m;
+		}
+		if (m == 0)
+		{
+			d[0] = 1;
+			as[0] = bs[0] = os[0] = 1;
+			m = 1;
+		}
+
+		size_t outer = 1;
+		for (int j = 1; j < m; ++j) outer *= d[j];
+
+		const size_t n = d[0];
+		int index[CARP_ROBOT_SIMD_MAX_AXIS] = {};
+		size_t ia = 0, ib = 0, io = 0;
+		for (size_t k = 0; k < outer; ++k)
+		{
+			row(a + ia, as[0] != 0, b + ib, bs[0] != 0, out + io, os[0] != 0, n);
+
+			for (int j = 1; j < m; ++j)
+			{
+				ia += as[j];
+				ib += bs[j];
+				io += os[j];
+				if (++index[j] < d[j]) break;
+				ia -= as[j] * d[j];
+				ib -= bs[j] * d[j];
+				io -= os[j] * d[j];
+				index[j] = 0;
+			}
+		}
+	}
+
+	// ڲһУabʱһ
+	template <typename F>
+	static void Row(const float* a, bool a_vector, const float* b, bool b_vector, float* out, size_t n, const F& f)
+	{
+		size_t i = 0;
+		if (a_vector && b_vector)
+		{
+			for (; i + WIDTH <= n; i += WIDTH) Store(out + i, f(Load(a + i), Load(b + i)));
+		}
+		else if (a_vector)
+		{
+			const Pack pb = Set(b[0]);
+			for (; i + WIDTH <= n; i += WIDTH) Store(out + i, f(Load(a + i), pb));
+		}
+		else
+		{
+			const Pack pa = Set(a[0]);
+			for (; i + WIDTH <= n; i += WIDTH) Store(out + i, f(pa, Load(b + i)));
+		}
+		if (i == n) return;
+
+		float ta[WIDTH], tb[WIDTH], to[WIDTH];
+		for (size_t k = 0; k < (size_t)WIDTH; ++k)
+		{
+			const size_t j = std::min(i + k, n - 1);
+			ta[k] = a_vector ? a[j] : a[0];
+			tb[k] = b_vector ? b[j] : b[0];
+		}
+		Store(to, f(Load(ta), Load(tb)));
+		memcpy(out + i, to, (n - i) * sizeof(float));
+	}
+
+	// ڲһۼӣoutʱеĽ֮ȥ
+	template <typename F>
+	static void RowAdd(const float* a, bool a_vector, const float* b, bool b_vector, float* out, bool out_vector, size_t n, const F& f)
+	{
+		const Pack pa = Set(a[0]), pb = Set(b[0]);
+		Pack sum = Set(0.0f);
+		size_t i = 0;
+		for (; i + WIDTH <= n; i += WIDTH)
+		{
+			const Pack v = f(a_vector ? Load(a + i) : pa, b_vector ? Load(b + i) : pb);
+			if (out_vector) Store(out + i, Add(Load(out + i), v));
+			else sum = Add(sum, v);
+		}
+		float total = ReduceAdd(sum);
+		for (; i < n; ++i)
+		{
+			float ta[WIDTH] = {}, tb[WIDTH] = {}, to[WIDTH];
+			ta[0] = a_vector ? a[i] : a[0];
+			tb[0] = b_vector ? b[i] : b[0];
+			Store(to, f(Load(ta), Load(tb)));
+			if (out_vector) out[i] += to[0];
+			else total += to[0];
+		}
+		if (!out_vector) out[0] += total;
+	}
+};
+
+/* eg. ߶ԾҪ󲻸ߵѵԴ򿪽Ƽ
+	CarpRobotSimd::SetApproximate(true);
+
+	// ֱʹ
+	std::vector<float> x(1000), y(1000);
+	CarpRobotSimd::Tanh(x.data(), y.data(), x.size());
+	CarpRobotSimd::Unary(x.data(), y.data(), x.size(), [](CarpRobotSimd::Pack v) { return CarpRobotSimd::Mul(v, v); });
+*/
+
+#endif
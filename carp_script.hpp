@@ -3,8 +3,15 @@
 
 #include <string>
 #include <set>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <atomic>
+#include <thread>
+#include <cstdio>
 
 #include "carp_lua.hpp"
+#include "carp_lua_alloc.hpp"
 
 #ifdef _WIN32
 #ifdef _DEBUG
@@ -19,6 +26,165 @@
 #include "carp_log.hpp"
 #include "carp_rwops_bind.hpp"
 
+// ̻ļͷ: (4) + Ƿ(4) + ֽС(4) + key(32)
+#define CARP_SCRIPT_CHUNK_MAGIC "CLBC"
+#define CARP_SCRIPT_CHUNK_KEY_LEN 32
+#define CARP_SCRIPT_CHUNK_HEAD_LEN (12 + CARP_SCRIPT_CHUNK_KEY_LEN)
+
+/* õֽ룬ͬһ̵Ķlua statestateʱٱ
+ * ָcache_dirʱֽͬʱдĿ¼´ʱֱӼ
+ * ̻ļ·Դݼ㣬Դ޸֮ȻʧЧĿ¼ʱɾ
+ * ԴǼܵģֽҲ֮д
+ */
+class CarpScriptChunkCache
+{
+public:
+	explicit CarpScriptChunkCache(const std::string& cache_dir = "")
+	{
+		if (cache_dir.empty()) return;
+
+		// ͬ汾luaֽ벻ͨãֿĿ¼ָ͵ĴСֽͬҲͨ
+		m_cache_dir = CarpFile::TryAddFileSeparator(cache_dir) + "lua" + std::to_string(LUA_VERSION_NUM) + "_" + std::to_string(sizeof(void*) * 8)
+			+ "_n" + std::to_string(sizeof(lua_Number)) + "_i" + std::to_string(sizeof(lua_Integer)) + "/";
+		CarpFile::CreateDeepFolder(m_cache_dir);
+	}
+
+public:
+	std::shared_ptr<const std::string> Get(const std::string& file_path)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		const auto it = m_chunk_map.find(file_path);
+		if (it == m_chunk_map.end()) return nullptr;
+		return it->second;
+	}
+
+	size_t GetCount()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		return m_chunk_map.size();
+	}
+
+public:
+	bool HasCacheDir() const { return !m_cache_dir.empty(); }
+
+	// ·Դݼkey
+	static std::string MakeKey(const std::string& file_path, const char* content, size_t len)
+	{
+		CarpCrypto::Md5Context context;
+		CarpCrypto::Md5Initialise(&context);
+		CarpCrypto::Md5Update(&context, file_path.c_str(), static_cast<uint32_t>(file_path.size() + 1));
+		CarpCrypto::Md5Update(&context, content, static_cast<uint32_t>(len));
+		CarpCrypto::MD5_HASH digest;
+		CarpCrypto::Md5Finalise(&context, &digest);
+		return CarpCrypto::Md4HashToString(&digest);
+	}
+
+	// Ӵ̼أɹ֮ͬʱŽڴ
+	std::shared_ptr<const std::string> Load(const std::string& file_path, const std::string& key)
+	{
+		if (m_cache_dir.empty()) return nullptr;
+
+		CarpFileMapping mapping;
+		if (!mapping.Open(m_cache_dir + key + ".luac")) return nullptr;
+
+		const char* data = mapping.GetData();
+		const size_t size = mapping.GetSize();
+		if (size < CARP_SCRIPT_CHUNK_HEAD_LEN) return nullptr;
+		if (memcmp(data, CARP_SCRIPT_CHUNK_MAGIC, 4) != 0) return nullptr;
+
+		unsigned int encrypt = 0;
+		unsigned int chunk_size = 0;
+		memcpy(&encrypt, data + 4, sizeof(encrypt));
+		memcpy(&chunk_size, data + 8, sizeof(chunk_size));
+		if (size != CARP_SCRIPT_CHUNK_HEAD_LEN + chunk_size) return nullptr;
+		if (key.compare(0, CARP_SCRIPT_CHUNK_KEY_LEN, data + 12, CARP_SCRIPT_CHUNK_KEY_LEN) != 0) return nullptr;
+
+		std::string chunk(data + CARP_SCRIPT_CHUNK_HEAD_LEN, chunk_size);
+		if (encrypt) CarpCrypto::XXTeaDecodeMemory(&chunk[0], static_cast<int>(chunk.size()), nullptr);
+
+		auto result = std::make_shared<const std::string>(std::move(chunk));
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_chunk_map[file_path] = result;
+		++m_load_count;
+		return result;
+	}
+
+	// Žڴ棬д
+	void Save(const std::string& file_path, const std::string& key, std::string&& chunk, bool encrypt)
+	{
+		if (!m_cache_dir.empty()) WriteFile(key, chunk, encrypt);
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_chunk_map[file_path] = std::make_shared<const std::string>(std::move(chunk));
+		++m_save_count;
+	}
+
+	// ֽػִʧܣڴɾkeyΪʱͬʱɾϵļ
+	void Remove(const std::string& file_path, const std::string& key)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_chunk_map.erase(file_path);
+		}
+		if (m_cache_dir.empty() || key.empty()) return;
+
+		const std::string cache_path = m_cache_dir + key + ".luac";
+#ifdef _WIN32
+		_wremove(CarpFile::UTF82Unicode(cache_path).c_str());
+#else
+		std::remove(cache_path.c_str());
+#endif
+	}
+
+	// Ӵ̼صͱ֮д
+	int GetLoadCount() const { return m_load_count; }
+	int GetSaveCount() const { return m_save_count; }
+
+private:
+	// дʱļٸstateͬʱдͬһļҲһ
+	bool WriteFile(const std::string& key, const std::string& chunk, bool encrypt) const
+	{
+		std::string content;
+		content.reserve(CARP_SCRIPT_CHUNK_HEAD_LEN + chunk.size());
+		const unsigned int encrypt_flag = encrypt ? 1 : 0;
+		const unsigned int chunk_size = static_cast<unsigned int>(chunk.size());
+		content.append(CARP_SCRIPT_CHUNK_MAGIC, 4);
+		content.append(reinterpret_cast<const char*>(&encrypt_flag), sizeof(encrypt_flag));
+		content.append(reinterpret_cast<const char*>(&chunk_size), sizeof(chunk_size));
+		content.append(key, 0, CARP_SCRIPT_CHUNK_KEY_LEN);
+		content.append(chunk);
+		if (encrypt) CarpCrypto::XXTeaEncodeMemory(&content[CARP_SCRIPT_CHUNK_HEAD_LEN], static_cast<int>(chunk.size()), nullptr);
+
+		const std::string file_path = m_cache_dir + key + ".luac";
+		const std::string temp_path = file_path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+#ifdef _WIN32
+		FILE* file = nullptr;
+		_wfopen_s(&file, CarpFile::UTF82Unicode(temp_path).c_str(), L"wb");
+#else
+		FILE* file = fopen(temp_path.c_str(), "wb");
+#endif
+		if (file == nullptr) return false;
+		const bool succeed = fwrite(content.data(), 1, content.size(), file) == content.size();
+		fclose(file);
+
+		if (!succeed || std::rename(temp_path.c_str(), file_path.c_str()) != 0)
+		{
+			std::remove(temp_path.c_str());
+			return false;
+		}
+		return true;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::unordered_map<std::string, std::shared_ptr<const std::string>> m_chunk_map;
+
+	std::string m_cache_dir;		// ̻Ŀ¼Ϊձʾֻڴﹲ
+	std::atomic<int> m_load_count{ 0 };
+	std::atomic<int> m_save_count{ 0 };
+};
+
+typedef std::shared_ptr<CarpScriptChunkCache> CarpScriptChunkCachePtr;
+
 class CarpScript
 {
 public:
@@ -26,15 +192,27 @@ public:
 	virtual ~CarpScript() { Release(); }
 
 public:
-	void Init()
+	// allocator ΪʱʹluaĬϵķͨlua_newstateʹָķ
+	void Init(const CarpLuaAllocatorPtr& allocator = nullptr)
 	{
 		// create state
-		m_L = ::luaL_newstate();
+		if (allocator)
+		{
+			m_allocator = allocator;
+			m_L = ::lua_newstate(CarpLuaAllocator::Alloc, m_allocator.get());
+			if (m_L) lua_atpanic(m_L, OnPanic);
+		}
+		else
+		{
+			m_L = ::luaL_newstate();
+		}
 		if (!m_L)
 		{
 			CARP_SCRIPT_ERROR("lua_open failed!");
+			m_allocator = nullptr;
 			return;
 		}
+		if (m_allocator) m_allocator->OnStateCreate(m_L);
 
 		// open all library
 		luaL_openlibs(m_L); lua_settop(m_L, 0);
@@ -45,6 +223,8 @@ public:
 			.beginClass<CarpScript>("CarpScript")
 			.addFunction("Require", &CarpScript::Require)
 			.addFunction("RunScript", &CarpScript::RunScriptForLua)
+			.addFunction("GetAllocReport", &CarpScript::GetAllocReport)
+			.addFunction("SnapshotAlloc", &CarpScript::SnapshotAlloc)
 			.endClass()
 			.endNamespace();
 
@@ -59,16 +239,20 @@ public:
 		// close lua state
 		if (m_L)
 		{
+			if (m_allocator) m_allocator->OnStateClose(m_L);
 			lua_close(m_L);
 			m_L = nullptr;
 		}
+		// lua_close֮ͷ
+		m_allocator = nullptr;
 
 		m_script_set.clear();
 	}
 
 public:
-	// нűļ
-	void RunScript(const char* script, size_t len, const char* file_path) const
+	// нűļscriptԴҲֽ룬dumpΪʱѱдȥ
+	// ؼغִǷ񶼳ɹ
+	bool RunScript(const char* script, size_t len, const char* file_path, std::string* dump = nullptr) const
 	{
 		lua_pushcclosure(m_L, OnError, 0);
 		const int err_func = lua_gettop(m_L);
@@ -76,18 +260,26 @@ public:
 		std::string show_path;
 		if (file_path != nullptr) show_path = file_path;
 		show_path = "@" + show_path;
+		bool succeed = false;
 		if (luaL_loadbuffer(m_L, script, len, show_path.c_str()) == 0)
 		{
+			if (dump != nullptr) lua_dump(m_L, DumpWriter, dump, 0);
 			lua_pushstring(m_L, file_path);
-			lua_pcall(m_L, 1, 1, err_func);
+			succeed = lua_pcall(m_L, 1, 1, err_func) == 0;
 		}
 		else
 			PrintError(m_L, file_path, lua_tostring(m_L, -1));
 		
 		lua_remove(m_L, err_func);
 		lua_pop(m_L, 1);
+		return succeed;
 	}
-	void RunScriptForLua(const char* script, const char* file_path) const { RunScript(script, strlen(script), file_path); }
+	bool RunScriptForLua(const char* script, const char* file_path) const { return RunScript(script, strlen(script), file_path); }
+
+	// ڴ䱨棬ûָʱؿַ
+	std::string GetAllocReport(int top) const { return m_allocator ? m_allocator->Dump(top > 0 ? top : 0) : std::string(); }
+	// ¼ǰڴ棬һαε
+	void SnapshotAlloc() const { if (m_allocator) m_allocator->Snapshot(); }
 
 private:
 	static void CallStack(lua_State* L, int n, std::string& stack_info)
@@ -117,6 +309,17 @@ private:
 
 		return 0;
 	}
+	static int DumpWriter(lua_State* L, const void* p, size_t size, void* ud)
+	{
+		static_cast<std::string*>(ud)->append(static_cast<const char*>(p), size);
+		return 0;
+	}
+	static int OnPanic(lua_State* L)
+	{
+		const char* error = lua_tostring(L, -1);
+		CARP_SCRIPT_ERROR("PANIC: unprotected error in call to Lua API (" << (error != nullptr ? error : "error object is not a string") << ")");
+		return 0;
+	}
 	static void PrintError(lua_State* L, const char* name, const char* message)
 	{
 		std::string content = name;
@@ -169,6 +372,110 @@ public:
 		lua_remove(m_L, err_func);
 	}
 
+	// ȫֺregistryã֮InvokeRefòֲٰңǺʱLUA_NOREF
+	// Release֮ʧЧȫֺlua¸ֵ֮Ҫ½
+	int RefFunction(const char* name) const
+	{
+		if (m_L == nullptr) return LUA_NOREF;
+
+		lua_getglobal(m_L, name);
+		if (!lua_isfunction(m_L, -1))
+		{
+			lua_pop(m_L, 1);
+			return LUA_NOREF;
+		}
+		return luaL_ref(m_L, LUA_REGISTRYINDEX);
+	}
+
+	void UnrefFunction(int ref) const
+	{
+		if (m_L == nullptr || ref == LUA_NOREF || ref == LUA_REFNIL) return;
+		luaL_unref(m_L, LUA_REGISTRYINDEX, ref);
+	}
+
+	// ȫֺ¸ֵ(ȸ)ʱ½ãûб仯ʱʲô
+	void RefreshFunction(int& ref, const char* name) const
+	{
+		if (m_L == nullptr) return;
+
+		lua_getglobal(m_L, name);
+		if (ref != LUA_NOREF && ref != LUA_REFNIL)
+		{
+			lua_rawgeti(m_L, LUA_REGISTRYINDEX, ref);
+			const bool same = lua_rawequal(m_L, -1, -2) != 0;
+			lua_pop(m_L, 1);
+			if (same)
+			{
+				lua_pop(m_L, 1);
+				return;
+			}
+			luaL_unref(m_L, LUA_REGISTRYINDEX, ref);
+			ref = LUA_NOREF;
+		}
+
+		if (!lua_isfunction(m_L, -1))
+		{
+			lua_pop(m_L, 1);
+			return;
+		}
+		ref = luaL_ref(m_L, LUA_REGISTRYINDEX);
+	}
+
+	// ͨõãֲٰȫֺ
+	// luaõCִУԴѹڵǰջܶջ׵ߵĲ
+	template<typename ...T>
+	bool InvokeRef(int ref, T ...args)
+	{
+		if (m_L == nullptr || ref == LUA_NOREF || ref == LUA_REFNIL) return false;
+
+		lua_pushcclosure(m_L, OnError, 0);
+		const int err_func = lua_gettop(m_L);
+
+		lua_rawgeti(m_L, LUA_REGISTRYINDEX, ref);
+		const int count = InvokePush(0, args...);
+		const bool succeed = lua_pcall(m_L, count, 0, err_func) == 0;
+
+		// ʱջϻ´ͬһ
+		lua_settop(m_L, err_func - 1);
+		return succeed;
+	}
+
+	// ȫֺȡһֵֵַʱresultΪ
+	template<typename ...T>
+	bool InvokeForString(const char* name, std::string& result, T ...args)
+	{
+		result.clear();
+		if (m_L == nullptr) return false;
+
+		lua_pushcclosure(m_L, OnError, 0);
+		const int err_func = lua_gettop(m_L);
+
+		bool succeed = false;
+		lua_getglobal(m_L, name);
+		if (lua_isfunction(m_L, -1))
+		{
+			const int count = InvokePush(0, args...);
+			if (lua_pcall(m_L, count, 1, err_func) == 0)
+			{
+				size_t len = 0;
+				const char* value = lua_tolstring(m_L, -1, &len);
+				if (value != nullptr) result.assign(value, len);
+				succeed = true;
+			}
+		}
+		else
+		{
+			std::string content;
+			content.append("attempt to call global '");
+			content.append(name);
+			content.append("' (not a function)");
+			CARP_SCRIPT_ERROR(content);
+		}
+
+		lua_settop(m_L, err_func - 1);
+		return succeed;
+	}
+
 	bool IsFunction(const char* name) const
 	{
 		if (m_L == nullptr) return false;
@@ -208,8 +515,13 @@ public:
 public:
 	lua_State* GetLuaState() const { return m_L; }
 
+	// ֮Requireȴcacheֽ룬ûʱ벢Žcache
+	void SetChunkCache(const CarpScriptChunkCachePtr& cache) { m_chunk_cache = cache; }
+
 protected:
 	lua_State* m_L = nullptr;					// lua state
+	CarpLuaAllocatorPtr m_allocator;			// ΪձʾʹluaĬϵķ
+	CarpScriptChunkCachePtr m_chunk_cache;		// ֽ
 
 public:
 	bool Require(const char* file_path)
@@ -220,22 +532,104 @@ public:
 		if (m_script_set.count(lua_path) > 0) return true;
 		m_script_set.insert(lua_path);
 
+		// ֽػִʧ(luaıѡͬ)ɾ֮Դ±
+		bool cache_failed = false;
+		if (m_chunk_cache)
+		{
+			const auto chunk = m_chunk_cache->Get(lua_path);
+			if (chunk)
+			{
+				if (RunScript(chunk->data(), chunk->size(), lua_path.c_str())) return true;
+				cache_failed = true;
+			}
+		}
+
 		std::vector<char> content;
 		if (!CarpRWops::LoadFile(lua_path.c_str(), content))
 		{
 			CARP_ERROR("can't find lua file:" << lua_path);
+			if (cache_failed) m_chunk_cache->Remove(lua_path, "");
 			return false;
 		}
 
+		// ̻ý֮ǰݼkey
+		std::string key;
+		if (m_chunk_cache && m_chunk_cache->HasCacheDir())
+		{
+			key = CarpScriptChunkCache::MakeKey(lua_path, content.data(), content.size());
+			const auto chunk = cache_failed ? nullptr : m_chunk_cache->Load(lua_path, key);
+			if (chunk)
+			{
+				if (RunScript(chunk->data(), chunk->size(), lua_path.c_str())) return true;
+				cache_failed = true;
+			}
+		}
+		if (cache_failed)
+		{
+			CARP_ERROR("lua chunk cache failed, compile from source:" << lua_path);
+			m_chunk_cache->Remove(lua_path, key);
+		}
+
 		const std::string start_text = "-- ALittle Generate Lua";
-		if (content.size() < start_text.size() || start_text != std::string(content.data(), start_text.size()))
-			CarpCrypto::XXTeaDecodeMemory(content.data(), static_cast<int>(content.size()), nullptr);
-		RunScript(content.data(), content.size(), lua_path.c_str());
-		return true;
+		const bool encrypt = content.size() < start_text.size() || start_text != std::string(content.data(), start_text.size());
+		if (encrypt) CarpCrypto::XXTeaDecodeMemory(content.data(), static_cast<int>(content.size()), nullptr);
+
+		std::string chunk;
+		const bool succeed = RunScript(content.data(), content.size(), lua_path.c_str(), m_chunk_cache ? &chunk : nullptr);
+		if (!chunk.empty()) m_chunk_cache->Save(lua_path, key, std::move(chunk), encrypt);
+		return succeed;
 	}
 
 protected:
 	std::set<std::string> m_script_set;
 };
 
+/* eg. ʱ䣬Ƚϲû桢һα벢д̻桢Ӵ̻
+	static double BenchStartup(const CarpScriptChunkCachePtr& cache, const std::string& core_path, const std::string& std_path, const std::string& lua_path)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		CarpScript script;
+		script.Init();
+		script.SetChunkCache(cache);
+		script.Require((core_path + "ALittle").c_str());
+		script.Invoke("RequireCore", core_path.c_str());
+		script.Require((std_path + "ALittle").c_str());
+		script.Invoke("RequireStd", std_path.c_str());
+		script.Require(lua_path.c_str());
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		script.Release();
+		return seconds;
+	}
+
+	// ɾluac_cacheĿ¼
+	const double no_cache = BenchStartup(nullptr, core_path, std_path, lua_path);
+	const double cold = BenchStartup(std::make_shared<CarpScriptChunkCache>("luac_cache"), core_path, std_path, lua_path);
+	const double warm = BenchStartup(std::make_shared<CarpScriptChunkCache>("luac_cache"), core_path, std_path, lua_path);
+	CARP_INFO("no cache:" << no_cache << "s cold:" << cold << "s warm:" << warm << "s");
+*/
+
+/* eg. ȽϰֵúͰõõĴλ:/
+	static void BenchInvoke()
+	{
+		CarpScript script;
+		script.Init();
+		const char* code = "function __Bench(a, b) return a end";
+		script.RunScript(code, strlen(code), "bench");
+
+		const int count = 5000000;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < count; ++i) script.Invoke("__Bench", i, "arg");
+		const double name_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		const int ref = script.RefFunction("__Bench");
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < count; ++i) script.InvokeRef(ref, i, "arg");
+		const double ref_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		script.UnrefFunction(ref);
+
+		CARP_INFO("Invoke:" << count / name_seconds << " InvokeRef:" << count / ref_seconds);
+		script.Release();
+	}
+*/
+
 #endif
@@ -0,0 +1,77 @@
+#ifndef CARP_SPSC_QUEUE_INCLUDED
+#define CARP_SPSC_QUEUE_INCLUDED
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+/* ߵߵζУ̶Ϊ2
+ * λһֱڣ֮Ķ󲻻´ʱԸڴ
+ * : BeginPushȡղλ֮EndPush
+ * : Frontȡͷ֮Pop
+ */
+template <typename T>
+class CarpSpscQueue
+{
+public:
+	explicit CarpSpscQueue(size_t capacity = 1024)
+	{
+		size_t size = 2;
+		while (size < capacity) size <<= 1;
+		m_slots.resize(size);
+		m_mask = size - 1;
+	}
+
+public:
+	// ߵãʱnullptr
+	T* BeginPush()
+	{
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_head_cache > m_mask)
+		{
+			m_head_cache = m_head.load(std::memory_order_acquire);
+			if (tail - m_head_cache > m_mask) return nullptr;
+		}
+		return &m_slots[tail & m_mask];
+	}
+
+	// ߵãBeginPushɹ֮ύ
+	void EndPush()
+	{
+		m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	// ߵãпʱnullptr
+	T* Front()
+	{
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_tail_cache)
+		{
+			m_tail_cache = m_tail.load(std::memory_order_acquire);
+			if (head == m_tail_cache) return nullptr;
+		}
+		return &m_slots[head & m_mask];
+	}
+
+	// ߵãFrontɹ֮
+	void Pop()
+	{
+		m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	bool IsEmpty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+	size_t GetSize() const { return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire); }
+	size_t GetCapacity() const { return m_mask + 1; }
+
+private:
+	std::vector<T> m_slots;
+	size_t m_mask = 0;
+
+	// ߺ߸ԵݷڲͬĻ
+	alignas(64) std::atomic<size_t> m_head{ 0 };	// д
+	size_t m_tail_cache = 0;						// ߿tail
+	alignas(64) std::atomic<size_t> m_tail{ 0 };	// д
+	size_t m_head_cache = 0;						// ߿head
+};
+
+#endif
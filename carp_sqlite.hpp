@@ -3,9 +3,15 @@
 
 #include <map>
 #include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #include "lualib/sqlite3/sqlite3.h"
 #include "Carp/carp_log.hpp"
+#include "Carp/carp_time.hpp"
+#include "Carp/carp_thread_consumer.hpp"
+#include "Carp/carp_stmt_cache.hpp"
 
 class CarpSqliteConnection
 {
@@ -31,18 +37,38 @@ public:
 		int memory_size = 0;
 	};
 
+	// open option
+	struct CarpSqliteOpenOption
+	{
+		bool read_only = false;				// open with SQLITE_OPEN_READONLY
+		bool wal = false;					// PRAGMA journal_mode=WAL
+		bool synchronous_normal = false;	// PRAGMA synchronous=NORMAL
+		long long mmap_size = 0;			// PRAGMA mmap_size, 0 means not set
+		int busy_timeout_ms = 0;			// sqlite3_busy_timeout, 0 means not set
+	};
+
 public:
 	/* connect sqlite
 	 * @param file_path: path of sqlite file
-	 * @param reconnect: reconnect if lost connect
 	 * @return succeed or not
 	 */
 	bool Open(const std::string& file_path)
+	{
+		return Open(file_path, CarpSqliteOpenOption());
+	}
+
+	/* connect sqlite
+	 * @param file_path: path of sqlite file
+	 * @param option: open flags and pragma
+	 * @return succeed or not
+	 */
+	bool Open(const std::string& file_path, const CarpSqliteOpenOption& option)
 	{
 		Close();
 
 		// create sqlite object
-		int result = sqlite3_open(file_path.c_str(), &m_sqlite);
+		int flags = option.read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+		int result = sqlite3_open_v2(file_path.c_str(), &m_sqlite, flags, nullptr);
 		// check create succeed or not
 		if (result != SQLITE_OK)
 		{
@@ -55,6 +81,13 @@ public:
 		// save file path
 		m_file_path = file_path;
 
+		// apply option
+		if (option.busy_timeout_ms > 0) sqlite3_busy_timeout(m_sqlite, option.busy_timeout_ms);
+		// journal mode is stored in database file, read only connection can not change it
+		if (option.wal && !option.read_only) ExecuteQuery("PRAGMA journal_mode=WAL");
+		if (option.synchronous_normal) ExecuteQuery("PRAGMA synchronous=NORMAL");
+		if (option.mmap_size > 0) ExecuteQuery(("PRAGMA mmap_size=" + std::to_string(option.mmap_size)).c_str());
+
 		return true;
 	}
 
@@ -63,15 +96,8 @@ public:
 	{
 		if (!m_sqlite) return;
 
-		// release all stmt
-		for (auto& pair : m_stmt_map)
-		{
-			// free stmt
-			sqlite3_finalize(pair.second->stmt);
-			// flag stmt to 0
-			pair.second->stmt = nullptr;
-		}
-		m_stmt_map.clear();
+		// release all stmt, keep stats
+		m_stmt_cache.ReleaseAll();
 
 		// release mysql object
 		sqlite3_close(m_sqlite);
@@ -91,15 +117,15 @@ public:
 		sqlite3_stmt* stmt = nullptr;								// stmt object
 		CarpSqliteConnection* conn = nullptr;							// come from
 		bool in_used = false;									// is in used;
+		CarpStmtStatsPtr stats;								// usage stats, shared by instances of the same sql
 	};
 	typedef std::shared_ptr<CarpSqliteStmtInfo> CarpSqliteStmtInfoPtr;
 
 	/* get stmt object
-	 * @param sql: sql string
-	 * @param cache: create cache memory
-	 * @return MysqlStmtInfo
+	 * @param handle: sql handle
+	 * @return idle stmt, create a new instance if all cached instance are in used
 	 */
-	CarpSqliteStmtInfoPtr GetStmt(const std::string& sql)
+	CarpSqliteStmtInfoPtr GetStmt(const CarpSqlHandle& handle)
 	{
 		if (!m_sqlite)
 		{
@@ -108,21 +134,22 @@ public:
 		}
 
 		// find stmt
-		auto it = m_stmt_map.find(sql);
-		if (it != m_stmt_map.end())
+		auto info = m_stmt_cache.Find(handle);
+		if (info)
 		{
-			sqlite3_reset(it->second->stmt);
-			return it->second;
+			sqlite3_reset(info->stmt);
+			return info;
 		}
 
 		// sqlite stmt info
-		auto info = std::make_shared<CarpSqliteStmtInfo>();
+		info = std::make_shared<CarpSqliteStmtInfo>();
 		info->conn = this;
 		info->in_used = false;
 		info->output_count = 0;
 
 		// create stmt
-		int result = sqlite3_prepare(m_sqlite, sql.c_str(), sql.size(), &info->stmt, 0);
+		const std::string& sql = handle.GetSQL();
+		int result = sqlite3_prepare_v2(m_sqlite, sql.c_str(), static_cast<int>(sql.size()), &info->stmt, 0);
 		if (result != SQLITE_OK)
 		{
 			CARP_ERROR("sqlite3_prepare failed: error code:" << sqlite3_errcode(m_sqlite) << ", message:" << sqlite3_errmsg(m_sqlite));
@@ -130,32 +157,39 @@ public:
 		}
 
 		// save and return
-		m_stmt_map[sql] = info;
+		if (!m_stmt_cache.Add(handle, info))
+		{
+			CARP_ERROR("stmt instance count reach max:" << m_stmt_cache.GetMaxInstance() << ", sql:" << sql);
+			sqlite3_finalize(info->stmt);
+			return CarpSqliteStmtInfoPtr();
+		}
 		return info;
 	}
+	CarpSqliteStmtInfoPtr GetStmt(const std::string& sql) { return GetStmt(CarpSqlHandle(sql)); }
 
-	bool ReleaseStmt(const std::string& sql)
+	bool ReleaseStmt(const CarpSqlHandle& handle)
 	{
-		auto it = m_stmt_map.find(sql);
-		if (it == m_stmt_map.end())
+		if (!m_stmt_cache.Remove(handle))
 		{
-			CARP_ERROR("can't find stmt by sql:" << sql);
+			CARP_ERROR("can't find stmt or stmt is in used, sql:" << handle.GetSQL());
 			return false;
 		}
-		if (it->second->in_used)
-		{
-			CARP_ERROR("stmt by sql is in used:" << sql);
-			return false;
-		}
-
-		// free stmt
-		sqlite3_finalize(it->second->stmt);
-		// flag stmt to 0
-		it->second->stmt = nullptr;
-
-		m_stmt_map.erase(it);
 		return true;
 	}
+	bool ReleaseStmt(const std::string& sql) { return ReleaseStmt(CarpSqlHandle(sql)); }
+
+	/* stmt cache setting
+	 * @param capacity: max sql count, the least recently used sql is evicted
+	 * @param max_instance: max instance count of one sql for reentrant execute
+	 */
+	void SetStmtCacheCapacity(size_t capacity, size_t max_instance)
+	{
+		m_stmt_cache.SetCapacity(capacity);
+		m_stmt_cache.SetMaxInstance(max_instance);
+	}
+
+	// dump stmt usage stats for tuning, order by total time
+	std::string DumpStmtStats(size_t top = 0) const { return m_stmt_cache.DumpStats(top); }
 
 public:
 	/*
@@ -170,15 +204,35 @@ public:
 		if (result != SQLITE_OK)
 		{
 			if (msg) CARP_ERROR("sqlite3_exec failed:" << msg);
+			sqlite3_free(msg);
 			return false;
 		}
 		return true;
 	}
 
+	// explicit transaction, statements between begin and commit share one fsync
+	bool BeginTransaction() { return ExecuteQuery("BEGIN IMMEDIATE"); }
+	bool CommitTransaction() { return ExecuteQuery("COMMIT"); }
+	bool RollbackTransaction() { return ExecuteQuery("ROLLBACK"); }
+
+	const std::string& GetFilePath() const { return m_file_path; }
+
+	// error of the last api call on this connection, SQLITE_OK/SQLITE_ROW/SQLITE_DONE means succeed
+	int GetErrorCode() const { return m_sqlite ? sqlite3_errcode(m_sqlite) : SQLITE_MISUSE; }
+	const char* GetErrorMessage() const { return m_sqlite ? sqlite3_errmsg(m_sqlite) : "m_sqlite is null"; }
+	// false when inside an explicit transaction, sqlite rolls back the whole transaction on some errors (SQLITE_FULL, SQLITE_IOERR...)
+	bool IsAutoCommit() const { return m_sqlite ? sqlite3_get_autocommit(m_sqlite) != 0 : true; }
+
 private:
 	sqlite3* m_sqlite = nullptr;
 	std::string m_file_path;
-	std::unordered_map<std::string, CarpSqliteStmtInfoPtr> m_stmt_map;
+	CarpStmtCache<CarpSqliteStmtInfo> m_stmt_cache{ [](CarpSqliteStmtInfoPtr& info)
+		{
+			// free stmt
+			sqlite3_finalize(info->stmt);
+			// flag stmt to 0
+			info->stmt = nullptr;
+		} };
 };
 
 
@@ -221,6 +275,7 @@ class CarpSqliteStatementQuery
 {
 public:
 	CarpSqliteStatementQuery(CarpSqliteConnection* conn, const std::string& sql) : m_conn(conn), m_sql(sql) {}
+	CarpSqliteStatementQuery(CarpSqliteConnection* conn, const CarpSqlHandle& sql) : m_conn(conn), m_sql(sql) {}
 	~CarpSqliteStatementQuery() { Clear(); }
 
 	//===================================================================
@@ -229,6 +284,14 @@ public:
 	 * @param sql: set sql string
 	 */
 	void SetSQL(const std::string& sql)
+	{
+		Reset();
+		m_sql = CarpSqlHandle(sql);
+	}
+	/* set sql handle, keep the handle to avoid hashing sql on every execute
+	 * @param sql: set sql handle
+	 */
+	void SetSQL(const CarpSqlHandle& sql)
 	{
 		Reset();
 		m_sql = sql;
@@ -333,6 +396,7 @@ public:
 
 		// reset output index
 		m_output_index = 0;
+		++m_row_count;
 
 		return true;
 	}
@@ -482,7 +546,7 @@ public:
 
 		int vector_size = size / static_cast<int>(sizeof(T));
 		ptr->resize(vector_size);
-		memcpy(&(*ptr)[0], memory, vector_size * static_cast<int>(sizeof(T));
+		memcpy(&(*ptr)[0], memory, vector_size * static_cast<int>(sizeof(T)));
 
 		BlobBindImpl2();
 
@@ -523,7 +587,7 @@ private:
 		m_has_next = false;
 
 		// sql must not be empty
-		if (m_sql.size() == 0) return false;
+		if (m_sql.IsEmpty()) return false;
 
 		// connect must not be null
 		if (!m_conn)
@@ -533,8 +597,8 @@ private:
 			return false;
 		}
 
-		// get stmt
-		if (!stmt_info || stmt_info->stmt == 0 || stmt_info->conn != m_conn)
+		// get stmt, if stmt is in used by other query, get another instance from cache
+		if (!stmt_info || stmt_info->stmt == 0 || stmt_info->conn != m_conn || stmt_info->in_used)
 			stmt_info = m_conn->GetStmt(m_sql);
 		if (!stmt_info)
 		{
@@ -543,16 +607,11 @@ private:
 			return false;
 		}
 
-		// check info in used or not
-		if (stmt_info->in_used)
-		{
-			CARP_ERROR("stmt is in used!" << m_sql);
-			End();
-			return false;
-		}
 		// flag in used
 		stmt_info->in_used = true;
 		m_stmt_info = stmt_info;
+		m_begin_time = CarpStmtStats::GetCurUSTime();
+		m_row_count = 0;
 
 		for (size_t i = 0; i < m_bind_input.size(); ++i)
 		{
@@ -591,6 +650,7 @@ private:
 		}
 
 		m_has_next = true;
+		m_row_count = 1;
 		stmt_info->output_count = sqlite3_data_count(stmt_info->stmt);
 		return true;
 	}
@@ -601,6 +661,14 @@ private:
 		// free result
 		if (m_stmt_info)
 		{
+			// record stats, rows is affected count for write statement
+			if (m_stmt_info->stats)
+			{
+				long long rows = m_row_count;
+				if (!sqlite3_stmt_readonly(m_stmt_info->stmt)) rows = sqlite3_changes(sqlite3_db_handle(m_stmt_info->stmt));
+				m_stmt_info->stats->Record(CarpStmtStats::GetCurUSTime() - m_begin_time, rows);
+			}
+
 			sqlite3_reset(m_stmt_info->stmt);
 			m_stmt_info->in_used = false;
 		}
@@ -609,8 +677,9 @@ private:
 
 		m_bind_input.resize(0);
 
-		m_sql = "";
+		m_sql = CarpSqlHandle();
 		m_output_index = 0;
+		m_row_count = 0;
 		m_has_next = false;
 	}
 
@@ -629,10 +698,395 @@ private:
 	std::vector<CarpSqliteConnection::SQLITE_BIND> m_bind_input;
 	int m_output_index = 0;
 	bool m_has_next = false;
-	std::string m_sql;				// SQL string
+	CarpSqlHandle m_sql;				// SQL string
+
+	long long m_begin_time = 0;		// begin time in microsecond, for stats
+	long long m_row_count = 0;		// row count read
 
 private:
 	bool m_need_reset = false;				// need reset or not
 };
 
+// write request of CarpSqliteWriteBehind, all params are copied so caller can release them after post
+class CarpSqliteWriteRequest
+{
+public:
+	CarpSqliteWriteRequest() {}
+	CarpSqliteWriteRequest(const std::string& sql) : m_sql(sql) {}
+	CarpSqliteWriteRequest(const CarpSqlHandle& sql) : m_sql(sql) {}
+
+	struct Param
+	{
+		CarpSqliteConnection::BindType bind_type = CarpSqliteConnection::BindType::BINDTYPE_NULL;
+		long long int_value = 0;
+		double double_value = 0;
+		std::string buffer;
+	};
+
+public:
+	void SetSQL(const std::string& sql) { m_sql = CarpSqlHandle(sql); }
+	void SetSQL(const CarpSqlHandle& sql) { m_sql = sql; }
+	const CarpSqlHandle& GetSQL() const { return m_sql; }
+	const std::vector<Param>& GetParams() const { return m_params; }
+
+public:
+	CarpSqliteWriteRequest& AddInt(long long value, CarpSqliteConnection::BindType type)
+	{
+		m_params.emplace_back(Param());
+		m_params.back().bind_type = type;
+		m_params.back().int_value = value;
+		return *this;
+	}
+	CarpSqliteWriteRequest& AddDouble(double value)
+	{
+		m_params.emplace_back(Param());
+		m_params.back().bind_type = CarpSqliteConnection::BindType::BINDTYPE_DOUBLE;
+		m_params.back().double_value = value;
+		return *this;
+	}
+	CarpSqliteWriteRequest& AddBuffer(const void* memory, size_t size, CarpSqliteConnection::BindType type)
+	{
+		m_params.emplace_back(Param());
+		m_params.back().bind_type = type;
+		if (size > 0) m_params.back().buffer.assign(static_cast<const char*>(memory), size);
+		return *this;
+	}
+	CarpSqliteWriteRequest& AddNull()
+	{
+		m_params.emplace_back(Param());
+		return *this;
+	}
+
+	CarpSqliteWriteRequest& operator << (int param) { return AddInt(param, CarpSqliteConnection::BindType::BINDTYPE_INT); }
+	CarpSqliteWriteRequest& operator << (long param) { return AddInt(param, CarpSqliteConnection::BindType::BINDTYPE_INT); }
+	CarpSqliteWriteRequest& operator << (long long param) { return AddInt(param, CarpSqliteConnection::BindType::BINDTYPE_INT64); }
+	CarpSqliteWriteRequest& operator << (double param) { return AddDouble(param); }
+	CarpSqliteWriteRequest& operator << (const char* param) { return AddBuffer(param, strlen(param), CarpSqliteConnection::BindType::BINDTYPE_TEXT); }
+	CarpSqliteWriteRequest& operator << (const std::string& param) { return AddBuffer(param.data(), param.size(), CarpSqliteConnection::BindType::BINDTYPE_TEXT); }
+	CarpSqliteWriteRequest& operator << (const std::vector<char>& param) { return AddBuffer(param.data(), param.size(), CarpSqliteConnection::BindType::BINDTYPE_BLOB); }
+	CarpSqliteWriteRequest& operator << (const std::vector<float>& param) { return AddBuffer(param.data(), param.size() * sizeof(float), CarpSqliteConnection::BindType::BINDTYPE_BLOB); }
+
+private:
+	CarpSqlHandle m_sql;
+	std::vector<Param> m_params;
+};
+
+/* write behind queue
+ * statements posted from any thread are executed on a background thread,
+ * and grouped into explicit transactions, commit when batch_count statements are executed,
+ * or batch_ms is passed, or the queue is idle for CARP_SQLITE_WRITE_BEHIND_IDLE_MS
+ */
+#define CARP_SQLITE_WRITE_BEHIND_IDLE_MS 50
+
+class CarpSqliteWriteBehind : public CarpThreadConsumer<CarpSqliteWriteRequest, CARP_SQLITE_WRITE_BEHIND_IDLE_MS>
+{
+public:
+	~CarpSqliteWriteBehind() { Shutdown(); }
+
+public:
+	/* start
+	 * @param file_path: path of sqlite file
+	 * @param option: open option of write connection
+	 * @param batch_count: max statement count of one transaction
+	 * @param batch_ms: max time of one transaction
+	 * @return succeed or not
+	 */
+	bool Setup(const std::string& file_path, const CarpSqliteConnection::CarpSqliteOpenOption& option, int batch_count = 1000, int batch_ms = 100)
+	{
+		if (IsStart()) return true;
+
+		if (!m_conn.Open(file_path, option)) return false;
+
+		m_batch_count = batch_count > 0 ? batch_count : 1;
+		m_batch_ms = batch_ms > 0 ? batch_ms : 0;
+		Start();
+		return true;
+	}
+
+	// post a write request, request is moved into queue
+	bool Post(CarpSqliteWriteRequest& request)
+	{
+		if (!IsStart())
+		{
+			CARP_ERROR("write behind is not started, sql:" << request.GetSQL().GetSQL());
+			return false;
+		}
+
+		++m_post_count;
+		Add(request);
+		return true;
+	}
+
+	// stop thread, execute all pending request and commit
+	void Shutdown()
+	{
+		Stop();
+		Commit();
+		m_conn.Close();
+	}
+
+public:
+	long long GetPostCount() const { return m_post_count; }
+	long long GetExecuteCount() const { return m_execute_count; }
+	long long GetFailedCount() const { return m_failed_count; }
+	long long GetCommitCount() const { return m_commit_count; }
+	long long GetPendingCount() const { return m_post_count - m_execute_count - m_failed_count; }
+
+protected:
+	void Execute(CarpSqliteWriteRequest& info) override
+	{
+		// start transaction
+		if (!m_in_transaction)
+		{
+			m_in_transaction = m_conn.BeginTransaction();
+			m_begin_time = CarpTime::GetCurMSTime();
+			m_batch_size = 0;
+		}
+
+		CarpSqliteStatementQuery query(&m_conn, info.GetSQL());
+		for (auto& param : info.GetParams())
+		{
+			switch (param.bind_type)
+			{
+			case CarpSqliteConnection::BindType::BINDTYPE_INT:
+			case CarpSqliteConnection::BindType::BINDTYPE_INT64:
+				// bind as int64, int value is widen when copy
+				query.CommonBindForInput((void*)&param.int_value, sizeof(long long), CarpSqliteConnection::BindType::BINDTYPE_INT64); break;
+			case CarpSqliteConnection::BindType::BINDTYPE_DOUBLE:
+				query.CommonBindForInput((void*)&param.double_value, sizeof(double), param.bind_type); break;
+			default:
+				query.CommonBindForInput((void*)param.buffer.data(), static_cast<unsigned int>(param.buffer.size()), param.bind_type); break;
+			}
+		}
+
+		// Execute only fails on bind, error of sqlite3_step (constraint, busy, full...) is checked by error code
+		CarpSqliteConnection::CarpSqliteStmtInfoPtr stmt_info;
+		bool succeed = query.Execute(stmt_info);
+		const int error_code = m_conn.GetErrorCode();
+		if (succeed && error_code != SQLITE_OK && error_code != SQLITE_ROW && error_code != SQLITE_DONE)
+		{
+			CARP_ERROR("write behind execute failed: error code:" << error_code << ", message:" << m_conn.GetErrorMessage() << ", sql:" << info.GetSQL().GetSQL());
+			succeed = false;
+		}
+		query.Clear();
+
+		if (!succeed)
+			++m_failed_count;
+		else if (m_in_transaction)
+			++m_batch_execute;			// counted when the transaction is committed
+		else
+			++m_execute_count;			// begin failed, statement is auto committed
+
+		// transaction is rolled back by sqlite, statements executed before are lost
+		if (m_in_transaction && m_conn.IsAutoCommit())
+		{
+			CARP_ERROR("write behind transaction is rolled back, lost statement count:" << m_batch_execute);
+			m_in_transaction = false;
+			m_batch_size = 0;
+			m_failed_count += m_batch_execute;
+			m_batch_execute = 0;
+			return;
+		}
+
+		// check commit
+		++m_batch_size;
+		if (m_batch_size >= m_batch_count || CarpTime::GetCurMSTime() - m_begin_time >= m_batch_ms)
+			Commit();
+	}
+
+	// queue is idle
+	void Flush() override { Commit(); }
+
+private:
+	void Commit()
+	{
+		if (!m_in_transaction) return;
+		m_in_transaction = false;
+		m_batch_size = 0;
+
+		const int batch_execute = m_batch_execute;
+		m_batch_execute = 0;
+
+		if (m_conn.CommitTransaction())
+		{
+			++m_commit_count;
+			m_execute_count += batch_execute;
+		}
+		else
+		{
+			// all statements of this batch are rolled back
+			m_conn.RollbackTransaction();
+			m_failed_count += batch_execute;
+		}
+	}
+
+private:
+	CarpSqliteConnection m_conn;			// write connection, only used in consumer thread
+	int m_batch_count = 1000;
+	long long m_batch_ms = 100;
+
+	bool m_in_transaction = false;
+	int m_batch_size = 0;
+	int m_batch_execute = 0;				// executed succeed in current transaction, not committed yet
+	long long m_begin_time = 0;
+
+	std::atomic<long long> m_post_count{ 0 };
+	std::atomic<long long> m_execute_count{ 0 };
+	std::atomic<long long> m_failed_count{ 0 };
+	std::atomic<long long> m_commit_count{ 0 };
+};
+
+// read connection pool, each connection is used by one thread at the same time
+class CarpSqliteReadPool
+{
+public:
+	~CarpSqliteReadPool() { Close(); }
+
+public:
+	/* open connections
+	 * @param file_path: path of sqlite file
+	 * @param count: connection count
+	 * @param option: open option of each connection, read_only is forced
+	 * @return succeed or not
+	 */
+	bool Open(const std::string& file_path, int count, CarpSqliteConnection::CarpSqliteOpenOption option)
+	{
+		Close();
+
+		option.read_only = true;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		for (int i = 0; i < count; ++i)
+		{
+			auto* conn = new CarpSqliteConnection();
+			if (!conn->Open(file_path, option))
+			{
+				delete conn;
+				break;
+			}
+			m_conns.push_back(conn);
+			m_idle.push_back(conn);
+		}
+		return !m_conns.empty();
+	}
+
+	void Close()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		// connection in used can not be released
+		if (m_idle.size() != m_conns.size())
+		{
+			CARP_ERROR("read pool has connection in used:" << (m_conns.size() - m_idle.size()));
+			return;
+		}
+		for (auto* conn : m_conns) delete conn;
+		m_conns.clear();
+		m_idle.clear();
+	}
+
+	// acquire a connection, block until one is idle
+	CarpSqliteConnection* Acquire()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (m_conns.empty()) return nullptr;
+		while (m_idle.empty()) m_cv.wait(lock);
+
+		auto* conn = m_idle.back();
+		m_idle.pop_back();
+		return conn;
+	}
+
+	// give back connection
+	void Release(CarpSqliteConnection* conn)
+	{
+		if (conn == nullptr) return;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_idle.push_back(conn);
+		m_cv.notify_one();
+	}
+
+	size_t GetCount() const { return m_conns.size(); }
+
+public:
+	// acquire in constructor, release in destructor
+	class Guard
+	{
+	public:
+		Guard(CarpSqliteReadPool* pool) : m_pool(pool), m_conn(pool->Acquire()) {}
+		~Guard() { m_pool->Release(m_conn); }
+		CarpSqliteConnection* Get() const { return m_conn; }
+
+	private:
+		CarpSqliteReadPool* m_pool = nullptr;
+		CarpSqliteConnection* m_conn = nullptr;
+	};
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::vector<CarpSqliteConnection*> m_conns;
+	std::vector<CarpSqliteConnection*> m_idle;
+};
+
+/* eg. insert benchmark
+CarpSqliteConnection::CarpSqliteOpenOption option;
+option.wal = true;
+option.synchronous_normal = true;
+option.mmap_size = 256 * 1024 * 1024;
+
+const int count = 100000;
+
+// before: every statement is an implicit transaction
+{
+	CarpSqliteConnection conn;
+	conn.Open("bench_before.db");
+	conn.ExecuteQuery("CREATE TABLE IF NOT EXISTS t (a INTEGER, b TEXT)");
+	long long start = CarpTime::GetCurMSTime();
+	for (int i = 0; i < count; ++i)
+	{
+		CarpSqliteStatementQuery query(&conn, "INSERT INTO t (a,b) VALUES (?,?)");
+		std::string b = std::to_string(i);
+		query << i << b;
+		CarpSqliteConnection::CarpSqliteStmtInfoPtr stmt_info;
+		query.Execute(stmt_info);
+	}
+	long long ms = CarpTime::GetCurMSTime() - start;
+	CARP_INFO("before inserts/sec:" << count * 1000.0 / (ms > 0 ? ms : 1));
+}
+
+// after: write behind with WAL
+{
+	CarpSqliteWriteBehind writer;
+	writer.Setup("bench_after.db", option, 1000, 100);
+	CarpSqliteWriteRequest create("CREATE TABLE IF NOT EXISTS t (a INTEGER, b TEXT)");
+	writer.Post(create);
+	long long start = CarpTime::GetCurMSTime();
+	for (int i = 0; i < count; ++i)
+	{
+		CarpSqliteWriteRequest request("INSERT INTO t (a,b) VALUES (?,?)");
+		request << i << std::to_string(i);
+		writer.Post(request);
+	}
+	writer.Shutdown();
+	long long ms = CarpTime::GetCurMSTime() - start;
+	CARP_INFO("after inserts/sec:" << count * 1000.0 / (ms > 0 ? ms : 1) << " commit:" << writer.GetCommitCount());
+}
+
+// constraint violation: the failed statement is logged and counted in GetFailedCount, other statements are committed
+{
+	CarpSqliteWriteBehind writer;
+	writer.Setup("constraint.db", option);
+	CarpSqliteWriteRequest create("CREATE TABLE IF NOT EXISTS u (id INTEGER PRIMARY KEY, name TEXT NOT NULL)");
+	writer.Post(create);
+	for (int id : { 1, 2, 1, 3 })
+	{
+		CarpSqliteWriteRequest request("INSERT INTO u (id,name) VALUES (?,?)");
+		request << id << std::string("name");
+		writer.Post(request);
+	}
+	writer.Shutdown();
+	// execute:4 failed:1, the second insert of id 1 is UNIQUE constraint failed
+	CARP_INFO("execute:" << writer.GetExecuteCount() << " failed:" << writer.GetFailedCount());
+}
+ */
+
 #endif
\ No newline at end of file
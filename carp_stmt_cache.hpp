@@ -0,0 +1,291 @@
+#ifndef CARP_STMT_CACHE_INCLUDED
+#define CARP_STMT_CACHE_INCLUDED
+
+#include <string>
+#include <list>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <sstream>
+#include <chrono>
+
+// sql string with precomputed hash, copy is cheap
+// keep the handle to avoid hashing sql string on every execute
+class CarpSqlHandle
+{
+public:
+	CarpSqlHandle() {}
+	CarpSqlHandle(const std::string& sql) : m_key(std::make_shared<Key>(sql)) {}
+
+public:
+	bool IsEmpty() const { return !m_key || m_key->sql.empty(); }
+	const std::string& GetSQL() const
+	{
+		static std::string empty;
+		return m_key ? m_key->sql : empty;
+	}
+	size_t GetHash() const { return m_key ? m_key->hash : 0; }
+
+	bool operator == (const CarpSqlHandle& handle) const
+	{
+		if (m_key == handle.m_key) return true;
+		return GetHash() == handle.GetHash() && GetSQL() == handle.GetSQL();
+	}
+
+private:
+	struct Key
+	{
+		Key(const std::string& s) : sql(s), hash(std::hash<std::string>()(s)) {}
+		std::string sql;
+		size_t hash = 0;
+	};
+	std::shared_ptr<const Key> m_key;
+};
+
+inline std::ostream& operator << (std::ostream& stream, const CarpSqlHandle& handle)
+{
+	return stream << handle.GetSQL();
+}
+
+// usage stats of one sql
+struct CarpStmtStats
+{
+	long long prepare_count = 0;		// stmt instance created
+	long long execute_count = 0;		// execute count
+	long long total_us = 0;				// total execute time, microsecond
+	long long max_us = 0;				// max execute time, microsecond
+	long long row_count = 0;			// rows read or affected
+
+	static long long GetCurUSTime()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void Record(long long us, long long rows)
+	{
+		++execute_count;
+		total_us += us;
+		if (us > max_us) max_us = us;
+		row_count += rows;
+	}
+};
+typedef std::shared_ptr<CarpStmtStats> CarpStmtStatsPtr;
+
+/* LRU cache of prepared statement
+ * INFO must have member: bool in_used, CarpStmtStatsPtr stats
+ * sql count is bounded by capacity, the least recently used sql which has no instance in used is evicted
+ * one sql can hold several instances, so the same sql can be executed reentrant
+ */
+template <typename INFO>
+class CarpStmtCache
+{
+public:
+	typedef std::shared_ptr<INFO> INFO_PTR;
+	typedef std::function<void(INFO_PTR&)> RELEASE_FUNC;
+
+public:
+	CarpStmtCache(RELEASE_FUNC release) : m_release(release) {}
+	~CarpStmtCache() { Clear(); }
+
+public:
+	void SetCapacity(size_t capacity) { m_capacity = capacity > 0 ? capacity : 1; Evict(); }
+	size_t GetCapacity() const { return m_capacity; }
+	void SetMaxInstance(size_t count) { m_max_instance = count > 0 ? count : 1; }
+	size_t GetMaxInstance() const { return m_max_instance; }
+	size_t GetSize() const { return m_lru.size(); }
+
+	long long GetHitCount() const { return m_hit_count; }
+	long long GetMissCount() const { return m_miss_count; }
+	long long GetEvictCount() const { return m_evict_count; }
+
+public:
+	/* find an idle instance, and move sql to the front of lru
+	 * @param handle: sql handle
+	 * @return idle instance, or null if not exist or all in used
+	 */
+	INFO_PTR Find(const CarpSqlHandle& handle)
+	{
+		Entry* entry = FindEntry(handle);
+		if (entry != nullptr)
+		{
+			for (auto& info : entry->instances)
+			{
+				if (info->in_used) continue;
+				++m_hit_count;
+				return info;
+			}
+		}
+
+		++m_miss_count;
+		return INFO_PTR();
+	}
+
+	/* add a new instance of sql
+	 * @param handle: sql handle
+	 * @param info: new instance
+	 * @return false if instance count of sql reach max
+	 */
+	bool Add(const CarpSqlHandle& handle, const INFO_PTR& info)
+	{
+		Entry* entry = FindEntry(handle);
+		if (entry == nullptr)
+		{
+			m_lru.emplace_front(Entry());
+			entry = &m_lru.front();
+			entry->handle = handle;
+			entry->stats = std::make_shared<CarpStmtStats>();
+			m_map.emplace(handle.GetHash(), m_lru.begin());
+		}
+
+		if (entry->instances.size() >= m_max_instance) return false;
+
+		info->stats = entry->stats;
+		++entry->stats->prepare_count;
+		entry->instances.push_back(info);
+
+		Evict();
+		return true;
+	}
+
+	/* release all instance of sql
+	 * @param handle: sql handle
+	 * @return false if not found or some instance is in used
+	 */
+	bool Remove(const CarpSqlHandle& handle)
+	{
+		auto range = m_map.equal_range(handle.GetHash());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (!(it->second->handle == handle)) continue;
+			if (IsInUsed(*it->second)) return false;
+
+			ReleaseEntry(*it->second);
+			m_lru.erase(it->second);
+			m_map.erase(it);
+			return true;
+		}
+		return false;
+	}
+
+	// release all instance, but keep sql and stats
+	void ReleaseAll()
+	{
+		for (auto& entry : m_lru)
+			ReleaseEntry(entry);
+	}
+
+	// release all instance and sql
+	void Clear()
+	{
+		ReleaseAll();
+		m_lru.clear();
+		m_map.clear();
+	}
+
+public:
+	/* dump stats, order by total time
+	 * @param top: max line count, 0 means all
+	 * @return text of stats
+	 */
+	std::string DumpStats(size_t top = 0) const
+	{
+		std::vector<const Entry*> list;
+		for (auto& entry : m_lru) list.push_back(&entry);
+		std::sort(list.begin(), list.end(), [](const Entry* a, const Entry* b) { return a->stats->total_us > b->stats->total_us; });
+		if (top > 0 && list.size() > top) list.resize(top);
+
+		std::ostringstream stream;
+		stream << "stmt cache size:" << m_lru.size() << "/" << m_capacity
+			<< " hit:" << m_hit_count << " miss:" << m_miss_count << " evict:" << m_evict_count << "\n";
+		for (auto* entry : list)
+		{
+			const auto& stats = *entry->stats;
+			stream << "execute:" << stats.execute_count
+				<< " total_us:" << stats.total_us
+				<< " avg_us:" << (stats.execute_count > 0 ? stats.total_us / stats.execute_count : 0)
+				<< " max_us:" << stats.max_us
+				<< " rows:" << stats.row_count
+				<< " prepare:" << stats.prepare_count
+				<< " instance:" << entry->instances.size()
+				<< " sql:" << entry->handle.GetSQL() << "\n";
+		}
+		return stream.str();
+	}
+
+private:
+	struct Entry
+	{
+		CarpSqlHandle handle;
+		std::vector<INFO_PTR> instances;
+		CarpStmtStatsPtr stats;
+	};
+	typedef typename std::list<Entry>::iterator EntryIterator;
+
+	// hash is precomputed in CarpSqlHandle
+	struct IdentityHash { size_t operator()(size_t value) const { return value; } };
+
+	Entry* FindEntry(const CarpSqlHandle& handle)
+	{
+		auto range = m_map.equal_range(handle.GetHash());
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (!(it->second->handle == handle)) continue;
+			m_lru.splice(m_lru.begin(), m_lru, it->second);
+			return &(*it->second);
+		}
+		return nullptr;
+	}
+
+	static bool IsInUsed(const Entry& entry)
+	{
+		for (auto& info : entry.instances)
+			if (info->in_used) return true;
+		return false;
+	}
+
+	void ReleaseEntry(Entry& entry)
+	{
+		for (auto& info : entry.instances) m_release(info);
+		entry.instances.clear();
+	}
+
+	void Evict()
+	{
+		auto it = m_lru.end();
+		while (m_lru.size() > m_capacity && it != m_lru.begin())
+		{
+			--it;
+			// keep the most recently used one, it may be just added and not in used yet
+			if (it == m_lru.begin()) break;
+			if (IsInUsed(*it)) continue;
+
+			auto range = m_map.equal_range(it->handle.GetHash());
+			for (auto map_it = range.first; map_it != range.second; ++map_it)
+			{
+				if (map_it->second != it) continue;
+				m_map.erase(map_it);
+				break;
+			}
+
+			ReleaseEntry(*it);
+			it = m_lru.erase(it);
+			++m_evict_count;
+		}
+	}
+
+private:
+	RELEASE_FUNC m_release;
+	size_t m_capacity = 256;			// max sql count
+	size_t m_max_instance = 4;			// max instance count of one sql
+
+	std::list<Entry> m_lru;				// front is the most recently used
+	std::unordered_multimap<size_t, EntryIterator, IdentityHash> m_map;
+
+	long long m_hit_count = 0;
+	long long m_miss_count = 0;
+	long long m_evict_count = 0;
+};
+
+#endif